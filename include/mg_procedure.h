@@ -992,6 +992,11 @@ enum mgp_error mgp_graph_is_mutable(struct mgp_graph *graph, int *result);
 /// Current implementation always returns without errors.
 enum mgp_error mgp_graph_is_transactional(struct mgp_graph *graph, int *result);
 
+/// Result is the name of the database the graph belongs to.
+/// The name is valid as long as the graph.
+/// Current implementation always returns without errors.
+enum mgp_error mgp_graph_get_database_name(struct mgp_graph *graph, const char **result);
+
 /// Add a new vertex to the graph.
 /// Resulting vertex must be freed using mgp_vertex_destroy.
 /// Return mgp_error::MGP_ERROR_IMMUTABLE_OBJECT if `graph` is immutable.
@@ -1483,6 +1488,10 @@ enum mgp_error mgp_type_nullable(struct mgp_type *type, struct mgp_type **result
 /// Arguments to `mgp_init_module` will not live longer than the function's
 /// execution, so you must not store them globally. Additionally, you must not
 /// use the passed in mgp_memory to allocate global resources.
+///
+/// A module that keeps state per database can also define
+/// `int mgp_on_database_drop(const char *database_name)`, which is called
+/// after a database is dropped so the state can be released.
 ///@{
 
 /// Stores information on your query module.
@@ -234,6 +234,8 @@ class Graph {
   bool IsMutable() const;
   /// @brief Returns whether the graph is in a transactional storage mode.
   bool IsTransactional() const;
+  /// @brief Returns the name of the database the graph belongs to.
+  std::string_view DatabaseName() const;
   /// @brief Creates a node and adds it to the graph.
   Node CreateNode();
   /// @brief Deletes a node from the graph.
@@ -2092,6 +2094,8 @@ inline bool Graph::IsMutable() const { return mgp::graph_is_mutable(graph_); }
 
 inline bool Graph::IsTransactional() const { return mgp::graph_is_transactional(graph_); }
 
+inline std::string_view Graph::DatabaseName() const { return mgp::graph_get_database_name(graph_); }
+
 inline Node Graph::CreateNode() {
   auto *vertex = mgp::MemHandlerCallback(graph_create_vertex, graph_);
   auto node = Node(vertex);
@@ -0,0 +1,1331 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <exception>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <optional>
+#include <queue>
+#include <random>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include <mgp.hpp>
+
+namespace GraphAlgorithms {
+constexpr std::string_view kProcedurePageRank = "pagerank";
+constexpr std::string_view kProcedureWeaklyConnectedComponents = "weakly_connected_components";
+constexpr std::string_view kProcedureStronglyConnectedComponents = "strongly_connected_components";
+constexpr std::string_view kProcedureLabelPropagation = "label_propagation";
+constexpr std::string_view kProcedureBetweennessCentrality = "betweenness_centrality";
+constexpr std::string_view kProcedureKCore = "k_core";
+constexpr std::string_view kProcedureTriangleCount = "triangle_count";
+constexpr std::string_view kProcedureBuildLandmarks = "build_landmarks";
+constexpr std::string_view kProcedureWeightedShortestPath = "weighted_shortest_path";
+constexpr std::string_view kParameterMaxIterations = "max_iterations";
+constexpr std::string_view kParameterDampingFactor = "damping_factor";
+constexpr std::string_view kParameterStopEpsilon = "stop_epsilon";
+constexpr std::string_view kParameterSamples = "samples";
+constexpr std::string_view kParameterDirected = "directed";
+constexpr std::string_view kParameterNormalized = "normalized";
+constexpr std::string_view kParameterSeed = "seed";
+constexpr std::string_view kParameterK = "k";
+constexpr std::string_view kParameterEdgeType = "edge_type";
+constexpr std::string_view kParameterWeightProperty = "weight_property";
+constexpr std::string_view kParameterLandmarks = "landmarks";
+constexpr std::string_view kParameterSource = "source";
+constexpr std::string_view kParameterTarget = "target";
+constexpr std::string_view kParameterBidirectional = "bidirectional";
+constexpr std::string_view kReturnNode = "node";
+constexpr std::string_view kReturnRank = "rank";
+constexpr std::string_view kReturnComponentId = "component_id";
+constexpr std::string_view kReturnCommunityId = "community_id";
+constexpr std::string_view kReturnBetweennessCentrality = "betweenness_centrality";
+constexpr std::string_view kReturnCore = "core";
+constexpr std::string_view kReturnTriangles = "triangles";
+constexpr std::string_view kReturnLandmarks = "landmarks";
+constexpr std::string_view kReturnNodes = "nodes";
+constexpr std::string_view kReturnPath = "path";
+constexpr std::string_view kReturnTotalWeight = "total_weight";
+constexpr std::string_view kReturnSettled = "settled";
+
+void PageRank(mgp_list *args, mgp_graph *memgraph_graph, mgp_result *result, mgp_memory *memory);
+void WeaklyConnectedComponents(mgp_list *args, mgp_graph *memgraph_graph, mgp_result *result, mgp_memory *memory);
+void StronglyConnectedComponents(mgp_list *args, mgp_graph *memgraph_graph, mgp_result *result, mgp_memory *memory);
+void LabelPropagation(mgp_list *args, mgp_graph *memgraph_graph, mgp_result *result, mgp_memory *memory);
+void BetweennessCentrality(mgp_list *args, mgp_graph *memgraph_graph, mgp_result *result, mgp_memory *memory);
+void KCore(mgp_list *args, mgp_graph *memgraph_graph, mgp_result *result, mgp_memory *memory);
+void TriangleCount(mgp_list *args, mgp_graph *memgraph_graph, mgp_result *result, mgp_memory *memory);
+void BuildLandmarks(mgp_list *args, mgp_graph *memgraph_graph, mgp_result *result, mgp_memory *memory);
+void WeightedShortestPath(mgp_list *args, mgp_graph *memgraph_graph, mgp_result *result, mgp_memory *memory);
+}  // namespace GraphAlgorithms
+
+namespace {
+
+// Vertices are renumbered to dense indices and relationships are stored in CSR form in both directions. The graph is
+// read through the API once and the kernels below only touch these flat arrays, from as many threads as there are
+// cores. Kernels never call into the API, so worker threads don't need a registered memory resource.
+struct CompactGraph {
+  std::vector<int64_t> ids;
+  std::vector<uint64_t> out_offsets;
+  std::vector<uint32_t> out_neighbours;
+  std::vector<uint64_t> in_offsets;
+  std::vector<uint32_t> in_neighbours;
+
+  uint32_t Order() const { return static_cast<uint32_t>(ids.size()); }
+  uint64_t Degree(uint32_t vertex) const {
+    return out_offsets[vertex + 1] - out_offsets[vertex] + in_offsets[vertex + 1] - in_offsets[vertex];
+  }
+  std::span<const uint32_t> Out(uint32_t vertex) const {
+    return {out_neighbours.data() + out_offsets[vertex], out_neighbours.data() + out_offsets[vertex + 1]};
+  }
+  std::span<const uint32_t> In(uint32_t vertex) const {
+    return {in_neighbours.data() + in_offsets[vertex], in_neighbours.data() + in_offsets[vertex + 1]};
+  }
+};
+
+void FillAdjacency(uint32_t order, const std::vector<uint32_t> &from, const std::vector<uint32_t> &to,
+                   std::vector<uint64_t> &offsets, std::vector<uint32_t> &neighbours) {
+  offsets.assign(order + 1, 0);
+  for (const auto vertex : from) ++offsets[vertex + 1];
+  std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+  neighbours.resize(from.size());
+  std::vector<uint64_t> position(offsets.begin(), offsets.end() - 1);
+  for (size_t i = 0; i < from.size(); ++i) neighbours[position[from[i]]++] = to[i];
+}
+
+CompactGraph BuildCompactGraph(const mgp::Graph &graph) {
+  CompactGraph compact;
+  std::unordered_map<int64_t, uint32_t> index;
+  for (const auto node : graph.Nodes()) {
+    if (compact.ids.size() == std::numeric_limits<uint32_t>::max()) {
+      throw std::length_error("The graph has too many nodes.");
+    }
+    index.emplace(node.Id().AsInt(), static_cast<uint32_t>(compact.ids.size()));
+    compact.ids.push_back(node.Id().AsInt());
+  }
+
+  std::vector<uint32_t> from;
+  std::vector<uint32_t> to;
+  for (const auto relationship : graph.Relationships()) {
+    from.push_back(index.at(relationship.From().Id().AsInt()));
+    to.push_back(index.at(relationship.To().Id().AsInt()));
+  }
+  index.clear();
+
+  FillAdjacency(compact.Order(), from, to, compact.out_offsets, compact.out_neighbours);
+  FillAdjacency(compact.Order(), to, from, compact.in_offsets, compact.in_neighbours);
+  return compact;
+}
+
+// Keeps per-worker accumulators on separate cache lines.
+template <typename T>
+struct alignas(64) Padded {
+  T value{};
+};
+
+constexpr uint64_t kBlockSize = 1024;
+
+unsigned WorkerCount(uint64_t size, uint64_t block_size = kBlockSize) {
+  const auto blocks = (size + block_size - 1) / block_size;
+  return static_cast<unsigned>(std::min<uint64_t>(std::max(1U, std::thread::hardware_concurrency()), blocks));
+}
+
+// Calls `func(worker, begin, end)` for blocks of [0, size). Workers take the next block from a shared counter, so a
+// few heavy vertices don't leave the other threads idle. The first exception thrown by any worker is rethrown.
+template <typename TFunc>
+void ParallelFor(uint64_t size, const TFunc &func, uint64_t block_size = kBlockSize) {
+  const auto workers = WorkerCount(size, block_size);
+  if (workers <= 1) {
+    if (size > 0) func(0U, uint64_t{0}, size);
+    return;
+  }
+
+  std::atomic<uint64_t> next{0};
+  std::exception_ptr error;
+  std::mutex error_lock;
+  auto work = [&](unsigned worker) {
+    try {
+      while (true) {
+        const auto begin = next.fetch_add(block_size, std::memory_order_relaxed);
+        if (begin >= size) return;
+        func(worker, begin, std::min(size, begin + block_size));
+      }
+    } catch (...) {
+      const std::lock_guard guard(error_lock);
+      if (!error) error = std::current_exception();
+      next.store(size, std::memory_order_relaxed);
+    }
+  };
+  {
+    std::vector<std::jthread> threads;
+    threads.reserve(workers - 1);
+    for (unsigned worker = 1; worker < workers; ++worker) threads.emplace_back(work, worker);
+    work(0);
+  }
+  if (error) std::rethrow_exception(error);
+}
+
+template <typename T>
+T Sum(std::vector<Padded<T>> &partials) {
+  T sum{};
+  for (auto &partial : partials) {
+    sum += partial.value;
+    partial.value = T{};
+  }
+  return sum;
+}
+
+// Collects the vertices from `candidates` that satisfy `predicate`, in no particular order.
+template <typename TPredicate>
+std::vector<uint32_t> Filter(const std::vector<uint32_t> &candidates, const TPredicate &predicate) {
+  std::vector<std::vector<uint32_t>> selected(WorkerCount(candidates.size()));
+  ParallelFor(candidates.size(), [&](unsigned worker, uint64_t begin, uint64_t end) {
+    for (auto i = begin; i < end; ++i) {
+      if (predicate(candidates[i])) selected[worker].push_back(candidates[i]);
+    }
+  });
+  std::vector<uint32_t> result;
+  for (const auto &part : selected) result.insert(result.end(), part.begin(), part.end());
+  return result;
+}
+
+std::vector<double> PageRankKernel(const CompactGraph &graph, int64_t max_iterations, double damping_factor,
+                                   double stop_epsilon) {
+  const auto order = graph.Order();
+  if (order == 0) return {};
+  std::vector<double> rank(order, 1.0 / order);
+  std::vector<double> next(order);
+  std::vector<double> contribution(order);
+  std::vector<Padded<double>> partials(WorkerCount(order));
+
+  for (int64_t iteration = 0; iteration < max_iterations; ++iteration) {
+    // Rank of nodes without outgoing relationships is spread over all nodes.
+    ParallelFor(order, [&](unsigned worker, uint64_t begin, uint64_t end) {
+      double dangling = 0;
+      for (auto vertex = begin; vertex < end; ++vertex) {
+        const auto degree = graph.Out(vertex).size();
+        contribution[vertex] = degree == 0 ? 0 : rank[vertex] / degree;
+        if (degree == 0) dangling += rank[vertex];
+      }
+      partials[worker].value += dangling;
+    });
+    const auto base = (1 - damping_factor + damping_factor * Sum(partials)) / order;
+
+    ParallelFor(order, [&](unsigned worker, uint64_t begin, uint64_t end) {
+      double difference = 0;
+      for (auto vertex = begin; vertex < end; ++vertex) {
+        double sum = 0;
+        for (const auto neighbour : graph.In(vertex)) sum += contribution[neighbour];
+        next[vertex] = base + damping_factor * sum;
+        difference += std::abs(next[vertex] - rank[vertex]);
+      }
+      partials[worker].value += difference;
+    });
+    rank.swap(next);
+    if (Sum(partials) < stop_epsilon) break;
+  }
+  return rank;
+}
+
+uint32_t FindRoot(std::vector<std::atomic<uint32_t>> &parent, uint32_t vertex) {
+  while (true) {
+    auto current = parent[vertex].load(std::memory_order_acquire);
+    if (current == vertex) return vertex;
+    const auto grandparent = parent[current].load(std::memory_order_acquire);
+    // Path halving, losing the race only means the path stays longer.
+    if (current != grandparent) parent[vertex].compare_exchange_weak(current, grandparent, std::memory_order_acq_rel);
+    vertex = grandparent;
+  }
+}
+
+// Lock-free union-find. Only roots are hooked, always the larger index under the smaller one, so every component ends
+// up rooted at its smallest vertex index.
+std::vector<uint32_t> WeaklyConnectedComponentsKernel(const CompactGraph &graph) {
+  const auto order = graph.Order();
+  std::vector<std::atomic<uint32_t>> parent(order);
+  ParallelFor(order, [&](unsigned, uint64_t begin, uint64_t end) {
+    for (auto vertex = begin; vertex < end; ++vertex) parent[vertex].store(vertex, std::memory_order_relaxed);
+  });
+
+  ParallelFor(order, [&](unsigned, uint64_t begin, uint64_t end) {
+    for (auto vertex = begin; vertex < end; ++vertex) {
+      for (const auto neighbour : graph.Out(vertex)) {
+        auto first = static_cast<uint32_t>(vertex);
+        auto second = neighbour;
+        while (true) {
+          first = FindRoot(parent, first);
+          second = FindRoot(parent, second);
+          if (first == second) break;
+          if (first < second) std::swap(first, second);
+          auto expected = first;
+          if (parent[first].compare_exchange_strong(expected, second, std::memory_order_acq_rel)) break;
+        }
+      }
+    }
+  });
+
+  std::vector<uint32_t> component(order);
+  ParallelFor(order, [&](unsigned, uint64_t begin, uint64_t end) {
+    for (auto vertex = begin; vertex < end; ++vertex) component[vertex] = FindRoot(parent, vertex);
+  });
+  return component;
+}
+
+// Iterative Tarjan. It is linear in the size of the graph and runs on a single thread.
+std::vector<uint32_t> StronglyConnectedComponentsKernel(const CompactGraph &graph) {
+  constexpr auto kUnassigned = std::numeric_limits<uint32_t>::max();
+  const auto order = graph.Order();
+  std::vector<uint32_t> index(order, kUnassigned);
+  std::vector<uint32_t> low(order);
+  std::vector<uint32_t> component(order, kUnassigned);
+  std::vector<uint32_t> stack;
+  std::vector<std::pair<uint32_t, uint64_t>> call_stack;
+  uint32_t next_index = 0;
+  uint32_t next_component = 0;
+
+  auto visit = [&](uint32_t vertex) {
+    index[vertex] = low[vertex] = next_index++;
+    stack.push_back(vertex);
+    call_stack.emplace_back(vertex, graph.out_offsets[vertex]);
+  };
+
+  for (uint32_t root = 0; root < order; ++root) {
+    if (index[root] != kUnassigned) continue;
+    visit(root);
+    while (!call_stack.empty()) {
+      auto &[vertex, edge] = call_stack.back();
+      if (edge < graph.out_offsets[vertex + 1]) {
+        const auto neighbour = graph.out_neighbours[edge++];
+        if (index[neighbour] == kUnassigned) {
+          visit(neighbour);
+        } else if (component[neighbour] == kUnassigned) {
+          low[vertex] = std::min(low[vertex], index[neighbour]);
+        }
+        continue;
+      }
+
+      const auto finished = vertex;
+      call_stack.pop_back();
+      if (!call_stack.empty()) {
+        auto &parent = call_stack.back().first;
+        low[parent] = std::min(low[parent], low[finished]);
+      }
+      if (low[finished] == index[finished]) {
+        uint32_t member = 0;
+        do {
+          member = stack.back();
+          stack.pop_back();
+          component[member] = next_component;
+        } while (member != finished);
+        ++next_component;
+      }
+    }
+  }
+  return component;
+}
+
+// Relationships are treated as undirected. Labels are updated in place so neighbours processed later in the same
+// iteration already see the new label, which keeps the synchronous version's oscillation on bipartite structures away.
+std::vector<uint32_t> LabelPropagationKernel(const CompactGraph &graph, int64_t max_iterations) {
+  const auto order = graph.Order();
+  std::vector<std::atomic<uint32_t>> labels(order);
+  ParallelFor(order, [&](unsigned, uint64_t begin, uint64_t end) {
+    for (auto vertex = begin; vertex < end; ++vertex) labels[vertex].store(vertex, std::memory_order_relaxed);
+  });
+
+  const auto workers = WorkerCount(order);
+  std::vector<std::vector<uint32_t>> neighbour_labels(workers);
+  std::vector<Padded<uint64_t>> changes(workers);
+  for (int64_t iteration = 0; iteration < max_iterations; ++iteration) {
+    ParallelFor(order, [&](unsigned worker, uint64_t begin, uint64_t end) {
+      auto &candidates = neighbour_labels[worker];
+      uint64_t changed = 0;
+      for (auto vertex = begin; vertex < end; ++vertex) {
+        candidates.clear();
+        for (const auto neighbour : graph.Out(vertex)) {
+          if (neighbour != vertex) candidates.push_back(labels[neighbour].load(std::memory_order_relaxed));
+        }
+        for (const auto neighbour : graph.In(vertex)) {
+          if (neighbour != vertex) candidates.push_back(labels[neighbour].load(std::memory_order_relaxed));
+        }
+        if (candidates.empty()) continue;
+        std::sort(candidates.begin(), candidates.end());
+
+        // The most frequent label wins. Ties are broken in favour of the current label and then the smallest one.
+        const auto current = labels[vertex].load(std::memory_order_relaxed);
+        uint32_t best = 0;
+        uint64_t best_count = 0;
+        uint64_t current_count = 0;
+        for (size_t i = 0; i < candidates.size();) {
+          auto j = i;
+          while (j < candidates.size() && candidates[j] == candidates[i]) ++j;
+          if (candidates[i] == current) current_count = j - i;
+          if (j - i > best_count) {
+            best = candidates[i];
+            best_count = j - i;
+          }
+          i = j;
+        }
+        if (current_count == best_count) continue;
+        labels[vertex].store(best, std::memory_order_relaxed);
+        ++changed;
+      }
+      changes[worker].value += changed;
+    });
+    if (Sum(changes) == 0) break;
+  }
+
+  std::vector<uint32_t> result(order);
+  for (uint32_t vertex = 0; vertex < order; ++vertex) result[vertex] = labels[vertex].load(std::memory_order_relaxed);
+  return result;
+}
+
+// Brandes' algorithm from every node, or from `samples` randomly chosen nodes with the result extrapolated to the
+// whole graph. Sources are processed in parallel, every worker keeps its own BFS state.
+std::vector<double> BetweennessCentralityKernel(const CompactGraph &graph, bool directed, int64_t samples,
+                                                int64_t seed, bool normalized) {
+  const auto order = graph.Order();
+  std::vector<uint32_t> sources(order);
+  std::iota(sources.begin(), sources.end(), 0);
+  if (samples > 0 && static_cast<uint64_t>(samples) < order) {
+    std::mt19937_64 generator(seed);
+    std::shuffle(sources.begin(), sources.end(), generator);
+    sources.resize(samples);
+  }
+
+  struct State {
+    std::vector<int64_t> distance;
+    std::vector<double> paths;
+    std::vector<double> dependency;
+    std::vector<uint32_t> visited;
+  };
+  std::vector<State> states(WorkerCount(sources.size(), 1));
+  std::vector<std::atomic<double>> centrality(order);
+
+  ParallelFor(
+      sources.size(),
+      [&](unsigned worker, uint64_t begin, uint64_t end) {
+        auto &state = states[worker];
+        if (state.distance.empty()) {
+          state.distance.assign(order, -1);
+          state.paths.assign(order, 0);
+          state.dependency.assign(order, 0);
+        }
+        auto &[distance, paths, dependency, visited] = state;
+
+        for (auto i = begin; i < end; ++i) {
+          const auto source = sources[i];
+          distance[source] = 0;
+          paths[source] = 1;
+          visited.push_back(source);
+
+          // The BFS queue doubles as the visiting order for the dependency accumulation.
+          for (size_t head = 0; head < visited.size(); ++head) {
+            const auto vertex = visited[head];
+            auto relax = [&](uint32_t neighbour) {
+              if (distance[neighbour] < 0) {
+                distance[neighbour] = distance[vertex] + 1;
+                visited.push_back(neighbour);
+              }
+              if (distance[neighbour] == distance[vertex] + 1) paths[neighbour] += paths[vertex];
+            };
+            for (const auto neighbour : graph.Out(vertex)) relax(neighbour);
+            if (!directed) {
+              for (const auto neighbour : graph.In(vertex)) relax(neighbour);
+            }
+          }
+
+          for (auto it = visited.rbegin(); it != visited.rend(); ++it) {
+            const auto vertex = *it;
+            auto accumulate = [&](uint32_t neighbour) {
+              if (distance[neighbour] == distance[vertex] + 1) {
+                dependency[vertex] += paths[vertex] / paths[neighbour] * (1 + dependency[neighbour]);
+              }
+            };
+            for (const auto neighbour : graph.Out(vertex)) accumulate(neighbour);
+            if (!directed) {
+              for (const auto neighbour : graph.In(vertex)) accumulate(neighbour);
+            }
+            if (vertex != source && dependency[vertex] != 0) {
+              centrality[vertex].fetch_add(dependency[vertex], std::memory_order_relaxed);
+            }
+          }
+
+          for (const auto vertex : visited) {
+            distance[vertex] = -1;
+            paths[vertex] = 0;
+            dependency[vertex] = 0;
+          }
+          visited.clear();
+        }
+      },
+      1);
+
+  auto scale = sources.empty() ? 0.0 : static_cast<double>(order) / sources.size();
+  // Every undirected path is found from both of its ends.
+  if (!directed) scale /= 2;
+  if (normalized && order > 2) scale /= (directed ? 1.0 : 0.5) * (order - 1) * (order - 2);
+
+  std::vector<double> result(order);
+  for (uint32_t vertex = 0; vertex < order; ++vertex) {
+    result[vertex] = centrality[vertex].load(std::memory_order_relaxed) * scale;
+  }
+  return result;
+}
+
+// Parallel peeling. All nodes whose degree drops to the current level are removed together, the thread that brings a
+// neighbour's degree down to the level puts it into the next frontier. Relationships are treated as undirected.
+std::vector<uint64_t> KCoreKernel(const CompactGraph &graph) {
+  constexpr auto kUnassigned = std::numeric_limits<uint64_t>::max();
+  const auto order = graph.Order();
+  std::vector<uint64_t> core(order, kUnassigned);
+  std::vector<std::atomic<uint64_t>> degree(order);
+  ParallelFor(order, [&](unsigned, uint64_t begin, uint64_t end) {
+    for (auto vertex = begin; vertex < end; ++vertex) {
+      auto self_loops = std::count(graph.Out(vertex).begin(), graph.Out(vertex).end(), vertex) +
+                        std::count(graph.In(vertex).begin(), graph.In(vertex).end(), vertex);
+      degree[vertex].store(graph.Degree(vertex) - self_loops, std::memory_order_relaxed);
+    }
+  });
+
+  std::vector<uint32_t> remaining(order);
+  std::iota(remaining.begin(), remaining.end(), 0);
+  std::vector<std::vector<uint32_t>> next_frontier(WorkerCount(order));
+  uint64_t level = 0;
+  while (!remaining.empty()) {
+    remaining = Filter(remaining, [&](uint32_t vertex) { return core[vertex] == kUnassigned; });
+    if (remaining.empty()) break;
+    uint64_t minimum = kUnassigned;
+    for (const auto vertex : remaining) minimum = std::min(minimum, degree[vertex].load(std::memory_order_relaxed));
+    level = std::max(level, minimum);
+
+    auto frontier =
+        Filter(remaining, [&](uint32_t vertex) { return degree[vertex].load(std::memory_order_relaxed) <= level; });
+    while (!frontier.empty()) {
+      ParallelFor(frontier.size(), [&](unsigned, uint64_t begin, uint64_t end) {
+        for (auto i = begin; i < end; ++i) core[frontier[i]] = level;
+      });
+      ParallelFor(frontier.size(), [&](unsigned worker, uint64_t begin, uint64_t end) {
+        for (auto i = begin; i < end; ++i) {
+          const auto vertex = frontier[i];
+          auto release = [&](uint32_t neighbour) {
+            if (neighbour == vertex || core[neighbour] != kUnassigned) return;
+            if (degree[neighbour].fetch_sub(1, std::memory_order_relaxed) == level + 1) {
+              next_frontier[worker].push_back(neighbour);
+            }
+          };
+          for (const auto neighbour : graph.Out(vertex)) release(neighbour);
+          for (const auto neighbour : graph.In(vertex)) release(neighbour);
+        }
+      });
+      frontier.clear();
+      for (auto &part : next_frontier) {
+        frontier.insert(frontier.end(), part.begin(), part.end());
+        part.clear();
+      }
+    }
+  }
+  return core;
+}
+
+// Relationships are treated as undirected and parallel relationships are counted once. Every triangle is found
+// exactly once from its lowest ranked node by intersecting sorted lists of higher ranked neighbours.
+std::vector<uint64_t> TriangleCountKernel(const CompactGraph &graph) {
+  const auto order = graph.Order();
+  auto higher = [&](uint32_t first, uint32_t second) {
+    const auto first_degree = graph.Degree(first);
+    const auto second_degree = graph.Degree(second);
+    return second_degree > first_degree || (second_degree == first_degree && second > first);
+  };
+  auto collect = [&](uint32_t vertex, std::vector<uint32_t> &neighbours) {
+    neighbours.clear();
+    for (const auto neighbour : graph.Out(vertex)) {
+      if (higher(vertex, neighbour)) neighbours.push_back(neighbour);
+    }
+    for (const auto neighbour : graph.In(vertex)) {
+      if (higher(vertex, neighbour)) neighbours.push_back(neighbour);
+    }
+    std::sort(neighbours.begin(), neighbours.end());
+    neighbours.erase(std::unique(neighbours.begin(), neighbours.end()), neighbours.end());
+  };
+
+  const auto workers = WorkerCount(order);
+  std::vector<std::vector<uint32_t>> scratch(workers);
+  std::vector<uint64_t> offsets(order + 1, 0);
+  ParallelFor(order, [&](unsigned worker, uint64_t begin, uint64_t end) {
+    for (auto vertex = begin; vertex < end; ++vertex) {
+      collect(vertex, scratch[worker]);
+      offsets[vertex + 1] = scratch[worker].size();
+    }
+  });
+  std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+  std::vector<uint32_t> neighbours(offsets.back());
+  ParallelFor(order, [&](unsigned worker, uint64_t begin, uint64_t end) {
+    for (auto vertex = begin; vertex < end; ++vertex) {
+      collect(vertex, scratch[worker]);
+      std::copy(scratch[worker].begin(), scratch[worker].end(), neighbours.begin() + offsets[vertex]);
+    }
+  });
+
+  std::vector<std::atomic<uint64_t>> triangles(order);
+  ParallelFor(order, [&](unsigned, uint64_t begin, uint64_t end) {
+    for (auto vertex = begin; vertex < end; ++vertex) {
+      const auto *vertex_begin = neighbours.data() + offsets[vertex];
+      const auto *vertex_end = neighbours.data() + offsets[vertex + 1];
+      uint64_t found = 0;
+      for (const auto *it = vertex_begin; it != vertex_end; ++it) {
+        const auto neighbour = *it;
+        const auto *first = vertex_begin;
+        const auto *second = neighbours.data() + offsets[neighbour];
+        const auto *second_end = neighbours.data() + offsets[neighbour + 1];
+        uint64_t common = 0;
+        while (first != vertex_end && second != second_end) {
+          if (*first < *second) {
+            ++first;
+          } else if (*second < *first) {
+            ++second;
+          } else {
+            triangles[*first].fetch_add(1, std::memory_order_relaxed);
+            ++common;
+            ++first;
+            ++second;
+          }
+        }
+        if (common > 0) triangles[neighbour].fetch_add(common, std::memory_order_relaxed);
+        found += common;
+      }
+      if (found > 0) triangles[vertex].fetch_add(found, std::memory_order_relaxed);
+    }
+  });
+
+  std::vector<uint64_t> result(order);
+  for (uint32_t vertex = 0; vertex < order; ++vertex) result[vertex] = triangles[vertex].load(std::memory_order_relaxed);
+  return result;
+}
+
+// Relationships of a single type with their weights, in CSR form in both directions. Undirected graphs store every
+// relationship in both directions, so the outgoing and incoming lists are the same.
+struct WeightedGraph {
+  std::vector<int64_t> ids;
+  std::unordered_map<int64_t, uint32_t> index;
+  std::vector<uint64_t> out_offsets;
+  std::vector<std::pair<uint32_t, double>> out_edges;
+  std::vector<uint64_t> in_offsets;
+  std::vector<std::pair<uint32_t, double>> in_edges;
+
+  uint32_t Order() const { return static_cast<uint32_t>(ids.size()); }
+};
+
+double RelationshipWeight(const mgp::Relationship &relationship, const std::string &weight_property) {
+  const auto weight = relationship.GetProperty(weight_property);
+  if (!weight.IsNumeric()) {
+    throw std::invalid_argument("Relationships must have a numeric '" + weight_property + "' property.");
+  }
+  const auto value = weight.ValueNumeric();
+  if (!(value >= 0)) throw std::invalid_argument("Relationship weights must not be negative.");
+  return value;
+}
+
+void FillWeightedAdjacency(uint32_t order, const std::vector<uint32_t> &from, const std::vector<uint32_t> &to,
+                           const std::vector<double> &weights, std::vector<uint64_t> &offsets,
+                           std::vector<std::pair<uint32_t, double>> &edges) {
+  offsets.assign(order + 1, 0);
+  for (const auto vertex : from) ++offsets[vertex + 1];
+  std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+  edges.resize(from.size());
+  std::vector<uint64_t> position(offsets.begin(), offsets.end() - 1);
+  for (size_t i = 0; i < from.size(); ++i) edges[position[from[i]]++] = {to[i], weights[i]};
+}
+
+WeightedGraph BuildWeightedGraph(const mgp::Graph &graph, std::string_view edge_type,
+                                 const std::string &weight_property, bool directed) {
+  WeightedGraph weighted;
+  for (const auto node : graph.Nodes()) {
+    if (weighted.ids.size() == std::numeric_limits<uint32_t>::max()) {
+      throw std::length_error("The graph has too many nodes.");
+    }
+    weighted.index.emplace(node.Id().AsInt(), static_cast<uint32_t>(weighted.ids.size()));
+    weighted.ids.push_back(node.Id().AsInt());
+  }
+
+  std::vector<uint32_t> from;
+  std::vector<uint32_t> to;
+  std::vector<double> weights;
+  for (const auto relationship : graph.Relationships()) {
+    if (relationship.Type() != edge_type) continue;
+    const auto weight = RelationshipWeight(relationship, weight_property);
+    const auto from_vertex = weighted.index.at(relationship.From().Id().AsInt());
+    const auto to_vertex = weighted.index.at(relationship.To().Id().AsInt());
+    from.push_back(from_vertex);
+    to.push_back(to_vertex);
+    weights.push_back(weight);
+    if (!directed) {
+      from.push_back(to_vertex);
+      to.push_back(from_vertex);
+      weights.push_back(weight);
+    }
+  }
+
+  FillWeightedAdjacency(weighted.Order(), from, to, weights, weighted.out_offsets, weighted.out_edges);
+  FillWeightedAdjacency(weighted.Order(), to, from, weights, weighted.in_offsets, weighted.in_edges);
+  return weighted;
+}
+
+constexpr auto kInfinity = std::numeric_limits<double>::infinity();
+
+// Single-source Dijkstra over the outgoing relationships, or over the incoming ones for the distances to `source`.
+void DistancesKernel(const WeightedGraph &graph, uint32_t source, bool reverse, std::span<double> distance) {
+  const auto &offsets = reverse ? graph.in_offsets : graph.out_offsets;
+  const auto &edges = reverse ? graph.in_edges : graph.out_edges;
+  std::fill(distance.begin(), distance.end(), kInfinity);
+  std::priority_queue<std::pair<double, uint32_t>, std::vector<std::pair<double, uint32_t>>, std::greater<>> queue;
+  distance[source] = 0;
+  queue.emplace(0, source);
+  while (!queue.empty()) {
+    const auto [vertex_distance, vertex] = queue.top();
+    queue.pop();
+    if (vertex_distance > distance[vertex]) continue;
+    for (auto edge = offsets[vertex]; edge < offsets[vertex + 1]; ++edge) {
+      const auto [neighbour, weight] = edges[edge];
+      if (vertex_distance + weight < distance[neighbour]) {
+        distance[neighbour] = vertex_distance + weight;
+        queue.emplace(distance[neighbour], neighbour);
+      }
+    }
+  }
+}
+
+// Distances from and to a few landmark nodes. By the triangle inequality they give a lower bound on the distance
+// between any two nodes, which serves as the A* heuristic (ALT). The distances are a snapshot of the graph at the time
+// of the build.
+struct LandmarkIndex {
+  std::unordered_map<int64_t, uint32_t> index;
+  uint32_t order{0};
+  uint32_t landmarks{0};
+  // d(landmark, node) and d(node, landmark), landmark-major. The latter is empty for undirected graphs.
+  std::vector<double> from_landmark;
+  std::vector<double> to_landmark;
+
+  // Lower bound on the distance from `from` to `to`, 0 if either of them isn't known to the index.
+  double LowerBound(int64_t from, int64_t to) const {
+    const auto from_it = index.find(from);
+    const auto to_it = index.find(to);
+    if (from_it == index.end() || to_it == index.end()) return 0;
+    const auto &to_distances = to_landmark.empty() ? from_landmark : to_landmark;
+    double bound = 0;
+    for (uint64_t landmark = 0; landmark < landmarks; ++landmark) {
+      const auto *from_distances = from_landmark.data() + landmark * order;
+      const auto *distances_to = to_distances.data() + landmark * order;
+      // d(L, to) <= d(L, from) + d(from, to)
+      if (from_distances[to_it->second] != kInfinity && from_distances[from_it->second] != kInfinity) {
+        bound = std::max(bound, from_distances[to_it->second] - from_distances[from_it->second]);
+      }
+      // d(from, L) <= d(from, to) + d(to, L)
+      if (distances_to[from_it->second] != kInfinity && distances_to[to_it->second] != kInfinity) {
+        bound = std::max(bound, distances_to[from_it->second] - distances_to[to_it->second]);
+      }
+    }
+    return bound;
+  }
+};
+
+// Landmarks are picked farthest-first: the next one is the node farthest from the landmarks picked so far, which
+// spreads them over the periphery of the graph where they give the tightest bounds. Nodes that none of the landmarks
+// reach count as the farthest, so every part of the graph gets a landmark as long as there are enough of them.
+LandmarkIndex LandmarkIndexKernel(const WeightedGraph &graph, int64_t landmarks, bool directed) {
+  LandmarkIndex index;
+  index.order = graph.Order();
+  index.landmarks = static_cast<uint32_t>(std::min<int64_t>(landmarks, index.order));
+  if (index.landmarks == 0) return index;
+  index.from_landmark.resize(static_cast<uint64_t>(index.landmarks) * index.order);
+
+  std::vector<uint32_t> selected;
+  std::vector<double> nearest(index.order, kInfinity);
+  // The node farthest from an arbitrary one is a good first landmark
+  std::vector<double> start_distance(index.order);
+  DistancesKernel(graph, 0, false, start_distance);
+  std::replace(start_distance.begin(), start_distance.end(), kInfinity, -1.0);
+  auto farthest = [&](std::span<const double> distance) {
+    uint32_t best = 0;
+    for (uint32_t vertex = 1; vertex < index.order; ++vertex) {
+      if (distance[vertex] > distance[best]) best = vertex;
+    }
+    return best;
+  };
+  auto next = farthest(start_distance);
+  for (uint32_t landmark = 0; landmark < index.landmarks; ++landmark) {
+    selected.push_back(next);
+    std::span<double> distance{index.from_landmark.data() + static_cast<uint64_t>(landmark) * index.order,
+                               index.order};
+    DistancesKernel(graph, next, false, distance);
+    for (uint32_t vertex = 0; vertex < index.order; ++vertex) {
+      nearest[vertex] = std::min(nearest[vertex], distance[vertex]);
+    }
+    for (const auto chosen : selected) nearest[chosen] = -1;
+    next = farthest(nearest);
+  }
+
+  if (directed) {
+    index.to_landmark.resize(index.from_landmark.size());
+    ParallelFor(
+        selected.size(),
+        [&](unsigned, uint64_t begin, uint64_t end) {
+          for (auto landmark = begin; landmark < end; ++landmark) {
+            DistancesKernel(graph, selected[landmark], true,
+                            {index.to_landmark.data() + landmark * index.order, index.order});
+          }
+        },
+        1);
+  }
+
+  index.index = graph.index;
+  return index;
+}
+
+// Built landmark indices, per (database, relationship type, weight property, directed). The entries of a database are
+// dropped together with it.
+using LandmarkIndexKey = std::tuple<std::string, std::string, std::string, bool>;
+std::mutex landmark_indices_lock;
+std::map<LandmarkIndexKey, std::shared_ptr<const LandmarkIndex>> landmark_indices;
+
+LandmarkIndexKey MakeLandmarkIndexKey(const mgp::Graph &graph, std::string_view edge_type,
+                                      const std::string &weight_property, bool directed) {
+  return {std::string(graph.DatabaseName()), std::string(edge_type), weight_property, directed};
+}
+
+std::shared_ptr<const LandmarkIndex> FindLandmarkIndex(const LandmarkIndexKey &key) {
+  const std::lock_guard guard(landmark_indices_lock);
+  const auto it = landmark_indices.find(key);
+  return it == landmark_indices.end() ? nullptr : it->second;
+}
+
+// Thrown when the landmark distances no longer give a lower bound for the current graph.
+struct StaleLandmarks : std::exception {};
+
+struct ShortestPath {
+  std::vector<mgp::Relationship> relationships;
+  double total_weight{0};
+  int64_t settled{0};
+};
+
+// Point-to-point Dijkstra on the live graph, reading nodes through the API only as they are settled. With a landmark
+// index the relationship weights are reduced by a potential built from the landmark lower bounds, which turns it into
+// A* and steers the search towards the target. The bidirectional variant uses the average of the forward and reverse
+// potentials so both searches see the same reduced weights.
+class ShortestPathSearch {
+ public:
+  ShortestPathSearch(std::string_view edge_type, std::string weight_property, bool directed,
+                     const LandmarkIndex *landmarks)
+      : edge_type_(edge_type),
+        weight_property_(std::move(weight_property)),
+        directed_(directed),
+        landmarks_(landmarks) {}
+
+  std::optional<ShortestPath> Run(const mgp::Node &source, const mgp::Node &target, bool bidirectional) {
+    source_ = source.Id().AsInt();
+    target_ = target.Id().AsInt();
+    bidirectional_ = bidirectional;
+    ShortestPath result;
+    if (source_ == target_) return result;
+
+    directions_[0] = Direction{};
+    directions_[1] = Direction{};
+    directions_[1].reverse = true;
+    Push(directions_[0], source, 0, std::nullopt, source_);
+    if (bidirectional_) Push(directions_[1], target, 0, std::nullopt, target_);
+
+    std::optional<int64_t> meeting;
+    double best = kInfinity;
+    while (true) {
+      auto &forward = directions_[0];
+      auto &reverse = directions_[1];
+      if (!bidirectional_) {
+        if (forward.queue.empty()) return std::nullopt;
+      } else {
+        if (forward.queue.empty() || reverse.queue.empty()) break;
+        // Every path found later is at least as long as the sum of the smallest keys in reduced weights
+        if (forward.queue.top().key + reverse.queue.top().key >= best + Potential(target_) - Potential(source_)) break;
+      }
+      auto &direction = !bidirectional_ || forward.queue.top().key <= reverse.queue.top().key ? forward : reverse;
+      auto entry = direction.queue.top();
+      direction.queue.pop();
+      const auto id = entry.node.Id().AsInt();
+      if (direction.settled.contains(id)) continue;
+      direction.settled.insert(id);
+      ++result.settled;
+      if (!bidirectional_ && id == target_) {
+        meeting = id;
+        best = direction.distance.at(id);
+        break;
+      }
+      Expand(direction, entry.node, [&](int64_t neighbour) {
+        auto &other = directions_[direction.reverse ? 0 : 1];
+        if (!bidirectional_) return;
+        const auto other_it = other.distance.find(neighbour);
+        if (other_it == other.distance.end()) return;
+        const auto length = direction.distance.at(neighbour) + other_it->second;
+        if (length < best) {
+          best = length;
+          meeting = neighbour;
+        }
+      });
+    }
+    if (!meeting) return std::nullopt;
+
+    // Relationships from the source to the meeting node, then on to the target
+    for (auto node = *meeting; node != source_;) {
+      const auto &[previous, relationship] = directions_[0].parent.at(node);
+      result.relationships.push_back(relationship);
+      node = previous;
+    }
+    std::reverse(result.relationships.begin(), result.relationships.end());
+    if (bidirectional_) {
+      for (auto node = *meeting; node != target_;) {
+        const auto &[next, relationship] = directions_[1].parent.at(node);
+        result.relationships.push_back(relationship);
+        node = next;
+      }
+    }
+    result.total_weight = best;
+    return result;
+  }
+
+ private:
+  struct QueueEntry {
+    double key;
+    mgp::Node node;
+    bool operator>(const QueueEntry &other) const { return key > other.key; }
+  };
+
+  struct Direction {
+    bool reverse{false};
+    std::priority_queue<QueueEntry, std::vector<QueueEntry>, std::greater<>> queue;
+    std::unordered_map<int64_t, double> distance;
+    std::unordered_map<int64_t, std::pair<int64_t, mgp::Relationship>> parent;
+    std::unordered_set<int64_t> settled;
+  };
+
+  // Potential of the forward search, the reverse search uses its negation
+  double Potential(int64_t node) {
+    if (!landmarks_) return 0;
+    auto [it, inserted] = potentials_.try_emplace(node, 0);
+    if (inserted) {
+      it->second = bidirectional_
+                       ? (landmarks_->LowerBound(node, target_) - landmarks_->LowerBound(source_, node)) / 2
+                       : landmarks_->LowerBound(node, target_);
+    }
+    return it->second;
+  }
+
+  // Key of the node in the priority queue, its distance from where the direction started in reduced weights
+  double Key(const Direction &direction, int64_t node, double distance) {
+    return direction.reverse ? distance - Potential(node) + Potential(target_)
+                             : distance + Potential(node) - Potential(source_);
+  }
+
+  void Push(Direction &direction, const mgp::Node &node, double distance,
+            std::optional<std::pair<int64_t, mgp::Relationship>> parent, int64_t id) {
+    direction.distance.insert_or_assign(id, distance);
+    if (parent) direction.parent.insert_or_assign(id, std::move(*parent));
+    direction.queue.push({Key(direction, id, distance), node});
+  }
+
+  template <typename TOnRelax>
+  void Expand(Direction &direction, const mgp::Node &node, const TOnRelax &on_relax) {
+    const auto id = node.Id().AsInt();
+    const auto node_distance = direction.distance.at(id);
+    auto relax = [&](const mgp::Relationship &relationship, const mgp::Node &neighbour) {
+      if (relationship.Type() != edge_type_) return;
+      const auto neighbour_id = neighbour.Id().AsInt();
+      if (direction.settled.contains(neighbour_id)) return;
+      const auto weight = RelationshipWeight(relationship, weight_property_);
+      // The reduced weight of a relationship must not be negative, otherwise the landmark distances don't match the
+      // graph anymore and the search could miss the shortest path
+      const auto from = direction.reverse ? neighbour_id : id;
+      const auto to = direction.reverse ? id : neighbour_id;
+      if (weight + Potential(to) - Potential(from) < -1e-9 * std::max(1.0, weight)) throw StaleLandmarks{};
+
+      const auto distance = node_distance + weight;
+      const auto it = direction.distance.find(neighbour_id);
+      if (it != direction.distance.end() && it->second <= distance) return;
+      Push(direction, neighbour, distance, std::make_pair(id, relationship), neighbour_id);
+      on_relax(neighbour_id);
+    };
+    const bool outgoing = !direction.reverse || !directed_;
+    const bool incoming = direction.reverse || !directed_;
+    if (outgoing) {
+      for (const auto relationship : node.OutRelationships()) relax(relationship, relationship.To());
+    }
+    if (incoming) {
+      for (const auto relationship : node.InRelationships()) relax(relationship, relationship.From());
+    }
+  }
+
+  std::string_view edge_type_;
+  std::string weight_property_;
+  bool directed_;
+  const LandmarkIndex *landmarks_;
+  bool bidirectional_{false};
+  int64_t source_{0};
+  int64_t target_{0};
+  std::array<Direction, 2> directions_;
+  std::unordered_map<int64_t, double> potentials_;
+};
+
+template <typename TValue>
+void InsertResults(const mgp::RecordFactory &record_factory, const mgp::Graph &graph, const CompactGraph &compact,
+                   std::string_view field_name, const std::vector<TValue> &values) {
+  for (uint32_t vertex = 0; vertex < compact.Order(); ++vertex) {
+    auto record = record_factory.NewRecord();
+    record.Insert(GraphAlgorithms::kReturnNode.data(), graph.GetNodeById(mgp::Id::FromInt(compact.ids[vertex])));
+    if constexpr (std::is_floating_point_v<TValue>) {
+      record.Insert(field_name.data(), static_cast<double>(values[vertex]));
+    } else {
+      record.Insert(field_name.data(), static_cast<int64_t>(values[vertex]));
+    }
+  }
+}
+
+}  // namespace
+
+void GraphAlgorithms::PageRank(mgp_list *args, mgp_graph *memgraph_graph, mgp_result *result, mgp_memory *memory) {
+  mgp::MemoryDispatcherGuard guard{memory};
+  const auto record_factory = mgp::RecordFactory(result);
+  auto arguments = mgp::List(args);
+
+  try {
+    const auto max_iterations = arguments[0].ValueInt();
+    const auto damping_factor = arguments[1].ValueDouble();
+    const auto stop_epsilon = arguments[2].ValueDouble();
+    if (max_iterations < 0) throw std::invalid_argument("max_iterations must not be negative.");
+    if (damping_factor < 0 || damping_factor > 1) throw std::invalid_argument("damping_factor must be in [0, 1].");
+
+    const auto graph = mgp::Graph(memgraph_graph);
+    const auto compact = BuildCompactGraph(graph);
+    InsertResults(record_factory, graph, compact, kReturnRank,
+                  PageRankKernel(compact, max_iterations, damping_factor, stop_epsilon));
+  } catch (const std::exception &e) {
+    record_factory.SetErrorMessage(e.what());
+  }
+}
+
+void GraphAlgorithms::WeaklyConnectedComponents(mgp_list * /*args*/, mgp_graph *memgraph_graph, mgp_result *result,
+                                                mgp_memory *memory) {
+  mgp::MemoryDispatcherGuard guard{memory};
+  const auto record_factory = mgp::RecordFactory(result);
+
+  try {
+    const auto graph = mgp::Graph(memgraph_graph);
+    const auto compact = BuildCompactGraph(graph);
+    InsertResults(record_factory, graph, compact, kReturnComponentId, WeaklyConnectedComponentsKernel(compact));
+  } catch (const std::exception &e) {
+    record_factory.SetErrorMessage(e.what());
+  }
+}
+
+void GraphAlgorithms::StronglyConnectedComponents(mgp_list * /*args*/, mgp_graph *memgraph_graph, mgp_result *result,
+                                                  mgp_memory *memory) {
+  mgp::MemoryDispatcherGuard guard{memory};
+  const auto record_factory = mgp::RecordFactory(result);
+
+  try {
+    const auto graph = mgp::Graph(memgraph_graph);
+    const auto compact = BuildCompactGraph(graph);
+    InsertResults(record_factory, graph, compact, kReturnComponentId, StronglyConnectedComponentsKernel(compact));
+  } catch (const std::exception &e) {
+    record_factory.SetErrorMessage(e.what());
+  }
+}
+
+void GraphAlgorithms::LabelPropagation(mgp_list *args, mgp_graph *memgraph_graph, mgp_result *result,
+                                       mgp_memory *memory) {
+  mgp::MemoryDispatcherGuard guard{memory};
+  const auto record_factory = mgp::RecordFactory(result);
+  auto arguments = mgp::List(args);
+
+  try {
+    const auto max_iterations = arguments[0].ValueInt();
+    if (max_iterations < 0) throw std::invalid_argument("max_iterations must not be negative.");
+
+    const auto graph = mgp::Graph(memgraph_graph);
+    const auto compact = BuildCompactGraph(graph);
+    InsertResults(record_factory, graph, compact, kReturnCommunityId, LabelPropagationKernel(compact, max_iterations));
+  } catch (const std::exception &e) {
+    record_factory.SetErrorMessage(e.what());
+  }
+}
+
+void GraphAlgorithms::BetweennessCentrality(mgp_list *args, mgp_graph *memgraph_graph, mgp_result *result,
+                                            mgp_memory *memory) {
+  mgp::MemoryDispatcherGuard guard{memory};
+  const auto record_factory = mgp::RecordFactory(result);
+  auto arguments = mgp::List(args);
+
+  try {
+    const auto directed = arguments[0].ValueBool();
+    const auto normalized = arguments[1].ValueBool();
+    const auto samples = arguments[2].ValueInt();
+    const auto seed = arguments[3].ValueInt();
+    if (samples < 0) throw std::invalid_argument("samples must not be negative.");
+
+    const auto graph = mgp::Graph(memgraph_graph);
+    const auto compact = BuildCompactGraph(graph);
+    InsertResults(record_factory, graph, compact, kReturnBetweennessCentrality,
+                  BetweennessCentralityKernel(compact, directed, samples, seed, normalized));
+  } catch (const std::exception &e) {
+    record_factory.SetErrorMessage(e.what());
+  }
+}
+
+void GraphAlgorithms::KCore(mgp_list *args, mgp_graph *memgraph_graph, mgp_result *result, mgp_memory *memory) {
+  mgp::MemoryDispatcherGuard guard{memory};
+  const auto record_factory = mgp::RecordFactory(result);
+  auto arguments = mgp::List(args);
+
+  try {
+    const auto k = arguments[0].ValueInt();
+    if (k < 0) throw std::invalid_argument("k must not be negative.");
+
+    const auto graph = mgp::Graph(memgraph_graph);
+    const auto compact = BuildCompactGraph(graph);
+    const auto core = KCoreKernel(compact);
+    for (uint32_t vertex = 0; vertex < compact.Order(); ++vertex) {
+      if (core[vertex] < static_cast<uint64_t>(k)) continue;
+      auto record = record_factory.NewRecord();
+      record.Insert(kReturnNode.data(), graph.GetNodeById(mgp::Id::FromInt(compact.ids[vertex])));
+      record.Insert(kReturnCore.data(), static_cast<int64_t>(core[vertex]));
+    }
+  } catch (const std::exception &e) {
+    record_factory.SetErrorMessage(e.what());
+  }
+}
+
+void GraphAlgorithms::TriangleCount(mgp_list * /*args*/, mgp_graph *memgraph_graph, mgp_result *result,
+                                    mgp_memory *memory) {
+  mgp::MemoryDispatcherGuard guard{memory};
+  const auto record_factory = mgp::RecordFactory(result);
+
+  try {
+    const auto graph = mgp::Graph(memgraph_graph);
+    const auto compact = BuildCompactGraph(graph);
+    InsertResults(record_factory, graph, compact, kReturnTriangles, TriangleCountKernel(compact));
+  } catch (const std::exception &e) {
+    record_factory.SetErrorMessage(e.what());
+  }
+}
+
+void GraphAlgorithms::BuildLandmarks(mgp_list *args, mgp_graph *memgraph_graph, mgp_result *result,
+                                     mgp_memory *memory) {
+  mgp::MemoryDispatcherGuard guard{memory};
+  const auto record_factory = mgp::RecordFactory(result);
+  auto arguments = mgp::List(args);
+
+  try {
+    const auto edge_type = arguments[0].ValueString();
+    const auto weight_property = std::string(arguments[1].ValueString());
+    const auto landmarks = arguments[2].ValueInt();
+    const auto directed = arguments[3].ValueBool();
+    if (landmarks < 0) throw std::invalid_argument("landmarks must not be negative.");
+
+    const auto graph = mgp::Graph(memgraph_graph);
+    const auto weighted = BuildWeightedGraph(graph, edge_type, weight_property, directed);
+    auto index = std::make_shared<const LandmarkIndex>(LandmarkIndexKernel(weighted, landmarks, directed));
+    {
+      const std::lock_guard lock(landmark_indices_lock);
+      landmark_indices.insert_or_assign(MakeLandmarkIndexKey(graph, edge_type, weight_property, directed), index);
+    }
+
+    auto record = record_factory.NewRecord();
+    record.Insert(kReturnLandmarks.data(), static_cast<int64_t>(index->landmarks));
+    record.Insert(kReturnNodes.data(), static_cast<int64_t>(index->order));
+  } catch (const std::exception &e) {
+    record_factory.SetErrorMessage(e.what());
+  }
+}
+
+void GraphAlgorithms::WeightedShortestPath(mgp_list *args, mgp_graph *memgraph_graph, mgp_result *result,
+                                           mgp_memory *memory) {
+  mgp::MemoryDispatcherGuard guard{memory};
+  const auto record_factory = mgp::RecordFactory(result);
+  auto arguments = mgp::List(args);
+
+  try {
+    const auto source = arguments[0].ValueNode();
+    const auto target = arguments[1].ValueNode();
+    const auto edge_type = arguments[2].ValueString();
+    const auto weight_property = std::string(arguments[3].ValueString());
+    const auto directed = arguments[4].ValueBool();
+    const auto bidirectional = arguments[5].ValueBool();
+
+    // The landmark distances are a snapshot, if the graph changed since they were built in a way that breaks the lower
+    // bounds the search falls back to plain Dijkstra
+    const auto landmarks =
+        FindLandmarkIndex(MakeLandmarkIndexKey(mgp::Graph(memgraph_graph), edge_type, weight_property, directed));
+    auto search = [&](const LandmarkIndex *index) {
+      return ShortestPathSearch(edge_type, weight_property, directed, index).Run(source, target, bidirectional);
+    };
+    std::optional<ShortestPath> path;
+    try {
+      path = search(landmarks.get());
+    } catch (const StaleLandmarks &) {
+      path = search(nullptr);
+    }
+    if (!path) return;
+
+    auto found = mgp::Path(source);
+    for (const auto &relationship : path->relationships) found.Expand(relationship);
+    auto record = record_factory.NewRecord();
+    record.Insert(kReturnPath.data(), found);
+    record.Insert(kReturnTotalWeight.data(), path->total_weight);
+    record.Insert(kReturnSettled.data(), path->settled);
+  } catch (const std::exception &e) {
+    record_factory.SetErrorMessage(e.what());
+  }
+}
+
+extern "C" int mgp_init_module(struct mgp_module *query_module, struct mgp_memory *memory) {
+  try {
+    mgp::MemoryDispatcherGuard guard{memory};
+
+    AddProcedure(GraphAlgorithms::PageRank, GraphAlgorithms::kProcedurePageRank, mgp::ProcedureType::Read,
+                 {
+                     mgp::Parameter(GraphAlgorithms::kParameterMaxIterations, mgp::Type::Int, int64_t{100}),
+                     mgp::Parameter(GraphAlgorithms::kParameterDampingFactor, mgp::Type::Double, 0.85),
+                     mgp::Parameter(GraphAlgorithms::kParameterStopEpsilon, mgp::Type::Double, 1e-5),
+                 },
+                 {
+                     mgp::Return(GraphAlgorithms::kReturnNode, mgp::Type::Node),
+                     mgp::Return(GraphAlgorithms::kReturnRank, mgp::Type::Double),
+                 },
+                 query_module, memory);
+
+    AddProcedure(GraphAlgorithms::WeaklyConnectedComponents, GraphAlgorithms::kProcedureWeaklyConnectedComponents,
+                 mgp::ProcedureType::Read, {},
+                 {
+                     mgp::Return(GraphAlgorithms::kReturnNode, mgp::Type::Node),
+                     mgp::Return(GraphAlgorithms::kReturnComponentId, mgp::Type::Int),
+                 },
+                 query_module, memory);
+
+    AddProcedure(GraphAlgorithms::StronglyConnectedComponents, GraphAlgorithms::kProcedureStronglyConnectedComponents,
+                 mgp::ProcedureType::Read, {},
+                 {
+                     mgp::Return(GraphAlgorithms::kReturnNode, mgp::Type::Node),
+                     mgp::Return(GraphAlgorithms::kReturnComponentId, mgp::Type::Int),
+                 },
+                 query_module, memory);
+
+    AddProcedure(GraphAlgorithms::LabelPropagation, GraphAlgorithms::kProcedureLabelPropagation,
+                 mgp::ProcedureType::Read,
+                 {mgp::Parameter(GraphAlgorithms::kParameterMaxIterations, mgp::Type::Int, int64_t{10})},
+                 {
+                     mgp::Return(GraphAlgorithms::kReturnNode, mgp::Type::Node),
+                     mgp::Return(GraphAlgorithms::kReturnCommunityId, mgp::Type::Int),
+                 },
+                 query_module, memory);
+
+    AddProcedure(GraphAlgorithms::BetweennessCentrality, GraphAlgorithms::kProcedureBetweennessCentrality,
+                 mgp::ProcedureType::Read,
+                 {
+                     mgp::Parameter(GraphAlgorithms::kParameterDirected, mgp::Type::Bool, true),
+                     mgp::Parameter(GraphAlgorithms::kParameterNormalized, mgp::Type::Bool, true),
+                     mgp::Parameter(GraphAlgorithms::kParameterSamples, mgp::Type::Int, int64_t{0}),
+                     mgp::Parameter(GraphAlgorithms::kParameterSeed, mgp::Type::Int, int64_t{0}),
+                 },
+                 {
+                     mgp::Return(GraphAlgorithms::kReturnNode, mgp::Type::Node),
+                     mgp::Return(GraphAlgorithms::kReturnBetweennessCentrality, mgp::Type::Double),
+                 },
+                 query_module, memory);
+
+    AddProcedure(GraphAlgorithms::KCore, GraphAlgorithms::kProcedureKCore, mgp::ProcedureType::Read,
+                 {mgp::Parameter(GraphAlgorithms::kParameterK, mgp::Type::Int, int64_t{0})},
+                 {
+                     mgp::Return(GraphAlgorithms::kReturnNode, mgp::Type::Node),
+                     mgp::Return(GraphAlgorithms::kReturnCore, mgp::Type::Int),
+                 },
+                 query_module, memory);
+
+    AddProcedure(GraphAlgorithms::TriangleCount, GraphAlgorithms::kProcedureTriangleCount, mgp::ProcedureType::Read,
+                 {},
+                 {
+                     mgp::Return(GraphAlgorithms::kReturnNode, mgp::Type::Node),
+                     mgp::Return(GraphAlgorithms::kReturnTriangles, mgp::Type::Int),
+                 },
+                 query_module, memory);
+
+    AddProcedure(GraphAlgorithms::BuildLandmarks, GraphAlgorithms::kProcedureBuildLandmarks, mgp::ProcedureType::Read,
+                 {
+                     mgp::Parameter(GraphAlgorithms::kParameterEdgeType, mgp::Type::String),
+                     mgp::Parameter(GraphAlgorithms::kParameterWeightProperty, mgp::Type::String, "weight"),
+                     mgp::Parameter(GraphAlgorithms::kParameterLandmarks, mgp::Type::Int, int64_t{16}),
+                     mgp::Parameter(GraphAlgorithms::kParameterDirected, mgp::Type::Bool, true),
+                 },
+                 {
+                     mgp::Return(GraphAlgorithms::kReturnLandmarks, mgp::Type::Int),
+                     mgp::Return(GraphAlgorithms::kReturnNodes, mgp::Type::Int),
+                 },
+                 query_module, memory);
+
+    AddProcedure(GraphAlgorithms::WeightedShortestPath, GraphAlgorithms::kProcedureWeightedShortestPath,
+                 mgp::ProcedureType::Read,
+                 {
+                     mgp::Parameter(GraphAlgorithms::kParameterSource, mgp::Type::Node),
+                     mgp::Parameter(GraphAlgorithms::kParameterTarget, mgp::Type::Node),
+                     mgp::Parameter(GraphAlgorithms::kParameterEdgeType, mgp::Type::String),
+                     mgp::Parameter(GraphAlgorithms::kParameterWeightProperty, mgp::Type::String, "weight"),
+                     mgp::Parameter(GraphAlgorithms::kParameterDirected, mgp::Type::Bool, true),
+                     mgp::Parameter(GraphAlgorithms::kParameterBidirectional, mgp::Type::Bool, false),
+                 },
+                 {
+                     mgp::Return(GraphAlgorithms::kReturnPath, mgp::Type::Path),
+                     mgp::Return(GraphAlgorithms::kReturnTotalWeight, mgp::Type::Double),
+                     mgp::Return(GraphAlgorithms::kReturnSettled, mgp::Type::Int),
+                 },
+                 query_module, memory);
+  } catch (const std::exception &e) {
+    std::cerr << "Error while initializing query module: " << e.what() << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
+
+extern "C" int mgp_on_database_drop(const char *database_name) {
+  const std::lock_guard guard(landmark_indices_lock);
+  std::erase_if(landmark_indices, [&](const auto &entry) { return std::get<0>(entry.first) == database_name; });
+  return 0;
+}
+
+extern "C" int mgp_shutdown_module() {
+  const std::lock_guard guard(landmark_indices_lock);
+  landmark_indices.clear();
+  return 0;
+}
@@ -252,9 +252,12 @@ auto ParseJson(std::string_view str) {
 };  // namespace
 
 Auth::Auth(std::string storage_directory, Config config)
-    : storage_(std::move(storage_directory)), config_{std::move(config)} {
+    : storage_(std::move(storage_directory)),
+      config_{std::move(config)},
+      credential_cache_{FLAGS_auth_credential_cache_size, std::chrono::seconds(FLAGS_auth_credential_cache_ttl_sec)} {
   modules_ = PopulateModules(FLAGS_auth_module_mappings);
   MigrateVersions(storage_);
+  published_state_->access_controlled_.store(AccessControlled(), std::memory_order_release);
 }
 
 std::optional<UserOrRole> Auth::CallExternalModule(const std::string &scheme, const nlohmann::json &module_params,
@@ -346,6 +349,9 @@ std::optional<UserOrRole> Auth::Authenticate(const std::string &username, const
     /*
      * LOCAL AUTH STORAGE
      */
+    if (auto cached_user = credential_cache_.Find(username, password)) {
+      return std::move(*cached_user);
+    }
     auto user = GetUser(username);
     if (!user) {
       spdlog::warn(utils::MessageWithLink("Couldn't authenticate user '{}' because the user doesn't exist.", username,
@@ -360,6 +366,7 @@ std::optional<UserOrRole> Auth::Authenticate(const std::string &username, const
     if (user->UpgradeHash(password)) {
       SaveUser(*user);
     }
+    credential_cache_.Insert(username, password, *user);
 
     return user;
   }
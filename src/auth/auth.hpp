@@ -8,11 +8,14 @@
 
 #pragma once
 
+#include <atomic>
+#include <memory>
 #include <mutex>
 #include <optional>
 #include <regex>
 #include <vector>
 
+#include "auth/credential_cache.hpp"
 #include "auth/exceptions.hpp"
 #include "auth/models.hpp"
 #include "auth/module.hpp"
@@ -87,6 +90,22 @@ class Auth final {
 
   static const Epoch kStartEpoch;
 
+  /**
+   * The part of the Auth state that can be read without holding the lock
+   * around the Auth. It is updated together with the epoch, i.e. whenever a
+   * user or a role changes, and lives as long as the Auth does.
+   */
+  class PublishedState {
+   public:
+    Epoch GetEpoch() const { return epoch_.load(std::memory_order_acquire); }
+    bool AccessControlled() const { return access_controlled_.load(std::memory_order_acquire); }
+
+   private:
+    friend class Auth;
+    std::atomic<Epoch> epoch_{kStartEpoch};
+    std::atomic<bool> access_controlled_{false};
+  };
+
   enum class Result {
     SUCCESS,
     NO_USER_ROLE,
@@ -391,6 +410,8 @@ class Auth final {
     return res;
   }
 
+  const PublishedState *GetPublishedState() const { return published_state_.get(); }
+
  private:
   /**
    * @brief
@@ -401,7 +422,12 @@ class Auth final {
    */
   bool NameRegexMatch(const std::string &user_or_role) const;
 
-  void UpdateEpoch() { ++epoch_; }
+  void UpdateEpoch() {
+    ++epoch_;
+    credential_cache_.Clear();
+    published_state_->access_controlled_.store(AccessControlled(), std::memory_order_release);
+    published_state_->epoch_.store(epoch_, std::memory_order_release);
+  }
 
   /**
    * Returns whether the prerequisites for authentication aided by external module are met:
@@ -439,5 +465,7 @@ class Auth final {
   std::unordered_map<std::string, auth::Module> modules_;
   Config config_;
   Epoch epoch_{kStartEpoch};
+  std::unique_ptr<PublishedState> published_state_{std::make_unique<PublishedState>()};
+  CredentialCache credential_cache_;
 };
 }  // namespace memgraph::auth
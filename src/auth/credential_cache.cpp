@@ -0,0 +1,75 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include "auth/credential_cache.hpp"
+
+#include <algorithm>
+
+#include <openssl/evp.h>
+#include <openssl/hmac.h>
+#include <openssl/rand.h>
+
+#include "auth/exceptions.hpp"
+
+namespace memgraph::auth {
+
+CredentialCache::CredentialCache(size_t capacity, std::chrono::seconds ttl) : capacity_(capacity), ttl_(ttl) {
+  if (capacity_ == 0) return;
+  if (RAND_bytes(key_.data(), static_cast<int>(key_.size())) != 1) {
+    throw AuthException("Couldn't generate the key for the credential cache!");
+  }
+}
+
+std::string CredentialCache::Key(const std::string &username, const std::string &password) const {
+  // The username length is part of the message so that the split between the username and password is unambiguous
+  auto message = std::to_string(username.size());
+  message += ':';
+  message += username;
+  message += password;
+
+  std::string digest(EVP_MAX_MD_SIZE, '\0');
+  unsigned int digest_size = 0;
+  if (HMAC(EVP_sha256(), key_.data(), static_cast<int>(key_.size()),
+           reinterpret_cast<const unsigned char *>(message.data()), message.size(),
+           reinterpret_cast<unsigned char *>(digest.data()), &digest_size) == nullptr) {
+    throw AuthException("Couldn't compute the credential cache key!");
+  }
+  digest.resize(digest_size);
+  return digest;
+}
+
+std::optional<User> CredentialCache::Find(const std::string &username, const std::string &password) {
+  if (entries_.empty()) return std::nullopt;
+  auto it = entries_.find(Key(username, password));
+  if (it == entries_.end()) return std::nullopt;
+  if (it->second.expires_at <= std::chrono::steady_clock::now()) {
+    entries_.erase(it);
+    return std::nullopt;
+  }
+  return it->second.user;
+}
+
+void CredentialCache::Insert(const std::string &username, const std::string &password, const User &user) {
+  if (capacity_ == 0) return;
+  const auto now = std::chrono::steady_clock::now();
+  if (entries_.size() >= capacity_) {
+    std::erase_if(entries_, [now](const auto &entry) { return entry.second.expires_at <= now; });
+  }
+  if (entries_.size() >= capacity_) {
+    // Entries are inserted with the same TTL, so the one expiring first is the oldest
+    entries_.erase(std::min_element(entries_.begin(), entries_.end(), [](const auto &lhs, const auto &rhs) {
+      return lhs.second.expires_at < rhs.second.expires_at;
+    }));
+  }
+  entries_.insert_or_assign(Key(username, password), Entry{.user = user, .expires_at = now + ttl_});
+}
+
+}  // namespace memgraph::auth
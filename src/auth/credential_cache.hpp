@@ -0,0 +1,68 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <unordered_map>
+
+#include "auth/models.hpp"
+
+namespace memgraph::auth {
+
+/**
+ * Remembers successful username and password authentications so that a client
+ * reconnecting with the same credentials doesn't pay for the password hash
+ * check (bcrypt by default) and the user lookup again.
+ *
+ * Credentials aren't stored, entries are keyed by an HMAC of the username and
+ * password with a key randomly generated for each cache. An entry expires
+ * after the TTL and the owner is expected to clear the cache whenever a user
+ * or a role changes, e.g. when a password is changed.
+ *
+ * NOTE: The class isn't thread-safe.
+ */
+class CredentialCache {
+ public:
+  /// @throw AuthException if unable to generate the key.
+  CredentialCache(size_t capacity, std::chrono::seconds ttl);
+
+  /// Returns the user authenticated with the given credentials, if they are
+  /// remembered and didn't expire.
+  std::optional<User> Find(const std::string &username, const std::string &password);
+
+  /// Remembers that the credentials authenticate the given user. Does nothing
+  /// if the capacity is 0.
+  void Insert(const std::string &username, const std::string &password, const User &user);
+
+  void Clear() { entries_.clear(); }
+
+  size_t Size() const { return entries_.size(); }
+
+ private:
+  struct Entry {
+    User user;
+    std::chrono::steady_clock::time_point expires_at;
+  };
+
+  std::string Key(const std::string &username, const std::string &password) const;
+
+  size_t capacity_;
+  std::chrono::seconds ttl_;
+  std::array<uint8_t, 32> key_{};
+  std::unordered_map<std::string, Entry> entries_;
+};
+
+}  // namespace memgraph::auth
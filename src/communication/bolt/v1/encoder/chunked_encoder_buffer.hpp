@@ -1,4 +1,4 @@
-// Copyright 2023 Memgraph Ltd.
+// Copyright 2024 Memgraph Ltd.
 //
 // Use of this software is governed by the Business Source License
 // included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
@@ -12,6 +12,7 @@
 #pragma once
 
 #include <algorithm>
+#include <array>
 #include <cstring>
 #include <memory>
 #include <vector>
@@ -40,8 +41,12 @@ namespace memgraph::communication::bolt {
  * can control when the message is over and the whole message isn't
  * unnecessarily buffered in memory.
  *
- * The current implementation stores only a single chunk into memory and sends
- * it immediately to the output stream when new data arrives.
+ * Finished chunks are kept in memory for as long as the caller announces that
+ * more data follows (`have_more`) and there is room for another whole chunk.
+ * They are handed to the output stream in a single write once the caller
+ * flushes without `have_more` or the buffer fills up. That way a stream of
+ * small messages (e.g. RECORD messages of a PULL) costs one syscall per
+ * buffer instead of two per message.
  *
  * @tparam TOutputStream the output stream that should be used
  */
@@ -62,11 +67,11 @@ class ChunkedEncoderBuffer {
 
     while (n > 0) {
       // Define the number of bytes which will be copied into the chunk because
-      // the internal storage is a fixed length array.
+      // the chunk has a fixed maximum length.
       size_t size = n < kChunkMaxDataSize - have_ ? n : kChunkMaxDataSize - have_;
 
-      // Copy `size` values to the chunk array.
-      std::memcpy(chunk_.data() + kChunkHeaderSize + have_, values + written, size);
+      // Copy `size` values behind the header of the current chunk.
+      std::memcpy(buffer_.data() + chunk_start_ + kChunkHeaderSize + have_, values + written, size);
 
       // Update positions. The position pointer and incoming size have to be
       // updated because all incoming values have to be processed.
@@ -74,16 +79,16 @@ class ChunkedEncoderBuffer {
       have_ += size;
       n -= size;
 
-      // If the chunk is full, send it to the output stream and clear the
-      // internal storage to make space for other incoming values that are left
-      // in the values array.
+      // If the chunk is full, finish it and start a new one for the values
+      // that are left in the values array.
       if (have_ == kChunkMaxDataSize) Flush(true);
     }
   }
 
   /**
-   * Wrap the data from the chunk array (append the size header) and send
-   * the whole chunk into the output stream.
+   * Wrap the data from the current chunk (append the size header). The whole
+   * buffer is sent into the output stream unless `have_more` is set and there
+   * is still room for another whole chunk.
    *
    * @param have_more this parameter is passed to the underlying output stream
    *                  `Write` method to indicate wether we have more data
@@ -91,36 +96,50 @@ class ChunkedEncoderBuffer {
    */
   bool Flush(bool have_more = false) {
     // Write the size of the chunk.
-    chunk_[0] = have_ >> 8;
-    chunk_[1] = have_ & 0xFF;
+    buffer_[chunk_start_] = have_ >> 8;
+    buffer_[chunk_start_ + 1] = have_ & 0xFF;
 
-    // Write the data to the stream.
-    auto ret = output_stream_.Write(chunk_.data(), kChunkHeaderSize + have_, have_more);
+    // Start the next chunk right behind the finished one.
+    chunk_start_ += kChunkHeaderSize + have_;
+    have_ = 0;
+
+    if (have_more && chunk_start_ + kChunkWholeSize <= buffer_.size()) return true;
 
-    // Cleanup.
-    Clear();
+    // Write the data to the stream.
+    auto ret = output_stream_.Write(buffer_.data(), chunk_start_, have_more);
+    chunk_start_ = 0;
 
     return ret;
   }
 
-  /** Clears the internal buffers. */
+  /**
+   * Clears the chunk that is currently being written. Chunks that were
+   * already finished are still sent with the next write.
+   */
   void Clear() { have_ = 0; }
 
   /**
-   * Returns a boolean indicating whether there is data in the buffer.
-   * @returns true if there is data in the buffer,
+   * Returns a boolean indicating whether there is data in the current chunk.
+   * @returns true if there is data in the current chunk,
    *          false otherwise
    */
   bool HasData() { return have_ > 0; }
 
  private:
+  // Room for the chunk that is being written and up to one whole chunk worth
+  // of finished chunks that wait to be sent.
+  static constexpr size_t kBufferSize = 2 * kChunkWholeSize;
+
   // The output stream used.
   TOutputStream &output_stream_;
 
-  // Buffer for a single chunk.
-  std::array<uint8_t, kChunkWholeSize> chunk_;
+  // Finished chunks followed by the chunk that is currently being written.
+  std::array<uint8_t, kBufferSize> buffer_;
+
+  // Offset of the current chunk (its header) in the buffer.
+  size_t chunk_start_{0};
 
-  // Amount of data in chunk array.
+  // Amount of data in the current chunk.
   size_t have_{0};
 };
 }  // namespace memgraph::communication::bolt
@@ -11,6 +11,8 @@
 
 #pragma once
 
+#include <span>
+
 #include "communication/bolt/v1/codes.hpp"
 #include "communication/bolt/v1/encoder/base_encoder.hpp"
 
@@ -60,6 +62,20 @@ class Encoder : private BaseEncoder<Buffer> {
     return buffer_.Flush(true);
   }
 
+  /**
+   * Sends a Record message whose fields list was already encoded, e.g. by a
+   * `BaseEncoder` writing into a `SpillBuffer`.
+   *
+   * @param fields the encoded fields list object that should be sent
+   */
+  bool MessageRecordEncoded(std::span<const uint8_t> fields) {
+    WriteRAW(utils::UnderlyingCast(Marker::TinyStruct1));
+    WriteRAW(utils::UnderlyingCast(Signature::Record));
+    WriteRAW(fields.data(), fields.size());
+    if (!buffer_.Flush(true)) return false;
+    return buffer_.Flush(true);
+  }
+
   /**
    * Sends a Success message.
    *
@@ -0,0 +1,141 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <optional>
+#include <span>
+#include <vector>
+
+#include "utils/exceptions.hpp"
+
+namespace memgraph::communication::bolt {
+
+/**
+ * @brief SpillBuffer
+ *
+ * Holds already encoded Bolt records so that they can be sent after the query
+ * which produced them finished executing.
+ *
+ * It has the buffer interface needed by the `BaseEncoder`: the fields of a
+ * record are encoded into the buffer and `EndRecord` closes the record.
+ * Records are kept in memory until `memory_limit` bytes are used, the rest is
+ * written to an anonymous temporary file which is removed when the buffer is
+ * destroyed. Records are read back in the order they were written.
+ *
+ * | record size (4B) | record | record size (4B) | record | ...
+ */
+class SpillBuffer {
+ public:
+  explicit SpillBuffer(size_t memory_limit) : memory_limit_(memory_limit) {}
+
+  SpillBuffer(const SpillBuffer &) = delete;
+  SpillBuffer &operator=(const SpillBuffer &) = delete;
+  SpillBuffer(SpillBuffer &&) = delete;
+  SpillBuffer &operator=(SpillBuffer &&) = delete;
+
+  ~SpillBuffer() {
+    if (file_) std::fclose(file_);
+  }
+
+  void Write(const uint8_t *data, size_t n) { record_.insert(record_.end(), data, data + n); }
+
+  bool Flush(bool /*have_more*/ = false) { return true; }
+
+  /**
+   * Stores the data written since the last call as one record.
+   *
+   * @throws utils::BasicException if the record couldn't be written to the
+   * temporary file
+   */
+  void EndRecord() {
+    const auto size = static_cast<uint32_t>(record_.size());
+    if (!file_ && memory_.size() + sizeof(size) + size <= memory_limit_) {
+      const auto *size_bytes = reinterpret_cast<const uint8_t *>(&size);
+      memory_.insert(memory_.end(), size_bytes, size_bytes + sizeof(size));
+      memory_.insert(memory_.end(), record_.begin(), record_.end());
+    } else {
+      if (!file_) {
+        file_ = std::tmpfile();
+        if (!file_) throw utils::BasicException("Couldn't create a temporary file for the spilled result.");
+      }
+      if (std::fwrite(&size, sizeof(size), 1, file_) != 1 ||
+          (size > 0 && std::fwrite(record_.data(), size, 1, file_) != 1)) {
+        throw utils::BasicException("Couldn't write the spilled result to a temporary file.");
+      }
+      spilled_bytes_ += sizeof(size) + size;
+    }
+    record_.clear();
+    ++records_;
+  }
+
+  /**
+   * Returns the next record, or `std::nullopt` if all of them were read. The
+   * returned data is valid until the next call.
+   *
+   * @throws utils::BasicException if the record couldn't be read from the
+   * temporary file
+   */
+  std::optional<std::span<const uint8_t>> NextRecord() {
+    if (read_ == records_) return std::nullopt;
+    ++read_;
+    uint32_t size = 0;
+    if (memory_pos_ < memory_.size()) {
+      std::memcpy(&size, memory_.data() + memory_pos_, sizeof(size));
+      std::span<const uint8_t> record{memory_.data() + memory_pos_ + sizeof(size), size};
+      memory_pos_ += sizeof(size) + size;
+      return record;
+    }
+    if (!reading_file_) {
+      if (std::fflush(file_) != 0 || std::fseek(file_, 0, SEEK_SET) != 0) {
+        throw utils::BasicException("Couldn't read the spilled result from a temporary file.");
+      }
+      reading_file_ = true;
+    }
+    if (std::fread(&size, sizeof(size), 1, file_) != 1) {
+      throw utils::BasicException("Couldn't read the spilled result from a temporary file.");
+    }
+    record_.resize(size);
+    if (size > 0 && std::fread(record_.data(), size, 1, file_) != 1) {
+      throw utils::BasicException("Couldn't read the spilled result from a temporary file.");
+    }
+    return std::span<const uint8_t>{record_};
+  }
+
+  /// Returns true if not all records were read yet.
+  bool HasMore() const { return read_ < records_; }
+
+  /// Returns the number of stored records.
+  uint64_t Size() const { return records_; }
+
+  /// Returns the number of bytes kept in memory.
+  size_t MemoryUsage() const { return memory_.size() + record_.capacity(); }
+
+  /// Returns the number of bytes written to the temporary file.
+  size_t SpilledBytes() const { return spilled_bytes_; }
+
+ private:
+  size_t memory_limit_;
+  std::vector<uint8_t> memory_;
+  size_t memory_pos_{0};
+  std::FILE *file_{nullptr};
+  size_t spilled_bytes_{0};
+  bool reading_file_{false};
+  // The record being written, or the last record read from the file
+  std::vector<uint8_t> record_;
+  uint64_t records_{0};
+  uint64_t read_{0};
+};
+
+}  // namespace memgraph::communication::bolt
@@ -110,16 +110,21 @@ ServerContext::ServerContext(const std::string &key_file, const std::string &cer
   }
 }
 
-ServerContext::ServerContext(ServerContext &&other) noexcept { std::swap(ctx_, other.ctx_); }
+ServerContext::ServerContext(ServerContext &&other) noexcept {
+  std::swap(ctx_, other.ctx_);
+  std::swap(use_ktls_, other.use_ktls_);
+}
 
 ServerContext &ServerContext::operator=(ServerContext &&other) noexcept {
   if (this == &other) return *this;
 
   // move other objects to self
   ctx_ = std::move(other.ctx_);
+  use_ktls_ = other.use_ktls_;
 
   // reset other objects
   other.ctx_.reset();
+  other.use_ktls_ = false;
 
   return *this;
 }
@@ -138,4 +143,17 @@ boost::asio::ssl::context &ServerContext::context_clone() {
 
 bool ServerContext::use_ssl() const { return ctx_.has_value(); }
 
+bool ServerContext::EnableKernelTls() {
+  MG_ASSERT(ctx_);
+#ifdef SSL_OP_ENABLE_KTLS
+  // OpenSSL falls back to encrypting the records itself if the kernel doesn't
+  // support kTLS or the negotiated cipher.
+  SSL_CTX_set_options(ctx_->native_handle(), SSL_OP_ENABLE_KTLS);
+  use_ktls_ = true;
+#endif
+  return use_ktls_;
+}
+
+bool ServerContext::use_ktls() const { return use_ktls_; }
+
 }  // namespace memgraph::communication
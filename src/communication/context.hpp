@@ -104,8 +104,19 @@ class ServerContext final {
 
   bool use_ssl() const;
 
+  /**
+   * Lets OpenSSL offload the record encryption to the kernel (kTLS) after the
+   * handshake. Sessions then drive OpenSSL directly on the socket instead of
+   * through `boost::asio::ssl::stream`. Returns false if the OpenSSL headers
+   * don't support kTLS, in which case nothing changes.
+   */
+  bool EnableKernelTls();
+
+  bool use_ktls() const;
+
  private:
   std::optional<boost::asio::ssl::context> ctx_;
+  bool use_ktls_{false};
 };
 
 }  // namespace memgraph::communication
@@ -0,0 +1,181 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <cerrno>
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+#include <openssl/bio.h>
+#include <openssl/err.h>
+#include <openssl/ssl.h>
+#include <boost/asio/associated_executor.hpp>
+#include <boost/asio/bind_executor.hpp>
+#include <boost/asio/buffer.hpp>
+#include <boost/asio/error.hpp>
+#include <boost/asio/ip/tcp.hpp>
+#include <boost/asio/post.hpp>
+#include <boost/asio/ssl/error.hpp>
+#include <boost/system/error_code.hpp>
+
+#include "utils/logging.hpp"
+
+namespace memgraph::communication::v2 {
+
+/**
+ * TLS server socket driven by OpenSSL directly on the socket file descriptor.
+ *
+ * `boost::asio::ssl::stream` passes the records through memory BIOs, so
+ * OpenSSL can't offload anything to the kernel. Here the SSL object owns a
+ * socket BIO and, with `SSL_OP_ENABLE_KTLS` set on the context, OpenSSL
+ * configures kernel TLS (kTLS) after the handshake. The kernel then encrypts
+ * the records and `SSL_write` writes the plaintext straight into the socket.
+ * When the kernel, the OpenSSL build or the negotiated cipher don't support
+ * kTLS, OpenSSL keeps encrypting the records itself.
+ *
+ * The socket is non-blocking, asynchronous operations wait for readiness on
+ * the underlying socket and retry. Handlers are called through their
+ * associated executors, never from the initiating function.
+ */
+class KTLSSocket final {
+  using tcp = boost::asio::ip::tcp;
+
+ public:
+  KTLSSocket(tcp::socket &&socket, SSL_CTX *context) : socket_(std::move(socket)), ssl_(SSL_new(context), &SSL_free) {
+    MG_ASSERT(ssl_ != nullptr, "Couldn't create the SSL object!");
+    MG_ASSERT(SSL_set_fd(ssl_.get(), static_cast<int>(socket_.native_handle())) == 1,
+              "Couldn't attach the SSL object to the socket!");
+    SSL_set_accept_state(ssl_.get());
+    SSL_set_mode(ssl_.get(), SSL_MODE_ENABLE_PARTIAL_WRITE);
+  }
+
+  tcp::socket &lowest_layer() { return socket_; }
+  const tcp::socket &lowest_layer() const { return socket_; }
+
+  auto get_executor() { return socket_.get_executor(); }
+
+  /// Returns true if the kernel encrypts the sent records.
+  bool KernelSend() const { return BIO_get_ktls_send(SSL_get_wbio(ssl_.get())) != 0; }
+
+  /// Returns true if the kernel decrypts the received records.
+  bool KernelReceive() const { return BIO_get_ktls_recv(SSL_get_rbio(ssl_.get())) != 0; }
+
+  /// Performs the server side of the handshake, the handler is called with a
+  /// `boost::system::error_code`.
+  template <typename Handler>
+  void async_handshake(Handler handler) {
+    boost::system::error_code ec;
+    socket_.native_non_blocking(true, ec);
+    if (ec) {
+      Complete(std::move(handler), ec);
+      return;
+    }
+    DoHandshake(std::move(handler));
+  }
+
+  /// Reads at least one byte of application data, the handler is called with
+  /// a `boost::system::error_code` and the number of bytes read.
+  template <typename Handler>
+  void async_read_some(const boost::asio::mutable_buffer &buffer, Handler handler) {
+    ERR_clear_error();
+    size_t read = 0;
+    const int ret = SSL_read_ex(ssl_.get(), buffer.data(), buffer.size(), &read);
+    if (ret == 1) {
+      Complete(std::move(handler), boost::system::error_code{}, read);
+      return;
+    }
+    auto executor = boost::asio::get_associated_executor(handler, socket_.get_executor());
+    RetryWhenReady(
+        ret, executor, [this, buffer, handler]() mutable { async_read_some(buffer, std::move(handler)); },
+        [this, handler](const boost::system::error_code &ec) mutable { Complete(std::move(handler), ec, size_t{0}); });
+  }
+
+  /// Writes at least one byte of the buffer, blocking until the socket is
+  /// writable.
+  size_t write_some(const boost::asio::const_buffer &buffer, boost::system::error_code &ec) {
+    while (true) {
+      ERR_clear_error();
+      size_t written = 0;
+      const int ret = SSL_write_ex(ssl_.get(), buffer.data(), buffer.size(), &written);
+      if (ret == 1) {
+        ec = {};
+        return written;
+      }
+      const int error = SSL_get_error(ssl_.get(), ret);
+      if (error != SSL_ERROR_WANT_READ && error != SSL_ERROR_WANT_WRITE) {
+        ec = ToErrorCode(error);
+        return 0;
+      }
+      socket_.wait(error == SSL_ERROR_WANT_READ ? tcp::socket::wait_read : tcp::socket::wait_write, ec);
+      if (ec) return 0;
+    }
+  }
+
+ private:
+  template <typename Handler>
+  void DoHandshake(Handler handler) {
+    ERR_clear_error();
+    const int ret = SSL_do_handshake(ssl_.get());
+    if (ret == 1) {
+      Complete(std::move(handler), boost::system::error_code{});
+      return;
+    }
+    auto executor = boost::asio::get_associated_executor(handler, socket_.get_executor());
+    RetryWhenReady(
+        ret, executor, [this, handler]() mutable { DoHandshake(std::move(handler)); },
+        [this, handler](const boost::system::error_code &ec) mutable { Complete(std::move(handler), ec); });
+  }
+
+  /// Waits until the socket is ready for what the failed SSL call needs and
+  /// calls `retry`, `fail` is called if the call failed for another reason.
+  template <typename Executor, typename Retry, typename Fail>
+  void RetryWhenReady(int ret, const Executor &executor, Retry retry, Fail fail) {
+    const int error = SSL_get_error(ssl_.get(), ret);
+    if (error != SSL_ERROR_WANT_READ && error != SSL_ERROR_WANT_WRITE) {
+      fail(ToErrorCode(error));
+      return;
+    }
+    socket_.async_wait(error == SSL_ERROR_WANT_READ ? tcp::socket::wait_read : tcp::socket::wait_write,
+                       boost::asio::bind_executor(executor, [retry = std::move(retry), fail = std::move(fail)](
+                                                                const boost::system::error_code &ec) mutable {
+                         if (ec) {
+                           fail(ec);
+                           return;
+                         }
+                         retry();
+                       }));
+  }
+
+  template <typename Handler, typename... Args>
+  void Complete(Handler handler, Args... args) {
+    auto executor = boost::asio::get_associated_executor(handler, socket_.get_executor());
+    boost::asio::post(executor, [handler = std::move(handler), args...]() mutable { handler(args...); });
+  }
+
+  static boost::system::error_code ToErrorCode(int error) {
+    switch (error) {
+      case SSL_ERROR_ZERO_RETURN:
+        return boost::asio::error::eof;
+      case SSL_ERROR_SYSCALL:
+        if (errno != 0) return {errno, boost::system::system_category()};
+        return boost::asio::error::eof;
+      default:
+        return {static_cast<int>(ERR_get_error()), boost::asio::error::get_ssl_category()};
+    }
+  }
+
+  tcp::socket socket_;
+  std::unique_ptr<SSL, decltype(&SSL_free)> ssl_;
+};
+
+}  // namespace memgraph::communication::v2
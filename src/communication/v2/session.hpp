@@ -47,6 +47,7 @@
 #include "communication/context.hpp"
 #include "communication/exceptions.hpp"
 #include "communication/fmt.hpp"
+#include "communication/v2/ktls_socket.hpp"
 #include "dbms/global.hpp"
 #include "utils/event_counter.hpp"
 #include "utils/logging.hpp"
@@ -297,7 +298,7 @@ class Session final : public std::enable_shared_from_this<Session<TSession, TSes
     execution_active_ = true;
     timeout_timer_.async_wait(boost::asio::bind_executor(strand_, std::bind(&Session::OnTimeout, shared_from_this())));
 
-    if (std::holds_alternative<SSLSocket>(socket_)) {
+    if (!std::holds_alternative<TCPSocket>(socket_)) {
       utils::OnScopeExit increment_counter(
           [] { memgraph::metrics::IncrementCounter(memgraph::metrics::ActiveSSLSessions); });
       boost::asio::dispatch(strand_, [shared_this = shared_from_this()] { shared_this->DoHandshake(); });
@@ -328,7 +329,7 @@ class Session final : public std::enable_shared_from_this<Session<TSession, TSes
                             }
                             return true;
                           },
-                          [shared_this = shared_from_this(), data, len](SSLSocket &socket) mutable {
+                          [shared_this = shared_from_this(), data, len](auto &socket) mutable {
                             boost::system::error_code ec;
                             while (len > 0) {
                               const auto sent = socket.write_some(boost::asio::buffer(data, len), ec);
@@ -482,6 +483,9 @@ class Session final : public std::enable_shared_from_this<Session<TSession, TSes
       socket->async_handshake(
           boost::asio::ssl::stream_base::server,
           boost::asio::bind_executor(strand_, std::bind_front(&Session::OnHandshake, shared_from_this())));
+    } else if (auto *ktls_socket = std::get_if<KTLSSocket>(&socket_); ktls_socket) {
+      ktls_socket->async_handshake(
+          boost::asio::bind_executor(strand_, std::bind_front(&Session::OnHandshake, shared_from_this())));
     }
   }
 
@@ -489,6 +493,10 @@ class Session final : public std::enable_shared_from_this<Session<TSession, TSes
     if (ec) {
       return OnError(ec);
     }
+    if (const auto *socket = std::get_if<KTLSSocket>(&socket_); socket) {
+      spdlog::trace("Kernel TLS for {}: send {}, receive {}", remote_endpoint_, socket->KernelSend(),
+                    socket->KernelReceive());
+    }
     DoRead();
   }
 
@@ -525,9 +533,12 @@ class Session final : public std::enable_shared_from_this<Session<TSession, TSes
     }
   }
 
-  std::variant<TCPSocket, SSLSocket> CreateSocket(tcp::socket &&socket, ServerContext &context) {
+  std::variant<TCPSocket, SSLSocket, KTLSSocket> CreateSocket(tcp::socket &&socket, ServerContext &context) {
     if (context.use_ssl()) {
       ssl_context_.emplace(context.context_clone());
+      if (context.use_ktls()) {
+        return KTLSSocket{std::move(socket), context.context()};
+      }
       return SSLSocket{std::move(socket), *ssl_context_};
     }
 
@@ -548,7 +559,7 @@ class Session final : public std::enable_shared_from_this<Session<TSession, TSes
     return std::visit(utils::Overloaded{std::forward<F>(fun)}, socket_);
   }
 
-  std::variant<TCPSocket, SSLSocket> socket_;
+  std::variant<TCPSocket, SSLSocket, KTLSSocket> socket_;
   std::optional<std::reference_wrapper<boost::asio::ssl::context>> ssl_context_;
   boost::asio::strand<tcp::socket::executor_type> strand_;
 
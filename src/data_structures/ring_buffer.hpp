@@ -18,6 +18,7 @@
 #include <thread>
 #include <utility>
 
+#include "utils/lock_profile.hpp"
 #include "utils/logging.hpp"
 #include "utils/spin_lock.hpp"
 
@@ -89,7 +90,7 @@ class RingBuffer {
  private:
   int capacity_;
   std::unique_ptr<TElement[]> buffer_;
-  memgraph::utils::SpinLock lock_;
+  memgraph::utils::ProfiledLock<memgraph::utils::SpinLock, memgraph::utils::LockKind::RING_BUFFER> lock_;
   int read_pos_{0};
   int write_pos_{0};
   int size_{0};
@@ -69,6 +69,17 @@ class Database {
     return storage_->UniqueAccess(override_isolation_level);
   }
 
+  /**
+   * @brief Storage's Accessor for read-only queries on a replica
+   *
+   * @param override_isolation_level
+   * @return std::unique_ptr<storage::Storage::Accessor>
+   */
+  std::unique_ptr<storage::Storage::Accessor> ReplicaReadAccess(
+      std::optional<storage::IsolationLevel> override_isolation_level = {}) {
+    return storage_->ReplicaReadAccess(override_isolation_level);
+  }
+
   /**
    * @brief Unique storage identified (name)
    *
@@ -148,7 +159,7 @@ class Database {
   /**
    * @brief Returns the PlanCache vector raw pointer
    *
-   * @return utils::Synchronized<utils::LRUCache<uint64_t, std::shared_ptr<PlanWrapper>>, utils::RWSpinLock>
+   * @return query::PlanCacheLRU
    */
   query::PlanCacheLRU *plan_cache() { return &plan_cache_; }
 
@@ -17,6 +17,7 @@
 #include "dbms/constants.hpp"
 #include "dbms/global.hpp"
 #include "flags/experimental.hpp"
+#include "query/procedure/module.hpp"
 #include "spdlog/spdlog.h"
 #include "system/include/system/system.hpp"
 #include "utils/exceptions.hpp"
@@ -410,6 +411,9 @@ DbmsHandler::DeleteResult DbmsHandler::Delete_(std::string_view db_name) {
     }
   });
 
+  // Query modules can't tell that a database is gone, state they keep for it would otherwise outlive it
+  query::procedure::gModuleRegistry.NotifyDatabaseDrop(db_name);
+
   return {};  // Success
 }
 
@@ -45,6 +45,7 @@
 #include "spdlog/spdlog.h"
 #include "storage/v2/isolation_level.hpp"
 #include "system/system.hpp"
+#include "utils/lock_profile.hpp"
 #include "utils/logging.hpp"
 #include "utils/result.hpp"
 #include "utils/rw_lock.hpp"
@@ -102,7 +103,7 @@ static inline nlohmann::json ToJson(const Statistics &stats) {
  */
 class DbmsHandler {
  public:
-  using LockT = utils::RWLock;
+  using LockT = utils::ProfiledLock<utils::RWLock, utils::LockKind::DBMS>;
 #ifdef MG_ENTERPRISE
 
   using NewResultT = utils::BasicResult<NewError, DatabaseAccess>;
@@ -16,6 +16,7 @@
 #include "replication/replication_server.hpp"
 #include "storage/v2/constraints/type_constraints_kind.hpp"
 #include "storage/v2/durability/durability.hpp"
+#include "storage/v2/durability/paths.hpp"
 #include "storage/v2/durability/snapshot.hpp"
 #include "storage/v2/durability/version.hpp"
 #include "storage/v2/indices/label_index_stats.hpp"
@@ -236,9 +237,12 @@ void InMemoryReplicationHandlers::AppendDeltasHandler(dbms::DbmsHandler *dbms_ha
     return;
   }
 
-  ReadAndApplyDeltas(
-      storage, &decoder,
-      storage::durability::kVersion);  // TODO: Check if we are always using the latest version when replicating
+  {
+    auto epoch_guard = storage->LockReplicaEpoch();
+    ReadAndApplyDeltas(
+        storage, &decoder,
+        storage::durability::kVersion);  // TODO: Check if we are always using the latest version when replicating
+  }
 
   const storage::replication::AppendDeltasRes res{true, repl_storage_state.last_durable_timestamp_.load()};
   slk::Save(res, res_builder);
@@ -337,6 +341,8 @@ void InMemoryReplicationHandlers::SnapshotHandler(dbms::DbmsHandler *dbms_handle
 
     storage->wal_file_.reset();
   }
+  // The recycled WAL files could have deltas newer than the received snapshot.
+  storage->wal_segment_pool_.Clear();
   spdlog::debug("Replication recovery from snapshot finished!");
 }
 
@@ -411,6 +417,8 @@ void InMemoryReplicationHandlers::ForceResetStorageHandler(dbms::DbmsHandler *db
 
     storage->wal_file_.reset();
   }
+  // The timestamps start over, so the deltas left in recycled WAL files are newer than the new ones.
+  storage->wal_segment_pool_.Clear();
 }
 
 void InMemoryReplicationHandlers::WalFilesHandler(dbms::DbmsHandler *dbms_handler,
@@ -439,8 +447,12 @@ void InMemoryReplicationHandlers::WalFilesHandler(dbms::DbmsHandler *dbms_handle
   auto *storage = static_cast<storage::InMemoryStorage *>(db_acc->get()->storage());
   utils::EnsureDirOrDie(storage->recovery_.wal_directory_);
 
-  for (auto i = 0; i < wal_file_number; ++i) {
-    LoadWal(storage, &decoder);
+  {
+    // All of the WAL files are a single batch for the replica's read queries
+    auto epoch_guard = storage->LockReplicaEpoch();
+    for (auto i = 0; i < wal_file_number; ++i) {
+      LoadWal(storage, &decoder);
+    }
   }
 
   const storage::replication::WalFilesRes res{true, storage->repl_storage_state_.last_durable_timestamp_.load()};
@@ -472,7 +484,10 @@ void InMemoryReplicationHandlers::CurrentWalHandler(dbms::DbmsHandler *dbms_hand
   auto *storage = static_cast<storage::InMemoryStorage *>(db_acc->get()->storage());
   utils::EnsureDirOrDie(storage->recovery_.wal_directory_);
 
-  LoadWal(storage, &decoder);
+  {
+    auto epoch_guard = storage->LockReplicaEpoch();
+    LoadWal(storage, &decoder);
+  }
 
   const storage::replication::CurrentWalRes res{true, storage->repl_storage_state_.last_durable_timestamp_.load()};
   slk::Save(res, res_builder);
@@ -488,6 +503,11 @@ void InMemoryReplicationHandlers::LoadWal(storage::InMemoryStorage *storage, sto
   spdlog::trace("Received WAL saved to {}", *maybe_wal_path);
   try {
     auto wal_info = storage::durability::ReadWalInfo(*maybe_wal_path);
+    // Main's current WAL file can end with a transaction which is still being
+    // written, the finalized ones can't.
+    if (wal_info.checksum_mismatch && !storage::durability::IsCurrentWalName(*maybe_wal_path)) {
+      throw storage::durability::RecoveryFailure("Checksum mismatch in a finalized WAL file!");
+    }
     if (wal_info.seq_num == 0) {
       storage->uuid_ = wal_info.uuid;
     }
@@ -519,6 +539,9 @@ void InMemoryReplicationHandlers::LoadWal(storage::InMemoryStorage *storage, sto
 
     for (size_t i = 0; i < wal_info.num_deltas;) {
       i += ReadAndApplyDeltas(storage, &wal, *version);
+      // Unlike the deltas streamed from main, each transaction in a WAL file
+      // is followed by its checksum, which `ReadWalInfo` already verified.
+      storage::durability::ReadWalTransactionChecksum(&wal, WalDeltaData::Type::TRANSACTION_END, *version);
     }
 
     spdlog::debug("Replication from current WAL successful!");
@@ -65,4 +65,12 @@ DEFINE_bool(auth_password_permit_null, true, "Set to false to disable null passw
 DEFINE_string(
     auth_password_strength_regex, memgraph::glue::kDefaultPasswordRegex.data(),
     "The regular expression that should be used to match the entire entered password to ensure its strength.");
+
+DEFINE_uint32(auth_credential_cache_size, 0,
+              "Maximum number of successful username/password authentications to remember so that reconnecting "
+              "clients skip the password hash check. Set to 0 to disable the cache.");
+
+DEFINE_VALIDATED_int32(auth_credential_cache_ttl_sec, 600,
+                       "Time (in seconds) for which a remembered authentication stays valid.",
+                       FLAG_IN_RANGE(1, 86400));
 // NOLINTEND(cppcoreguidelines-avoid-non-const-global-variables,misc-unused-parameters)
@@ -36,3 +36,15 @@ DEFINE_VALIDATED_int32(bolt_session_inactivity_timeout, 1800,
 DEFINE_string(bolt_cert_file, "", "Certificate file which should be used for the Bolt server.");
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 DEFINE_string(bolt_key_file, "", "Key file which should be used for the Bolt server.");
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_bool(bolt_ktls, false,
+            "Offload the record encryption of secure Bolt connections to the kernel (kTLS) where the kernel and "
+            "OpenSSL support it. Other connections are encrypted by OpenSSL as before.");
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_bool(bolt_spill_paged_results, false,
+            "When a client pages through the result of a read-only query with PULL n, materialize the rest of the "
+            "result after the first page so the transaction can finish while the client keeps paging.");
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_uint64(bolt_spill_memory_limit_kib, 65536,
+              "Size of a materialized result kept in memory per session, the rest is written to a temporary file.");
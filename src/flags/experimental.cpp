@@ -30,6 +30,14 @@ DEFINE_VALIDATED_string(experimental_enabled, "",
                         "Experimental features to be used, comma-separated. Options [text-search, high-availability]",
                         { return memgraph::flags::ValidExperimentalFlag(value); });
 
+// NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_uint64(text_search_refresh_interval_ms, 0,
+              "Interval (in milliseconds) in which committed changes are applied to text indices in one batch. With 0 "
+              "every transaction applies its own changes when it commits.");
+// NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_bool(text_search_wait_for_refresh, false,
+            "Apply all committed text index changes before running a text search, so the search sees them.");
+
 using namespace std::string_view_literals;
 namespace rv = ranges::views;
 
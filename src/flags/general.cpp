@@ -67,6 +67,11 @@ DEFINE_bool(allow_load_csv, true, "Controls whether LOAD CSV clause is allowed i
 DEFINE_VALIDATED_uint64(storage_gc_cycle_sec, 30, "Storage garbage collector interval (in seconds).",
                         FLAG_IN_RANGE(1, 24UL * 3600));
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_VALIDATED_uint64(storage_gc_history_retention_sec, 0,
+                        "How long (in seconds) the garbage collector keeps committed versions readable by AS OF "
+                        "transactions. 0 disables history retention.",
+                        FLAG_IN_RANGE(0, 30UL * 24 * 3600));
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 DEFINE_VALIDATED_uint64(storage_python_gc_cycle_sec, 180,
                         "Storage python full garbage collection interval (in seconds).", FLAG_IN_RANGE(1, 24UL * 3600));
 // NOTE: The `storage_properties_on_edges` flag must be the same here and in
@@ -97,6 +102,18 @@ DEFINE_VALIDATED_uint64(storage_wal_file_flush_every_n_tx,
                         "WAL file. Set to 1 for fully synchronous operation.",
                         FLAG_IN_RANGE(1, 1000000));
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_VALIDATED_uint64(storage_wal_file_recycle_count,
+                        memgraph::storage::Config::Durability().wal_file_recycle_count,
+                        "Number of finished WAL files kept for reuse by new WAL files, which are preallocated to the "
+                        "WAL file size. Reusing allocated files lowers the latency of syncing the WAL. Set to 0 to "
+                        "disable.",
+                        FLAG_IN_RANGE(0, 1000));
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_VALIDATED_uint64(storage_durability_scrub_interval_sec, 0,
+                        "Interval (in seconds) in which the checksums of all finished snapshot and WAL files are "
+                        "verified in the background. Corrupt files are reported in the log. Set to 0 to disable.",
+                        FLAG_IN_RANGE(0, 7 * 24 * 3600));
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 DEFINE_bool(storage_snapshot_on_exit, false, "Controls whether the storage creates another snapshot on exit.");
 
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
@@ -142,9 +159,19 @@ DEFINE_bool(storage_enable_edges_metadata, false,
 DEFINE_bool(storage_delta_on_identical_property_update, true,
             "Controls whether updating a property with the same value should create a delta object.");
 
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_bool(storage_synchronized_scans, false,
+            "Set to true to start label index scans where a concurrent scan over the same label currently is, so that "
+            "concurrent scans share the pass over the index instead of making their own.");
+
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 DEFINE_bool(schema_info_enabled, false, "Set to true to enable run-time schema info tracking.");
 
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_bool(lock_contention_profiling, false,
+            "Set to true to record acquisitions and contended waits of the engine, GC, database handler, plan cache "
+            "and spin locks. The statistics are available through SHOW LOCK STATISTICS and the metrics endpoint.");
+
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 DEFINE_bool(telemetry_enabled, false,
             "Set to true to enable telemetry. We collect information about the "
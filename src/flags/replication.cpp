@@ -19,3 +19,10 @@ DEFINE_uint64(replication_replica_check_frequency_sec, 1,
               "The MAIN instance allocates a new thread for each REPLICA.");
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 DEFINE_bool(replication_restore_state_on_startup, true, "Restore replication state on startup, e.g. recover replica");
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_bool(replication_replica_epoch_reads, false,
+            "On a REPLICA, apply each batch of replicated transactions exclusively and run implicit (autocommit) read "
+            "queries against the state between batches without MVCC delta chains or vertex locks. Explicit "
+            "transactions read through MVCC as usual. Faster analytical reads, but batches wait for the running "
+            "autocommit queries to finish, so a long-running one stalls replication and SYNC/STRICT_SYNC commits on "
+            "MAIN can time out.");
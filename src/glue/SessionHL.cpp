@@ -16,7 +16,10 @@
 #include "gflags/gflags.h"
 
 #include "audit/log.hpp"
+#include "communication/bolt/v1/encoder/base_encoder.hpp"
+#include "communication/bolt/v1/encoder/spill_buffer.hpp"
 #include "dbms/constants.hpp"
+#include "flags/bolt.hpp"
 #include "flags/run_time_configurable.hpp"
 #include "glue/SessionHL.hpp"
 #include "glue/auth_checker.hpp"
@@ -87,6 +90,32 @@ class TypedValueResultStream : public TypedValueResultStreamBase {
   TEncoder *encoder_;
 };
 
+/// Encodes the results into a SpillBuffer so they can be sent to the client
+/// after the query finished executing.
+class SpillResultStream : public TypedValueResultStreamBase {
+ public:
+  SpillResultStream(memgraph::communication::bolt::SpillBuffer *buffer, memgraph::storage::Storage *storage,
+                    int bolt_major_version)
+      : TypedValueResultStreamBase{storage}, buffer_(buffer), encoder_(*buffer) {
+    encoder_.UpdateVersion(bolt_major_version);
+  }
+
+  void Result(const std::vector<memgraph::query::TypedValue> &values) {
+    DecodeValues(values);
+    encoder_.WriteList(AccessValues());
+    buffer_->EndRecord();
+  }
+
+ private:
+  memgraph::communication::bolt::SpillBuffer *buffer_;
+  memgraph::communication::bolt::BaseEncoder<memgraph::communication::bolt::SpillBuffer> encoder_;
+};
+
+bool HasMore(const std::map<std::string, memgraph::query::TypedValue> &summary) {
+  auto it = summary.find("has_more");
+  return it != summary.end() && it->second.IsBool() && it->second.ValueBool();
+}
+
 void TypedValueResultStreamBase::DecodeValues(const std::vector<memgraph::query::TypedValue> &values) {
   decoded_values_.reserve(values.size());
   decoded_values_.clear();
@@ -214,9 +243,13 @@ bool SessionHL::SSOAuthenticate(const std::string &scheme, const std::string &id
   return true;
 }
 
-void SessionHL::Abort() { interpreter_.Abort(); }
+void SessionHL::Abort() {
+  spilled_result_.reset();
+  interpreter_.Abort();
+}
 
 bolt_map_t SessionHL::Discard(std::optional<int> n, std::optional<int> qid) {
+  if (spilled_result_) return PullSpilled(nullptr, n);
   try {
     memgraph::query::DiscardValueResultStream stream;
     return DecodeSummary(interpreter_.Pull(&stream, n, qid));
@@ -232,8 +265,18 @@ bolt_map_t SessionHL::Pull(SessionHL::TEncoder *encoder, std::optional<int> n, s
   try {
     auto &db = interpreter_.current_db_.db_acc_;
     auto *storage = db ? db->get()->storage() : nullptr;
+    if (spilled_result_) return PullSpilled(encoder, n);
     TypedValueResultStream<TEncoder> stream(encoder, storage);
-    return DecodeSummary(interpreter_.Pull(&stream, n, qid));
+    auto summary = interpreter_.Pull(&stream, n, qid);
+    // The client pages through the result. Pull the rest of it now so the
+    // transaction can finish and keep paging from the spilled result.
+    if (FLAGS_bolt_spill_paged_results && HasMore(summary) && interpreter_.IsLastQueryReadOnlyAutocommit()) {
+      auto spill = std::make_unique<SpilledResult>(FLAGS_bolt_spill_memory_limit_kib * 1024);
+      SpillResultStream spill_stream(&spill->buffer, storage, version_.major);
+      spill->summary = DecodeSummary(interpreter_.Pull(&spill_stream, std::nullopt, std::nullopt));
+      spilled_result_ = std::move(spill);
+    }
+    return DecodeSummary(summary);
   } catch (const memgraph::query::QueryException &e) {
     // Count the number of specific exceptions thrown
     metrics::IncrementCounter(GetExceptionName(e));
@@ -248,9 +291,22 @@ bolt_map_t SessionHL::Pull(SessionHL::TEncoder *encoder, std::optional<int> n, s
   }
 }
 
+bolt_map_t SessionHL::PullSpilled(SessionHL::TEncoder *encoder, std::optional<int> n) {
+  for (int i = 0; !n || i < *n; ++i) {
+    auto record = spilled_result_->buffer.NextRecord();
+    if (!record) break;
+    if (encoder) encoder->MessageRecordEncoded(*record);
+  }
+  if (spilled_result_->buffer.HasMore()) return {{"has_more", bolt_value_t(true)}};
+  auto summary = std::move(spilled_result_->summary);
+  spilled_result_.reset();
+  return summary;
+}
+
 std::pair<std::vector<std::string>, std::optional<int>> SessionHL::Interpret(const std::string &query,
                                                                              const bolt_map_t &params,
                                                                              const bolt_map_t &extra) {
+  spilled_result_.reset();
   auto get_params_pv = [params](storage::Storage const *storage) -> memgraph::storage::PropertyValue::map_t {
     auto params_pv = memgraph::storage::PropertyValue::map_t{};
     params_pv.reserve(params.size());
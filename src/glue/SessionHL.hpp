@@ -12,6 +12,7 @@
 
 #include "audit/log.hpp"
 #include "auth/auth.hpp"
+#include "communication/bolt/v1/encoder/spill_buffer.hpp"
 #include "communication/v2/server.hpp"
 #include "communication/v2/session.hpp"
 #include "dbms/database.hpp"
@@ -83,6 +84,9 @@ class SessionHL final : public memgraph::communication::bolt::Session<memgraph::
  private:
   bolt_map_t DecodeSummary(const std::map<std::string, memgraph::query::TypedValue> &summary);
 
+  /// Sends (or discards, if `encoder` is null) up to `n` records of the spilled result.
+  bolt_map_t PullSpilled(TEncoder *encoder, std::optional<int> n);
+
   /**
    * @brief Get the user's default database
    *
@@ -100,6 +104,15 @@ class SessionHL final : public memgraph::communication::bolt::Session<memgraph::
   memgraph::auth::SynchedAuth *auth_;
   memgraph::communication::v2::ServerEndpoint endpoint_;
   std::optional<std::string> implicit_db_;
+
+  // Rest of a paged result of a finished read-only query, see `bolt_spill_paged_results`
+  struct SpilledResult {
+    explicit SpilledResult(size_t memory_limit) : buffer(memory_limit) {}
+
+    memgraph::communication::bolt::SpillBuffer buffer;
+    bolt_map_t summary;
+  };
+  std::unique_ptr<SpilledResult> spilled_result_;
 };
 
 }  // namespace memgraph::glue
@@ -17,9 +17,18 @@ namespace memgraph::glue {
 
 bool QueryUserOrRole::IsAuthorized(const std::vector<query::AuthQuery::Privilege> &privileges, std::string_view db_name,
                                    query::UserPolicy *policy) const {
-  auto locked_auth = auth_->Lock();
-  // Check policy and update if behind (and policy permits it)
-  if (policy->DoUpdate() && !locked_auth->UpToDate(auth_epoch_)) {
+  // The cached user or role is checked without touching the auth storage or its lock as long as no user or role
+  // changed since it was read
+  if (!policy->DoUpdate() || (auth_state_ && auth_state_->GetEpoch() == auth_epoch_)) {
+    if (user_) return AuthChecker::IsUserAuthorized(*user_, privileges, db_name);
+    if (role_) return AuthChecker::IsRoleAuthorized(*role_, privileges, db_name);
+    return !policy->DoUpdate() || !auth_state_->AccessControlled();
+  }
+
+  auto locked_auth = auth_->ReadLock();
+  auth_state_ = locked_auth->GetPublishedState();
+  // Update if behind
+  if (!locked_auth->UpToDate(auth_epoch_)) {
     if (user_) user_ = locked_auth->GetUser(user_->username());
     if (role_) role_ = locked_auth->GetRole(role_->rolename());
   }
@@ -27,7 +36,7 @@ bool QueryUserOrRole::IsAuthorized(const std::vector<query::AuthQuery::Privilege
   if (user_) return AuthChecker::IsUserAuthorized(*user_, privileges, db_name);
   if (role_) return AuthChecker::IsRoleAuthorized(*role_, privileges, db_name);
 
-  return !policy->DoUpdate() || !locked_auth->AccessControlled();
+  return !locked_auth->AccessControlled();
 }
 
 #ifdef MG_ENTERPRISE
@@ -52,6 +52,7 @@ struct QueryUserOrRole : public query::QueryUserOrRole {
   mutable std::optional<auth::User> user_{};
   mutable std::optional<auth::Role> role_{};
   mutable auth::Auth::Epoch auth_epoch_{auth::Auth::kStartEpoch};
+  mutable const auth::Auth::PublishedState *auth_state_{nullptr};
 };
 
 }  // namespace memgraph::glue
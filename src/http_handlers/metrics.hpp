@@ -25,6 +25,7 @@
 #include "license/license_sender.hpp"
 #include "storage/v2/storage.hpp"
 #include "utils/event_histogram.hpp"
+#include "utils/lock_profile.hpp"
 
 namespace memgraph::http {
 
@@ -47,6 +48,9 @@ struct MetricsResponse {
   // Storage of all the percentile values across the histograms in the system
   // e.g. query latency percentiles, snapshot recovery duration percentiles, etc.
   std::vector<std::tuple<std::string, std::string, uint64_t>> event_histograms{};
+
+  // Storage of the lock contention statistics, present only when lock profiling is enabled
+  std::vector<std::tuple<std::string, std::string, uint64_t>> lock_statistics{};
 };
 
 class MetricsService {
@@ -73,7 +77,8 @@ class MetricsService {
                            .disk_usage = info.disk_usage,
                            .event_counters = GetEventCounters(),
                            .event_gauges = GetEventGauges(),
-                           .event_histograms = GetEventHistograms()};
+                           .event_histograms = GetEventHistograms(),
+                           .lock_statistics = GetLockStatistics()};
   }
 
   nlohmann::json AsJson(MetricsResponse response) {
@@ -100,6 +105,10 @@ class MetricsService {
       metrics_response[type][name] = value;
     }
 
+    for (const auto &[name, type, value] : response.lock_statistics) {
+      metrics_response[type][name] = value;
+    }
+
     return metrics_response;
   }
 
@@ -146,6 +155,26 @@ class MetricsService {
 
     return event_histograms;
   }
+
+  inline static std::vector<std::tuple<std::string, std::string, uint64_t>> GetLockStatistics() {
+    // NOLINTNEXTLINE(cppcoreguidelines-init-variables)
+    std::vector<std::tuple<std::string, std::string, uint64_t>> lock_statistics{};
+    if (!memgraph::utils::LockProfilingEnabled()) return lock_statistics;
+
+    const auto *lock_type = "Lock";
+    for (const auto &lock : memgraph::utils::GetLockStatistics()) {
+      const auto name = std::string(lock.metric_name);
+      lock_statistics.emplace_back(name + "Acquisitions", lock_type, lock.acquisitions);
+      lock_statistics.emplace_back(name + "Contentions", lock_type, lock.contentions);
+      lock_statistics.emplace_back(name + "Wait_us_total", lock_type, lock.wait_total_us);
+      lock_statistics.emplace_back(name + "Wait_us_max", lock_type, lock.wait_max_us);
+      lock_statistics.emplace_back(name + "Wait_us_50p", lock_type, lock.wait_p50_us);
+      lock_statistics.emplace_back(name + "Wait_us_90p", lock_type, lock.wait_p90_us);
+      lock_statistics.emplace_back(name + "Wait_us_99p", lock_type, lock.wait_p99_us);
+    }
+
+    return lock_statistics;
+  }
 };
 
 // TODO: Should this be inside Database?
@@ -61,6 +61,7 @@
 #include "telemetry/telemetry.hpp"
 #include "utils/event_gauge.hpp"
 #include "utils/file.hpp"
+#include "utils/lock_profile.hpp"
 #include "utils/logging.hpp"
 #include "utils/signals.hpp"
 #include "utils/sysinfo/memory.hpp"
@@ -189,6 +190,8 @@ int main(int argc, char **argv) {
   // Unhandled exception handler init.
   std::set_terminate(&memgraph::utils::TerminateHandler);
 
+  memgraph::utils::EnableLockProfiling(FLAGS_lock_contention_profiling);
+
   // Initialize Python
   auto *program_name = Py_DecodeLocale(argv[0], nullptr);
   MG_ASSERT(program_name);
@@ -355,19 +358,24 @@ int main(int argc, char **argv) {
   // Main storage and execution engines initialization
   memgraph::storage::Config db_config{
       .gc = {.type = memgraph::storage::Config::Gc::Type::PERIODIC,
-             .interval = std::chrono::seconds(FLAGS_storage_gc_cycle_sec)},
+             .interval = std::chrono::seconds(FLAGS_storage_gc_cycle_sec),
+             .history_retention = std::chrono::seconds(FLAGS_storage_gc_history_retention_sec)},
 
       .durability = {.storage_directory = FLAGS_data_directory,
                      .recover_on_startup = FLAGS_data_recovery_on_startup,
                      .snapshot_retention_count = FLAGS_storage_snapshot_retention_count,
                      .wal_file_size_kibibytes = FLAGS_storage_wal_file_size_kib,
                      .wal_file_flush_every_n_tx = FLAGS_storage_wal_file_flush_every_n_tx,
+                     .wal_file_recycle_count = FLAGS_storage_wal_file_recycle_count,
+                     .scrub_interval = std::chrono::seconds(FLAGS_storage_durability_scrub_interval_sec),
                      .snapshot_on_exit = FLAGS_storage_snapshot_on_exit,
                      .restore_replication_state_on_startup = FLAGS_replication_restore_state_on_startup,
                      .items_per_batch = FLAGS_storage_items_per_batch,
                      .recovery_thread_count = FLAGS_storage_recovery_thread_count,
                      .allow_parallel_schema_creation = FLAGS_storage_parallel_schema_recovery},
-      .transaction = {.isolation_level = memgraph::flags::ParseIsolationLevel()},
+      .transaction = {.isolation_level = memgraph::flags::ParseIsolationLevel(),
+                      .synchronized_scans = FLAGS_storage_synchronized_scans,
+                      .replica_epoch_reads = FLAGS_replication_replica_epoch_reads},
       .disk = {.main_storage_directory = FLAGS_data_directory + "/rocksdb_main_storage",
                .label_index_directory = FLAGS_data_directory + "/rocksdb_label_index",
                .label_property_index_directory = FLAGS_data_directory + "/rocksdb_label_property_index",
@@ -641,6 +649,13 @@ int main(int argc, char **argv) {
     context = ServerContext(FLAGS_bolt_key_file, FLAGS_bolt_cert_file);
     service_name = "BoltS";
     spdlog::info("Using secure Bolt connection (with SSL)");
+    if (FLAGS_bolt_ktls) {
+      if (context.EnableKernelTls()) {
+        spdlog::info("Offloading Bolt TLS record encryption to the kernel where supported");
+      } else {
+        spdlog::warn("Kernel TLS isn't supported by this OpenSSL version, Bolt TLS records are encrypted by OpenSSL");
+      }
+    }
   } else {
     spdlog::warn(
         memgraph::utils::MessageWithLink("Using non-secure Bolt connection (without SSL).", "https://memgr.ph/ssl"));
@@ -17,6 +17,7 @@
 #include "query/frontend/stripped.hpp"
 #include "query/parameters.hpp"
 #include "storage/v2/property_value.hpp"
+#include "utils/lock_profile.hpp"
 #include "utils/lru_cache.hpp"
 #include "utils/synchronized.hpp"
 
@@ -126,7 +127,8 @@ class SingleNodeLogicalPlan final : public LogicalPlan {
 };
 
 using PlanCacheLRU =
-    utils::Synchronized<utils::LRUCache<uint64_t, std::shared_ptr<query::PlanWrapper>>, utils::RWSpinLock>;
+    utils::Synchronized<utils::LRUCache<uint64_t, std::shared_ptr<query::PlanWrapper>>,
+                        utils::ProfiledLock<utils::RWSpinLock, utils::LockKind::PLAN_CACHE>>;
 
 std::unique_ptr<LogicalPlan> MakeLogicalPlan(AstStorage ast_storage, CypherQuery *query, const Parameters &parameters,
                                              DbAccessor *db_accessor,
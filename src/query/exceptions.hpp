@@ -420,6 +420,12 @@ class WriteQueryOnReplicaException : public QueryException {
   SPECIALIZE_GET_EXCEPTION_NAME(WriteQueryOnReplicaException)
 };
 
+class WriteQueryAsOfException : public QueryException {
+ public:
+  WriteQueryAsOfException() : QueryException("Write queries can't read the graph AS OF a past time!") {}
+  SPECIALIZE_GET_EXCEPTION_NAME(WriteQueryAsOfException)
+};
+
 class WriteQueryOnMainException : public QueryException {
  public:
   WriteQueryOnMainException()
@@ -855,7 +855,7 @@ class Aggregation : public memgraph::query::BinaryOperator {
   static const utils::TypeInfo kType;
   const utils::TypeInfo &GetTypeInfo() const override { return kType; }
 
-  enum class Op { COUNT, MIN, MAX, SUM, AVG, COLLECT_LIST, COLLECT_MAP, PROJECT };
+  enum class Op { COUNT, MIN, MAX, SUM, AVG, COLLECT_LIST, COLLECT_MAP, PROJECT, APPROX_COUNT_DISTINCT };
 
   Aggregation() = default;
 
@@ -866,9 +866,10 @@ class Aggregation : public memgraph::query::BinaryOperator {
   static const constexpr char *const kAvg = "AVG";
   static const constexpr char *const kCollect = "COLLECT";
   static const constexpr char *const kProject = "PROJECT";
+  static const constexpr char *const kApproxCountDistinct = "APPROX_COUNT_DISTINCT";
 
   static std::string OpToString(Op op) {
-    const char *op_strings[] = {kCount, kMin, kMax, kSum, kAvg, kCollect, kCollect, kProject};
+    const char *op_strings[] = {kCount, kMin, kMax, kSum, kAvg, kCollect, kCollect, kProject, kApproxCountDistinct};
     return op_strings[static_cast<int>(op)];
   }
 
@@ -2178,6 +2179,10 @@ struct PreQueryDirectives {
   memgraph::query::Expression *hops_limit_{nullptr};
   /// Commit frequency
   memgraph::query::Expression *commit_frequency_{nullptr};
+  /// Percentage of the vertices sampled by scans
+  memgraph::query::Expression *sample_percentage_{nullptr};
+  /// Time of the snapshot the query reads, in microseconds since the Unix epoch or as a date and time
+  memgraph::query::Expression *as_of_{nullptr};
 
   PreQueryDirectives Clone(AstStorage *storage) const {
     PreQueryDirectives object;
@@ -2187,6 +2192,8 @@ struct PreQueryDirectives {
     }
     object.hops_limit_ = hops_limit_ ? hops_limit_->Clone(storage) : nullptr;
     object.commit_frequency_ = commit_frequency_ ? commit_frequency_->Clone(storage) : nullptr;
+    object.sample_percentage_ = sample_percentage_ ? sample_percentage_->Clone(storage) : nullptr;
+    object.as_of_ = as_of_ ? as_of_->Clone(storage) : nullptr;
     return object;
   }
 };
@@ -3164,7 +3171,7 @@ class SystemInfoQuery : public memgraph::query::Query {
   static const utils::TypeInfo kType;
   const utils::TypeInfo &GetTypeInfo() const override { return kType; }
 
-  enum class InfoType { STORAGE, BUILD, ACTIVE_USERS };
+  enum class InfoType { STORAGE, BUILD, ACTIVE_USERS, LOCK_STATISTICS };
 
   DEFVISITABLE(QueryVisitor<void>);
 
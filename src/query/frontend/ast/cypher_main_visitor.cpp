@@ -153,6 +153,10 @@ antlrcpp::Any CypherMainVisitor::visitSystemInfoQuery(MemgraphCypher::SystemInfo
     info_query->info_type_ = SystemInfoQuery::InfoType::ACTIVE_USERS;
     return info_query;
   }
+  if (ctx->lockStatistics()) {
+    info_query->info_type_ = SystemInfoQuery::InfoType::LOCK_STATISTICS;
+    return info_query;
+  }
   // Should never get here
   throw utils::NotYetImplemented("System info query: '{}'", ctx->getText());
 }
@@ -323,6 +327,29 @@ antlrcpp::Any CypherMainVisitor::visitPreQueryDirectives(MemgraphCypher::PreQuer
         throw SyntaxException("Hops limit can be set only once in the USING statement.");
       }
       pre_query_directives.hops_limit_ = std::any_cast<Expression *>(pre_query_directive->hopsLimit()->accept(this));
+    } else if (auto *sample = pre_query_directive->sample()) {
+      if (pre_query_directives.sample_percentage_) {
+        throw SyntaxException("Sample can be set only once in the USING statement.");
+      }
+      if (!sample->samplePercentage->numberLiteral()) {
+        throw SyntaxException("Sample percentage should be a number.");
+      }
+      pre_query_directives.sample_percentage_ = std::any_cast<Expression *>(sample->samplePercentage->accept(this));
+    } else if (auto *as_of = pre_query_directive->asOf()) {
+      if (pre_query_directives.as_of_) {
+        throw SyntaxException("AS OF can be set only once in the USING statement.");
+      }
+      if (as_of->parameter()) {
+        pre_query_directives.as_of_ =
+            static_cast<Expression *>(std::any_cast<ParameterLookup *>(as_of->parameter()->accept(this)));
+      } else {
+        auto *as_of_time = as_of->asOfTime;
+        if (!as_of_time->StringLiteral() &&
+            !(as_of_time->numberLiteral() && as_of_time->numberLiteral()->integerLiteral())) {
+          throw SyntaxException("AS OF should be an integer or a string.");
+        }
+        pre_query_directives.as_of_ = std::any_cast<Expression *>(as_of_time->accept(this));
+      }
     } else {
       throw SyntaxException("Unknown pre query directive!");
     }
@@ -2958,6 +2985,10 @@ antlrcpp::Any CypherMainVisitor::visitFunctionInvocation(MemgraphCypher::Functio
       return static_cast<Expression *>(
           storage_->Create<Aggregation>(expressions[0], nullptr, Aggregation::Op::PROJECT, is_distinct));
     }
+    if (upper_function_name == Aggregation::kApproxCountDistinct) {
+      return static_cast<Expression *>(storage_->Create<Aggregation>(
+          expressions[0], nullptr, Aggregation::Op::APPROX_COUNT_DISTINCT, is_distinct));
+    }
   }
 
   if (expressions.size() == 2U) {
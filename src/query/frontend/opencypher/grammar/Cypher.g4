@@ -58,9 +58,11 @@ metricsInfo : METRICS INFO ;
 
 buildInfo : BUILD INFO ;
 
+lockStatistics : LOCK STATISTICS ;
+
 databaseInfoQuery : SHOW ( indexInfo | constraintInfo | edgetypeInfo | nodelabelInfo | metricsInfo ) ;
 
-systemInfoQuery : SHOW ( storageInfo | buildInfo | activeUsersInfo ) ;
+systemInfoQuery : SHOW ( storageInfo | buildInfo | activeUsersInfo | lockStatistics ) ;
 
 explainQuery : EXPLAIN cypherQuery ;
 
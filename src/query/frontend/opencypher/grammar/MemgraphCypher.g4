@@ -122,6 +122,7 @@ memgraphCypherKeyword : cypherKeyword
                       | ON_DISK_TRANSACTIONAL
                       | ON_DISK_TRANSACTIONAL
                       | PASSWORD
+                      | PERCENT_TOKEN
                       | PERIODIC
                       | POINT
                       | PORT
@@ -141,6 +142,7 @@ memgraphCypherKeyword : cypherKeyword
                       | ROLE
                       | ROLES
                       | ROWS
+                      | SAMPLE
                       | SCHEMA
                       | SERVER
                       | SERVICE_URL
@@ -308,7 +310,7 @@ foreach :  FOREACH '(' variable IN expression '|' updateClause+  ')' ;
 
 preQueryDirectives: USING preQueryDirective ( ',' preQueryDirective )* ;
 
-preQueryDirective: hopsLimit | indexHints  | periodicCommit ;
+preQueryDirective: hopsLimit | indexHints  | periodicCommit | sample | asOf ;
 
 hopsLimit: HOPS LIMIT literal ;
 
@@ -318,6 +320,10 @@ indexHint: ':' labelName ( '(' propertyKeyName ')' )? ;
 
 periodicCommit : PERIODIC COMMIT periodicCommitNumber=literal ;
 
+sample : SAMPLE samplePercentage=literal ( PERCENT_TOKEN | PERCENT ) ;
+
+asOf : AS OF_TOKEN ( asOfTime=literal | parameter ) ;
+
 periodicSubquery : IN TRANSACTIONS OF_TOKEN periodicCommitNumber=literal ROWS ;
 
 callSubquery : CALL '{' cypherQuery '}' ( periodicSubquery )? ;
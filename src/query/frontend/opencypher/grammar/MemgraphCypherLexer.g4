@@ -124,6 +124,7 @@ OF_TOKEN                : O F ;
 OFF                     : O F F ;
 ON_DISK_TRANSACTIONAL   : O N UNDERSCORE D I S K UNDERSCORE T R A N S A C T I O N A L ;
 PASSWORD                : P A S S W O R D ;
+PERCENT_TOKEN           : P E R C E N T ;
 PERIODIC                : P E R I O D I C ;
 POINT                   : P O I N T ;
 PORT                    : P O R T ;
@@ -142,6 +143,7 @@ REVOKE                  : R E V O K E ;
 ROLE                    : R O L E ;
 ROLES                   : R O L E S ;
 ROWS                    : R O W S ;
+SAMPLE                  : S A M P L E ;
 SCHEMA                  : S C H E M A ;
 SERVER                  : S E R V E R ;
 SERVICE_URL             : S E R V I C E UNDERSCORE U R L ;
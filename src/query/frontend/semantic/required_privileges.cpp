@@ -68,6 +68,7 @@ class PrivilegeExtractor : public QueryVisitor<void>, public HierarchicalTreeVis
       case SystemInfoQuery::InfoType::STORAGE:
       case SystemInfoQuery::InfoType::BUILD:
       case SystemInfoQuery::InfoType::ACTIVE_USERS:
+      case SystemInfoQuery::InfoType::LOCK_STATISTICS:
         AddPrivilege(AuthQuery::Privilege::STATS);
         break;
     }
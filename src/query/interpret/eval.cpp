@@ -55,6 +55,17 @@ std::optional<int64_t> EvaluateDeleteBufferSize(ExpressionVisitor<TypedValue> &e
   return EvaluateUint(eval, expr, "Delete buffer size");
 }
 
+std::optional<double> EvaluateSampleFraction(ExpressionVisitor<TypedValue> &eval, Expression *expr) {
+  if (!expr) return std::nullopt;
+  auto value = expr->Accept(eval);
+  if (!value.IsNumeric()) throw QueryRuntimeException("Sample percentage must be a number.");
+  const auto percentage = value.IsInt() ? static_cast<double>(value.ValueInt()) : value.ValueDouble();
+  if (!(percentage > 0.0 && percentage <= 100.0)) {
+    throw QueryRuntimeException("Sample percentage must be greater than 0 and at most 100.");
+  }
+  return percentage / 100.0;
+}
+
 std::optional<size_t> EvaluateMemoryLimit(ExpressionVisitor<TypedValue> &eval, Expression *memory_limit,
                                           size_t memory_scale) {
   if (!memory_limit) return std::nullopt;
@@ -962,6 +962,11 @@ std::optional<int64_t> EvaluateHopsLimit(ExpressionVisitor<TypedValue> &eval, Ex
 std::optional<int64_t> EvaluateCommitFrequency(ExpressionVisitor<TypedValue> &eval, Expression *expr);
 std::optional<int64_t> EvaluateDeleteBufferSize(ExpressionVisitor<TypedValue> &eval, Expression *expr);
 
+/// Evaluates the `USING SAMPLE n PERCENT` percentage to the sampled fraction.
+///
+/// @throw QueryRuntimeException if the percentage isn't a number in (0, 100].
+std::optional<double> EvaluateSampleFraction(ExpressionVisitor<TypedValue> &eval, Expression *expr);
+
 std::optional<size_t> EvaluateMemoryLimit(ExpressionVisitor<TypedValue> &eval, Expression *memory_limit,
                                           size_t memory_scale);
 }  // namespace memgraph::query
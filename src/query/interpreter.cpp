@@ -106,6 +106,7 @@
 #include "utils/flag_validation.hpp"
 #include "utils/functional.hpp"
 #include "utils/likely.hpp"
+#include "utils/lock_profile.hpp"
 #include "utils/logging.hpp"
 #include "utils/memory.hpp"
 #include "utils/memory_tracker.hpp"
@@ -144,10 +145,13 @@ extern const Event ShowSchema;
 }  // namespace memgraph::metrics
 
 void memgraph::query::CurrentDB::SetupDatabaseTransaction(
-    std::optional<storage::IsolationLevel> override_isolation_level, bool could_commit, bool unique) {
+    std::optional<storage::IsolationLevel> override_isolation_level, bool could_commit, bool unique,
+    bool replica_read) {
   auto &db_acc = *db_acc_;
   if (unique) {
     db_transactional_accessor_ = db_acc->UniqueAccess(override_isolation_level);
+  } else if (replica_read) {
+    db_transactional_accessor_ = db_acc->ReplicaReadAccess(override_isolation_level);
   } else {
     db_transactional_accessor_ = db_acc->Access(override_isolation_level);
   }
@@ -157,6 +161,17 @@ void memgraph::query::CurrentDB::SetupDatabaseTransaction(
     trigger_context_collector_.emplace(db_acc->trigger_store()->GetEventTypes());
   }
 }
+void memgraph::query::CurrentDB::SetupHistoricalTransaction(std::chrono::system_clock::time_point as_of) {
+  auto &db_acc = *db_acc_;
+  auto maybe_accessor = db_acc->storage()->AccessAsOf(as_of);
+  if (maybe_accessor.HasError()) {
+    throw QueryRuntimeException(
+        "The graph at the requested time isn't retained. AS OF reads require --storage-gc-history-retention-sec and "
+        "can't go further back than the retention window.");
+  }
+  db_transactional_accessor_ = std::move(maybe_accessor.GetValue());
+  execution_db_accessor_.emplace(db_transactional_accessor_.get());
+}
 void memgraph::query::CurrentDB::CleanupDBTransaction(bool abort) {
   if (abort && db_transactional_accessor_) {
     db_transactional_accessor_->Abort();
@@ -202,6 +217,46 @@ void Sort(std::vector<TypedValue, K> &vec) {
 // NOLINTNEXTLINE (misc-unused-parameters)
 [[maybe_unused]] bool Same(const std::string &lv, const std::string &rv) { return lv == rv; }
 
+// The Cypher query whose pre-query directives apply to `query`
+CypherQuery *DirectivesCypherQuery(Query *query) {
+  if (auto *cypher_query = utils::Downcast<CypherQuery>(query)) return cypher_query;
+  if (auto *explain_query = utils::Downcast<ExplainQuery>(query)) return explain_query->cypher_query_;
+  if (auto *profile_query = utils::Downcast<ProfileQuery>(query)) return profile_query->cypher_query_;
+  return nullptr;
+}
+
+std::chrono::system_clock::time_point EvaluateAsOf(Expression *as_of, const Parameters &parameters) {
+  EvaluationContext evaluation_context;
+  evaluation_context.timestamp = QueryTimestamp();
+  evaluation_context.parameters = parameters;
+  auto evaluator = PrimitiveLiteralExpressionEvaluator{evaluation_context};
+  auto const value = as_of->Accept(evaluator);
+
+  auto since_epoch = std::invoke([&]() -> std::chrono::microseconds {
+    switch (value.type()) {
+      case TypedValue::Type::Int:
+        return std::chrono::microseconds{value.ValueInt()};
+      case TypedValue::Type::String:
+        try {
+          auto const [date, local_time] = utils::ParseLocalDateTimeParameters(value.ValueString());
+          return std::chrono::microseconds{utils::LocalDateTime{date, local_time}.SysMicrosecondsSinceEpoch()};
+        } catch (const utils::BasicException &e) {
+          throw QueryRuntimeException("Invalid AS OF date and time: {}", e.what());
+        }
+      case TypedValue::Type::LocalDateTime:
+        return std::chrono::microseconds{value.ValueLocalDateTime().SysMicrosecondsSinceEpoch()};
+      case TypedValue::Type::ZonedDateTime:
+        return value.ValueZonedDateTime().SysMicrosecondsSinceEpoch();
+      default:
+        throw QueryRuntimeException(
+            "AS OF should be microseconds since the Unix epoch, a date and time string, a LocalDateTime or a "
+            "ZonedDateTime.");
+    }
+  });
+  return std::chrono::system_clock::time_point{
+      std::chrono::duration_cast<std::chrono::system_clock::duration>(since_epoch)};
+}
+
 void UpdateTypeCount(const plan::ReadWriteTypeChecker::RWType type) {
   switch (type) {
     case plan::ReadWriteTypeChecker::RWType::R:
@@ -2274,6 +2329,17 @@ PreparedQuery PrepareCypherQuery(ParsedQuery parsed_query, std::map<std::string,
     spdlog::debug("Running query with hops limit of {}", *hops_limit);
   }
 
+  const auto sample_fraction =
+      EvaluateSampleFraction(evaluator, cypher_query->pre_query_directives_.sample_percentage_);
+  if (sample_fraction && *sample_fraction < 1.0) {
+    notifications->emplace_back(
+        SeverityLevel::INFO, NotificationCode::SAMPLED_RESULTS,
+        fmt::format("Scans only read about {}% of the vertices, so the results are estimates. COUNT and SUM are "
+                    "scaled up by the sampled fraction p = {} for each sampled scan. For a count N over a single "
+                    "scan, the 95% confidence interval is approximately N +/- 1.96 * sqrt(N * (1 - p) / p).",
+                    *sample_fraction * 100.0, *sample_fraction));
+  }
+
   auto clauses = cypher_query->single_query_->clauses_;
   if (std::any_of(clauses.begin(), clauses.end(),
                   [](const auto *clause) { return clause->GetTypeInfo() == LoadCsv::kType; })) {
@@ -4405,6 +4471,28 @@ PreparedQuery PrepareSystemInfoQuery(ParsedQuery parsed_query, bool in_explicit_
         return std::pair{results, QueryHandlerResult::NOTHING};
       };
     } break;
+    case SystemInfoQuery::InfoType::LOCK_STATISTICS: {
+      if (!utils::LockProfilingEnabled()) {
+        throw QueryRuntimeException(
+            "Lock profiling is disabled. To enable it, restart your instance and set the lock-contention-profiling "
+            "flag to True.");
+      }
+      header = {"lock",        "acquisitions", "contentions", "wait_total_us",
+                "wait_max_us", "wait_p50_us",  "wait_p90_us", "wait_p99_us"};
+      handler = [] {
+        std::vector<std::vector<TypedValue>> results;
+        for (const auto &lock : utils::GetLockStatistics()) {
+          results.push_back({TypedValue(lock.name), TypedValue(static_cast<int64_t>(lock.acquisitions)),
+                             TypedValue(static_cast<int64_t>(lock.contentions)),
+                             TypedValue(static_cast<int64_t>(lock.wait_total_us)),
+                             TypedValue(static_cast<int64_t>(lock.wait_max_us)),
+                             TypedValue(static_cast<int64_t>(lock.wait_p50_us)),
+                             TypedValue(static_cast<int64_t>(lock.wait_p90_us)),
+                             TypedValue(static_cast<int64_t>(lock.wait_p99_us))});
+        }
+        return std::pair{results, QueryHandlerResult::NOTHING};
+      };
+    } break;
   }
 
   return PreparedQuery{std::move(header), std::move(parsed_query.required_privileges),
@@ -5240,6 +5328,13 @@ PreparedQuery PrepareShowSchemaInfoQuery(const ParsedQuery &parsed_query, Curren
 
 std::optional<uint64_t> Interpreter::GetTransactionId() const { return current_transaction_; }
 
+bool Interpreter::IsLastQueryReadOnlyAutocommit() const {
+  if (in_explicit_transaction_ || query_executions_.empty()) return false;
+  const auto &query_execution = query_executions_.back();
+  return query_execution && query_execution->prepared_query &&
+         query_execution->prepared_query->rw_type == RWType::R;
+}
+
 void Interpreter::BeginTransaction(QueryExtras const &extras) {
   ResetInterpreter();
   const auto prepared_query = PrepareTransactionQuery("BEGIN", extras);
@@ -5409,19 +5504,30 @@ Interpreter::PrepareResult Interpreter::Prepare(const std::string &query_string,
         utils::Downcast<DatabaseInfoQuery>(parsed_query.query) || utils::Downcast<ShowEnumsQuery>(parsed_query.query) ||
         utils::Downcast<ShowSchemaInfoQuery>(parsed_query.query);
 
-    if (!in_explicit_transaction_ && requires_db_transaction) {
-      // TODO: ATM only a single database, will change when we have multiple database transactions
-      bool could_commit = utils::Downcast<CypherQuery>(parsed_query.query) != nullptr;
-      bool const unique = unique_db_transaction || is_schema_assert_query;
-      SetupDatabaseTransaction(could_commit, unique);
-    }
-
     if (current_db_.db_acc_) {
       // fix parameters, enums requires storage to map to correct enum value
       parsed_query.user_parameters = params_getter(current_db_.db_acc_->get()->storage());
       parsed_query.parameters = PrepareQueryParameters(parsed_query.stripped_query, parsed_query.user_parameters);
     }
 
+    auto *directives_query = DirectivesCypherQuery(parsed_query.query);
+    bool const as_of_query = directives_query && directives_query->pre_query_directives_.as_of_;
+    if (as_of_query && in_explicit_transaction_) {
+      throw QueryException("AS OF can't be used in explicit transactions.");
+    }
+
+    if (!in_explicit_transaction_ && requires_db_transaction) {
+      if (as_of_query) {
+        current_db_.SetupHistoricalTransaction(
+            EvaluateAsOf(directives_query->pre_query_directives_.as_of_, parsed_query.parameters));
+      } else {
+        // TODO: ATM only a single database, will change when we have multiple database transactions
+        bool could_commit = utils::Downcast<CypherQuery>(parsed_query.query) != nullptr;
+        bool const unique = unique_db_transaction || is_schema_assert_query;
+        SetupDatabaseTransaction(could_commit, unique);
+      }
+    }
+
 #ifdef MG_ENTERPRISE
     // TODO(antoniofilipovic) extend to cover Lab queries
     if (interpreter_context_->coordinator_state_ && interpreter_context_->coordinator_state_->get().IsCoordinator() &&
@@ -5614,6 +5720,10 @@ Interpreter::PrepareResult Interpreter::Prepare(const std::string &query_string,
         query_execution = nullptr;
         throw WriteQueryOnReplicaException();
       }
+      if (as_of_query) {
+        query_execution = nullptr;
+        throw WriteQueryAsOfException();
+      }
 #ifdef MG_ENTERPRISE
       if (interpreter_context_->coordinator_state_.has_value() &&
           interpreter_context_->coordinator_state_->get().IsDataInstance() &&
@@ -5650,7 +5760,10 @@ Interpreter::PrepareResult Interpreter::Prepare(const std::string &query_string,
 }
 
 void Interpreter::SetupDatabaseTransaction(bool couldCommit, bool unique) {
-  current_db_.SetupDatabaseTransaction(GetIsolationLevelOverride(), couldCommit, unique);
+  // Replicas only run read queries, writes are rejected before they execute. Stable epoch reads block replication
+  // for as long as the transaction is open, so an idle explicit transaction reads through MVCC instead.
+  current_db_.SetupDatabaseTransaction(GetIsolationLevelOverride(), couldCommit, unique,
+                                       interpreter_context_->repl_state->IsReplica() && !in_explicit_transaction_);
 }
 
 void Interpreter::SetupInterpreterTransaction(const QueryExtras &extras) {
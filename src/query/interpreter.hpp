@@ -219,7 +219,9 @@ struct CurrentDB {
   CurrentDB &operator=(CurrentDB const &) = delete;
 
   void SetupDatabaseTransaction(std::optional<storage::IsolationLevel> override_isolation_level, bool could_commit,
-                                bool unique = false);
+                                bool unique = false, bool replica_read = false);
+  /// Starts a read-only transaction that observes the graph as it was at `as_of`.
+  void SetupHistoricalTransaction(std::chrono::system_clock::time_point as_of);
   void CleanupDBTransaction(bool abort);
   void SetCurrentDB(memgraph::dbms::DatabaseAccess new_db, bool in_explicit_db) {
     // do we lock here?
@@ -352,6 +354,13 @@ class Interpreter final {
   std::map<std::string, TypedValue> Pull(TStream *result_stream, std::optional<int> n = {},
                                          std::optional<int> qid = {});
 
+  /**
+   * Returns true if the last prepared query only reads and runs in an implicit
+   * transaction, i.e. the rest of its results can be pulled at once and the
+   * transaction finished before the client consumed them.
+   */
+  bool IsLastQueryReadOnlyAutocommit() const;
+
   void BeginTransaction(QueryExtras const &extras = {});
 
   std::optional<uint64_t> GetTransactionId() const;
@@ -66,6 +66,8 @@ constexpr std::string_view GetCodeString(const NotificationCode code) {
       return "PlanHinting"sv;
     case NotificationCode::REGISTER_REPLICA:
       return "RegisterReplica"sv;
+    case NotificationCode::SAMPLED_RESULTS:
+      return "SampledResults"sv;
 #ifdef MG_ENTERPRISE
     case NotificationCode::REGISTER_REPLICATION_INSTANCE:
       return "RegisterReplicationInstance"sv;
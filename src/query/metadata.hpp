@@ -42,6 +42,7 @@ enum class NotificationCode : uint8_t {
   PLAN_HINTING,
   REPLICA_PORT_WARNING,
   REGISTER_REPLICA,
+  SAMPLED_RESULTS,
 #ifdef MG_ENTERPRISE
   REGISTER_REPLICATION_INSTANCE,
   ADD_COORDINATOR_INSTANCE,
@@ -13,6 +13,7 @@
 
 #include <algorithm>
 #include <cctype>
+#include <cmath>
 #include <cstdint>
 #include <limits>
 #include <optional>
@@ -57,6 +58,7 @@
 #include "utils/event_counter.hpp"
 #include "utils/exceptions.hpp"
 #include "utils/fnv.hpp"
+#include "utils/hyperloglog.hpp"
 #include "utils/java_string_formatter.hpp"
 #include "utils/likely.hpp"
 #include "utils/logging.hpp"
@@ -516,7 +518,7 @@ class ScanAllCursor : public Cursor {
 
     AbortCheck(context);
 
-    while (!vertices_ || vertices_it_.value() == vertices_end_it_.value()) {
+    while (!vertices_ || vertices_it_.value() == vertices_end_it_.value() || !SkipUnsampled(frame, context)) {
       if (!input_cursor_->Pull(frame, context)) return false;
       // We need a getter function, because in case of exhausting a lazy
       // iterable, we cannot simply reset it by calling begin().
@@ -563,6 +565,27 @@ class ScanAllCursor : public Cursor {
   }
 
  private:
+  /// When sampling, skips the vertices which aren't in the sample and returns
+  /// false if the current vertices were exhausted. The gaps between sampled
+  /// vertices are geometrically distributed, so a single random number is
+  /// drawn for each sampled vertex instead of one for every scanned vertex.
+  bool SkipUnsampled(Frame &frame, ExecutionContext &context) {
+    if (!self_.sample_percentage_) return true;
+    if (!sample_fraction_) {
+      ExpressionEvaluator evaluator(&frame, context.symbol_table, context.evaluation_context, context.db_accessor,
+                                    storage::View::OLD);
+      sample_fraction_ = EvaluateSampleFraction(evaluator, self_.sample_percentage_);
+      // Sampling 100% produces every vertex, there are no gaps to draw.
+      if (*sample_fraction_ < 1.0) sample_gaps_.emplace(*sample_fraction_);
+    }
+    if (!sample_gaps_) return true;
+    for (auto skip = (*sample_gaps_)(random_); skip > 0; --skip) {
+      ++vertices_it_.value();
+      if (vertices_it_.value() == vertices_end_it_.value()) return false;
+    }
+    return true;
+  }
+
   const ScanAll &self_;
   const Symbol output_symbol_;
   const UniqueCursorPtr input_cursor_;
@@ -572,6 +595,9 @@ class ScanAllCursor : public Cursor {
   std::optional<decltype(vertices_.value().begin())> vertices_it_;
   std::optional<decltype(vertices_.value().end())> vertices_end_it_;
   const char *op_name_;
+  std::optional<double> sample_fraction_;
+  std::optional<std::geometric_distribution<uint64_t>> sample_gaps_;
+  std::mt19937_64 random_{std::random_device{}()};
 };
 template <typename TEdgesFun>
 class ScanAllByEdgeCursor : public Cursor {
@@ -1119,11 +1145,12 @@ std::vector<Symbol> Expand::ModifiedSymbols(const SymbolTable &table) const {
 
 std::string Expand::ToString() const {
   return fmt::format(
-      "Expand ({}){}[{}{}]{}({})", input_symbol_.name(),
+      "Expand ({}){}[{}{}]{}({}){}", input_symbol_.name(),
       common_.direction == query::EdgeAtom::Direction::IN ? "<-" : "-", common_.edge_symbol.name(),
       utils::IterableToString(common_.edge_types, "|",
                               [this](const auto &edge_type) { return ":" + dba_->EdgeTypeToName(edge_type); }),
-      common_.direction == query::EdgeAtom::Direction::OUT ? "->" : "-", common_.node_symbol.name());
+      common_.direction == query::EdgeAtom::Direction::OUT ? "->" : "-", common_.node_symbol.name(),
+      edge_filter_ ? " with edge filter" : "");
 }
 
 Expand::ExpandCursor::ExpandCursor(const Expand &self, utils::MemoryResource *mem)
@@ -1168,6 +1195,7 @@ bool Expand::ExpandCursor::Pull(Frame &frame, ExecutionContext &context) {
 #endif
 
       frame[self_.common_.edge_symbol] = edge;
+      if (!EdgeFilterHolds(frame, context)) continue;
       pull_node(edge, utils::tag_v<EdgeAtom::Direction::IN>);
       return true;
     }
@@ -1188,6 +1216,7 @@ bool Expand::ExpandCursor::Pull(Frame &frame, ExecutionContext &context) {
       }
 #endif
       frame[self_.common_.edge_symbol] = edge;
+      if (!EdgeFilterHolds(frame, context)) continue;
       pull_node(edge, utils::tag_v<EdgeAtom::Direction::OUT>);
       return true;
     }
@@ -1200,6 +1229,15 @@ bool Expand::ExpandCursor::Pull(Frame &frame, ExecutionContext &context) {
   }
 }
 
+bool Expand::ExpandCursor::EdgeFilterHolds(Frame &frame, ExecutionContext &context) const {
+  if (!self_.edge_filter_) return true;
+  // Like all filters, newly set values should not affect filtering of old
+  // nodes and edges.
+  ExpressionEvaluator evaluator(&frame, context.symbol_table, context.evaluation_context, context.db_accessor,
+                                storage::View::OLD, context.frame_change_collector);
+  return EvaluateFilter(evaluator, self_.edge_filter_);
+}
+
 void Expand::ExpandCursor::Shutdown() { input_cursor_->Shutdown(); }
 
 void Expand::ExpandCursor::Reset() {
@@ -3956,12 +3994,14 @@ class AccumulateCursor : public Cursor {
 
     AbortCheck(context);
     if (cache_it_ == cache_.end()) return false;
+    // Every cached row is placed on the frame exactly once, so it's moved out
+    // of the cache instead of being copied.
     auto row_it = (cache_it_++)->begin();
     for (const Symbol &symbol : self_.symbols_) {
       if (context.frame_change_collector && context.frame_change_collector->IsKeyTracked(symbol.name())) {
         context.frame_change_collector->ResetTrackingValue(symbol.name());
       }
-      frame[symbol] = *row_it++;
+      frame[symbol] = std::move(*row_it++);
     }
     return true;
   }
@@ -4017,6 +4057,7 @@ TypedValue DefaultAggregationOpValue(const Aggregate::Element &element, utils::M
       return TypedValue(memory);
     case Aggregation::Op::COUNT:
     case Aggregation::Op::SUM:
+    case Aggregation::Op::APPROX_COUNT_DISTINCT:
       return TypedValue(0, memory);
     case Aggregation::Op::COLLECT_LIST:
       return TypedValue(TypedValue::TVector(memory));
@@ -4067,14 +4108,15 @@ class AggregateCursor : public Cursor {
     }
     if (aggregation_it_ == aggregation_.end()) return false;
 
-    // place aggregation values on the frame
+    // place aggregation values on the frame, each group is output exactly once
+    // so its values are moved instead of copied
     auto aggregation_values_it = aggregation_it_->second.values_.begin();
     for (const auto &aggregation_elem : self_.aggregations_)
-      frame[aggregation_elem.output_sym] = *aggregation_values_it++;
+      frame[aggregation_elem.output_sym] = std::move(*aggregation_values_it++);
 
     // place remember values on the frame
     auto remember_values_it = aggregation_it_->second.remember_.begin();
-    for (const Symbol &remember_sym : self_.remember_) frame[remember_sym] = *remember_values_it++;
+    for (const Symbol &remember_sym : self_.remember_) frame[remember_sym] = std::move(*remember_values_it++);
 
     aggregation_it_++;
     return true;
@@ -4090,13 +4132,60 @@ class AggregateCursor : public Cursor {
   }
 
  private:
+  // Running total of SUM and AVG, kept as a native int64_t until a double is
+  // added or the integer sum overflows, after which it continues as a double.
+  // Values are converted the same way TypedValue arithmetic converts them, but
+  // without the type dispatch and TypedValue construction for every input row.
+  struct NumericSum {
+    int64_t int_sum{0};
+    double double_sum{0.0};
+    bool is_double{false};
+
+    void Set(const TypedValue &value) {
+      is_double = value.IsDouble();
+      if (is_double) {
+        double_sum = value.ValueDouble();
+      } else {
+        int_sum = value.ValueInt();
+      }
+    }
+
+    void Add(const TypedValue &value) {
+      if (value.IsDouble()) {
+        if (!is_double) {
+          double_sum = static_cast<double>(int_sum);
+          is_double = true;
+        }
+        double_sum += value.ValueDouble();
+        return;
+      }
+      if (is_double) {
+        double_sum += static_cast<double>(value.ValueInt());
+        return;
+      }
+      int64_t result = 0;
+      if (__builtin_add_overflow(int_sum, value.ValueInt(), &result)) {
+        double_sum = static_cast<double>(int_sum) + static_cast<double>(value.ValueInt());
+        is_double = true;
+        return;
+      }
+      int_sum = result;
+    }
+
+    double AsDouble() const { return is_double ? double_sum : static_cast<double>(int_sum); }
+
+    TypedValue ToTypedValue(utils::MemoryResource *memory) const {
+      return is_double ? TypedValue(double_sum, memory) : TypedValue(int_sum, memory);
+    }
+  };
+
   // Data structure for a single aggregation cache.
   // Does NOT include the group-by values since those are a key in the
   // aggregation map. The vectors in an AggregationValue contain one element for
   // each aggregation in this LogicalOp.
   struct AggregationValue {
     explicit AggregationValue(utils::MemoryResource *mem)
-        : counts_(mem), values_(mem), remember_(mem), unique_values_(mem) {}
+        : counts_(mem), values_(mem), remember_(mem), unique_values_(mem), sums_(mem), sketches_(mem) {}
 
     // how many input rows have been aggregated in respective values_ element so
     // far
@@ -4113,6 +4202,10 @@ class AggregateCursor : public Cursor {
     using TSet = utils::pmr::unordered_set<TypedValue, TypedValue::Hash, TypedValue::BoolEqual>;
 
     utils::pmr::vector<TSet> unique_values_;
+    // running SUM and AVG totals, converted to values_ in post-processing
+    utils::pmr::vector<NumericSum> sums_;
+    // APPROX_COUNT_DISTINCT sketches, they only allocate once used
+    utils::pmr::vector<utils::HyperLogLog> sketches_;
   };
 
   const Aggregate &self_;
@@ -4135,6 +4228,17 @@ class AggregateCursor : public Cursor {
   // this switch tracks if this has been performed
   bool pulled_all_input_{false};
 
+  /// Scales a sampled COUNT or SUM up to the estimate over all of the
+  /// vertices, integers stay integers.
+  static void ScaleSample(TypedValue *value, double scale) {
+    if (value->IsInt()) {
+      *value = TypedValue(static_cast<int64_t>(std::llround(static_cast<double>(value->ValueInt()) * scale)),
+                          value->GetMemoryResource());
+    } else {
+      *value = TypedValue(value->ValueDouble() * scale, value->GetMemoryResource());
+    }
+  }
+
   /**
    * Pulls from the input operator until exhausted and aggregates the
    * results. If the input operator is not provided, a single call
@@ -4155,8 +4259,17 @@ class AggregateCursor : public Cursor {
     }
     if (!pulled) return false;
 
+    // Sampled scans produced only a part of the vertices, so the counts and
+    // sums are scaled up to estimate the ones over all of the vertices.
+    std::optional<double> sample_scale;
+    if (self_.sample_percentage_ && self_.sampled_scans_ > 0) {
+      const auto fraction = *EvaluateSampleFraction(evaluator, self_.sample_percentage_);
+      if (fraction < 1.0) sample_scale = std::pow(1.0 / fraction, static_cast<double>(self_.sampled_scans_));
+    }
+
     // post processing
     for (size_t pos = 0; pos < self_.aggregations_.size(); ++pos) {
+      const auto scale = self_.aggregations_[pos].distinct ? std::nullopt : sample_scale;
       switch (self_.aggregations_[pos].op) {
         case Aggregation::Op::AVG: {
           // calculate AVG aggregations (so far they have only been summed)
@@ -4165,7 +4278,18 @@ class AggregateCursor : public Cursor {
             auto count = agg_value.counts_[pos];
             auto *pull_memory = context->evaluation_context.memory;
             if (count > 0) {
-              agg_value.values_[pos] = agg_value.values_[pos] / TypedValue(static_cast<double>(count), pull_memory);
+              agg_value.values_[pos] =
+                  TypedValue(agg_value.sums_[pos].AsDouble() / static_cast<double>(count), pull_memory);
+            }
+          }
+          break;
+        }
+        case Aggregation::Op::SUM: {
+          for (auto &kv : aggregation_) {
+            AggregationValue &agg_value = kv.second;
+            if (agg_value.counts_[pos] > 0) {
+              agg_value.values_[pos] = agg_value.sums_[pos].ToTypedValue(context->evaluation_context.memory);
+              if (scale) ScaleSample(&agg_value.values_[pos], *scale);
             }
           }
           break;
@@ -4175,12 +4299,19 @@ class AggregateCursor : public Cursor {
           for (auto &kv : aggregation_) {
             AggregationValue &agg_value = kv.second;
             agg_value.values_[pos] = agg_value.counts_[pos];
+            if (scale) ScaleSample(&agg_value.values_[pos], *scale);
+          }
+          break;
+        }
+        case Aggregation::Op::APPROX_COUNT_DISTINCT: {
+          for (auto &kv : aggregation_) {
+            AggregationValue &agg_value = kv.second;
+            agg_value.values_[pos] = static_cast<int64_t>(agg_value.sketches_[pos].Estimate());
           }
           break;
         }
         case Aggregation::Op::MIN:
         case Aggregation::Op::MAX:
-        case Aggregation::Op::SUM:
         case Aggregation::Op::COLLECT_LIST:
         case Aggregation::Op::COLLECT_MAP:
         case Aggregation::Op::PROJECT:
@@ -4218,13 +4349,16 @@ class AggregateCursor : public Cursor {
     const auto num_of_aggregations = self_.aggregations_.size();
     agg_value->values_.reserve(num_of_aggregations);
     agg_value->unique_values_.reserve(num_of_aggregations);
+    agg_value->sketches_.reserve(num_of_aggregations);
 
     auto *mem = agg_value->values_.get_allocator().GetMemoryResource();
     for (const auto &agg_elem : self_.aggregations_) {
       agg_value->values_.emplace_back(DefaultAggregationOpValue(agg_elem, mem));
       agg_value->unique_values_.emplace_back(AggregationValue::TSet(mem));
+      agg_value->sketches_.emplace_back(mem);
     }
     agg_value->counts_.resize(num_of_aggregations, 0);
+    agg_value->sums_.resize(num_of_aggregations);
 
     agg_value->remember_.reserve(self_.remember_.size());
     for (const Symbol &remember_sym : self_.remember_) {
@@ -4245,9 +4379,12 @@ class AggregateCursor : public Cursor {
     auto count_it = agg_value->counts_.begin();
     auto value_it = agg_value->values_.begin();
     auto unique_values_it = agg_value->unique_values_.begin();
+    auto sum_it = agg_value->sums_.begin();
+    auto sketch_it = agg_value->sketches_.begin();
     auto agg_elem_it = self_.aggregations_.begin();
     const auto counts_end = agg_value->counts_.end();
-    for (; count_it != counts_end; ++count_it, ++value_it, ++unique_values_it, ++agg_elem_it) {
+    for (; count_it != counts_end;
+         ++count_it, ++value_it, ++unique_values_it, ++sum_it, ++sketch_it, ++agg_elem_it) {
       // COUNT(*) is the only case where input expression is optional
       // handle it here
       auto input_expr_ptr = agg_elem_it->value;
@@ -4262,6 +4399,11 @@ class AggregateCursor : public Cursor {
       // Aggregations skip Null input values.
       if (input_value.IsNull()) continue;
       const auto &agg_op = agg_elem_it->op;
+      if (agg_op == Aggregation::Op::APPROX_COUNT_DISTINCT) {
+        // Duplicates don't change the sketch, so DISTINCT doesn't need the exact set of values.
+        sketch_it->Add(TypedValue::Hash{}(input_value));
+        continue;
+      }
       if (agg_elem_it->distinct) {
         auto insert_result = unique_values_it->insert(input_value);
         if (!insert_result.second) {
@@ -4280,9 +4422,10 @@ class AggregateCursor : public Cursor {
           case Aggregation::Op::SUM:
           case Aggregation::Op::AVG:
             EnsureOkForAvgSum(input_value);
-            *value_it = std::move(input_value);
+            sum_it->Set(input_value);
             break;
           case Aggregation::Op::COUNT:
+          case Aggregation::Op::APPROX_COUNT_DISTINCT:
             // value is deferred to post-processing
             break;
           case Aggregation::Op::COLLECT_LIST:
@@ -4305,6 +4448,7 @@ class AggregateCursor : public Cursor {
       // aggregation of existing values
       switch (agg_op) {
         case Aggregation::Op::COUNT:
+        case Aggregation::Op::APPROX_COUNT_DISTINCT:
           // value is deferred to post-processing
           break;
         case Aggregation::Op::MIN: {
@@ -4336,7 +4480,7 @@ class AggregateCursor : public Cursor {
         // the input has been processed
         case Aggregation::Op::SUM:
           EnsureOkForAvgSum(input_value);
-          *value_it = *value_it + input_value;
+          sum_it->Add(input_value);
           break;
         case Aggregation::Op::COLLECT_LIST:
           value_it->ValueList().push_back(std::move(input_value));
@@ -5047,9 +5191,12 @@ class CartesianCursor : public Cursor {
     SCOPED_PROFILE_OP_BY_REF(self_);
 
     if (!cartesian_pull_initialized_) {
-      // Pull all left_op frames.
+      // Pull all left_op frames, keeping only the values of the symbols which
+      // are restored later on.
       while (left_op_cursor_->Pull(frame, context)) {
-        left_op_frames_.emplace_back(frame.elems().begin(), frame.elems().end());
+        auto &row = left_op_frames_.emplace_back();
+        row.reserve(self_.left_symbols_.size());
+        for (const auto &symbol : self_.left_symbols_) row.emplace_back(frame[symbol]);
       }
 
       // We're setting the iterator to 'end' here so it pulls the right
@@ -5064,8 +5211,9 @@ class CartesianCursor : public Cursor {
     }
 
     auto restore_frame = [&frame, &context](const auto &symbols, const auto &restore_from) {
+      auto value_it = restore_from.begin();
       for (const auto &symbol : symbols) {
-        frame[symbol] = restore_from[symbol.position()];
+        frame[symbol] = *value_it++;
         if (context.frame_change_collector && context.frame_change_collector->IsKeyTracked(symbol.name())) {
           context.frame_change_collector->ResetTrackingValue(symbol.name());
         }
@@ -5076,7 +5224,8 @@ class CartesianCursor : public Cursor {
       // Advance right_op_cursor_.
       if (!right_op_cursor_->Pull(frame, context)) return false;
 
-      right_op_frame_.assign(frame.elems().begin(), frame.elems().end());
+      right_op_frame_.clear();
+      for (const auto &symbol : self_.right_symbols_) right_op_frame_.emplace_back(frame[symbol]);
       left_op_frames_it_ = left_op_frames_.begin();
     } else {
       // Make sure right_op_cursor last pulled results are on frame.
@@ -5853,7 +6002,8 @@ Apply::ApplyCursor::ApplyCursor(const Apply &self, utils::MemoryResource *mem)
     : self_(self),
       input_(self.input_->MakeCursor(mem)),
       subquery_(self.subquery_->MakeCursor(mem)),
-      subquery_has_return_(self.subquery_has_return_) {}
+      subquery_has_return_(self.subquery_has_return_),
+      cache_(self.memoization_limit_, mem) {}
 
 std::vector<Symbol> Apply::ModifiedSymbols(const SymbolTable &table) const {
   // Since Apply is the Cartesian product, modified symbols are combined from
@@ -5868,12 +6018,44 @@ bool Apply::ApplyCursor::Pull(Frame &frame, ExecutionContext &context) {
   OOMExceptionEnabler oom_exception;
   SCOPED_PROFILE_OP("Apply");
 
+  auto *memory = cache_.GetMemoryResource();
   while (true) {
-    if (pull_input_ && !input_->Pull(frame, context)) {
-      return false;
-    };
+    if (pull_input_) {
+      if (!input_->Pull(frame, context)) return false;
+      if (cache_.Enabled()) {
+        SubqueryCache::Row key(memory);
+        key.reserve(self_.memoization_symbols_.size());
+        for (const auto &symbol : self_.memoization_symbols_) key.emplace_back(frame[symbol]);
+        if (SubqueryCache::IsValidKey(key)) {
+          cached_rows_ = cache_.Find(key);
+          cached_row_ = 0;
+          if (!cached_rows_ && cache_.CanInsert(0)) recording_.emplace(std::move(key), SubqueryCache::Rows(memory));
+        }
+      }
+    }
+
+    if (cached_rows_) {
+      // Only subqueries with a return are memoized, so an input row without
+      // results is skipped
+      pull_input_ = cached_row_ == cached_rows_->size();
+      if (pull_input_) {
+        cached_rows_ = nullptr;
+        continue;
+      }
+      const auto &row = (*cached_rows_)[cached_row_++];
+      for (size_t i = 0; i < row.size(); ++i) frame[self_.subquery_symbols_[i]] = row[i];
+      return true;
+    }
 
     if (subquery_->Pull(frame, context)) {
+      if (recording_ && cache_.CanInsert(recording_->second.size() + 1)) {
+        SubqueryCache::Row row(memory);
+        row.reserve(self_.subquery_symbols_.size());
+        for (const auto &symbol : self_.subquery_symbols_) row.emplace_back(frame[symbol]);
+        recording_->second.push_back(std::move(row));
+      } else {
+        recording_.reset();
+      }
       // if successful, next Pull from this should not pull_input_
       pull_input_ = false;
       return true;
@@ -5882,6 +6064,11 @@ bool Apply::ApplyCursor::Pull(Frame &frame, ExecutionContext &context) {
     // skip that row
     pull_input_ = true;
     subquery_->Reset();
+    if (recording_) {
+      const auto rows = recording_->second.size();
+      cache_.Insert(std::move(recording_->first), std::move(recording_->second), rows);
+      recording_.reset();
+    }
 
     // don't skip row if no rows are returned from subquery, return input_ rows
     if (!subquery_has_return_) return true;
@@ -5897,6 +6084,9 @@ void Apply::ApplyCursor::Reset() {
   input_->Reset();
   subquery_->Reset();
   pull_input_ = true;
+  // The memoized results stay valid, they only depend on the key
+  cached_rows_ = nullptr;
+  recording_.reset();
 }
 
 IndexedJoin::IndexedJoin(const std::shared_ptr<LogicalOperator> main_branch,
@@ -6006,8 +6196,9 @@ class HashJoinCursor : public Cursor {
     }
 
     auto restore_frame = [&frame, &context](const auto &symbols, const auto &restore_from) {
+      auto value_it = restore_from.begin();
       for (const auto &symbol : symbols) {
-        frame[symbol] = restore_from[symbol.position()];
+        frame[symbol] = *value_it++;
         if (context.frame_change_collector && context.frame_change_collector->IsKeyTracked(symbol.name())) {
           context.frame_change_collector->ResetTrackingValue(symbol.name());
         }
@@ -6024,12 +6215,14 @@ class HashJoinCursor : public Cursor {
         ExpressionEvaluator evaluator(&frame, context.symbol_table, context.evaluation_context, context.db_accessor,
                                       storage::View::OLD);
         auto right_value = self_.hash_join_condition_->expression2_->Accept(evaluator);
-        if (hashtable_.contains(right_value)) {
+        auto left_frames = hashtable_.find(right_value);
+        if (left_frames != hashtable_.end()) {
           // If so, finish pulling for now and proceed to joining the pulled frame
-          right_op_frame_.assign(frame.elems().begin(), frame.elems().end());
+          right_op_frame_.clear();
+          for (const auto &symbol : self_.right_symbols_) right_op_frame_.emplace_back(frame[symbol]);
           common_value_found_ = true;
-          common_value = right_value;
-          left_op_frame_it_ = hashtable_[common_value].begin();
+          left_op_frame_it_ = left_frames->second.begin();
+          left_op_frame_end_ = left_frames->second.end();
           break;
         }
       }
@@ -6043,7 +6236,7 @@ class HashJoinCursor : public Cursor {
     left_op_frame_it_++;
     // When all left frames with the common value have been joined, move on to pulling and joining the next right
     // frame
-    if (common_value_found_ && left_op_frame_it_ == hashtable_[common_value].end()) {
+    if (common_value_found_ && left_op_frame_it_ == left_op_frame_end_) {
       common_value_found_ = false;
     }
 
@@ -6061,19 +6254,23 @@ class HashJoinCursor : public Cursor {
     hashtable_.clear();
     right_op_frame_.clear();
     left_op_frame_it_ = {};
+    left_op_frame_end_ = {};
     hash_join_initialized_ = false;
     common_value_found_ = false;
   }
 
  private:
   void InitializeHashJoin(Frame &frame, ExecutionContext &context) {
-    // Pull all left_op_ frames
+    // Pull all left_op_ frames, keeping only the values of the symbols which
+    // are restored later on
     while (left_op_cursor_->Pull(frame, context)) {
       ExpressionEvaluator evaluator(&frame, context.symbol_table, context.evaluation_context, context.db_accessor,
                                     storage::View::OLD);
       auto left_value = self_.hash_join_condition_->expression1_->Accept(evaluator);
       if (left_value.type() != TypedValue::Type::Null) {
-        hashtable_[left_value].emplace_back(frame.elems().begin(), frame.elems().end());
+        auto &row = hashtable_.try_emplace(std::move(left_value)).first->second.emplace_back();
+        row.reserve(self_.left_symbols_.size());
+        for (const auto &symbol : self_.left_symbols_) row.emplace_back(frame[symbol]);
       }
     }
   }
@@ -6086,9 +6283,9 @@ class HashJoinCursor : public Cursor {
       hashtable_;
   utils::pmr::vector<TypedValue> right_op_frame_;
   utils::pmr::vector<utils::pmr::vector<TypedValue>>::iterator left_op_frame_it_;
+  utils::pmr::vector<utils::pmr::vector<TypedValue>>::iterator left_op_frame_end_;
   bool hash_join_initialized_{false};
   bool common_value_found_{false};
-  TypedValue common_value;
 };
 }  // namespace
 
@@ -6132,7 +6329,8 @@ class RollUpApplyCursor : public Cursor {
   RollUpApplyCursor(const RollUpApply &self, utils::MemoryResource *mem)
       : self_(self),
         input_cursor_(self.input_->MakeCursor(mem)),
-        list_collection_cursor_(self_.list_collection_branch_->MakeCursor(mem)) {
+        list_collection_cursor_(self_.list_collection_branch_->MakeCursor(mem)),
+        cache_(self.memoization_limit_, mem) {
     MG_ASSERT(input_cursor_ != nullptr, "RollUpApplyCursor: Missing left operator cursor.");
     MG_ASSERT(list_collection_cursor_ != nullptr, "RollUpApplyCursor: Missing right operator cursor.");
   }
@@ -6143,6 +6341,19 @@ class RollUpApplyCursor : public Cursor {
 
     TypedValue result(std::vector<TypedValue>(), context.evaluation_context.memory);
     if (input_cursor_->Pull(frame, context)) {
+      std::optional<SubqueryCache::Row> key;
+      if (cache_.Enabled()) {
+        key.emplace(cache_.GetMemoryResource());
+        key->reserve(self_.memoization_symbols_.size());
+        for (const auto &symbol : self_.memoization_symbols_) key->emplace_back(frame[symbol]);
+        if (!SubqueryCache::IsValidKey(*key)) {
+          key.reset();
+        } else if (const auto *cached = cache_.Find(*key)) {
+          frame[self_.result_symbol_] = cached->front().front();
+          return true;
+        }
+      }
+
       while (list_collection_cursor_->Pull(frame, context)) {
         // collect values from the list collection branch
         result.ValueList().emplace_back(frame[self_.list_collection_symbol_]);
@@ -6154,6 +6365,15 @@ class RollUpApplyCursor : public Cursor {
         context.frame_change_collector->ResetTrackingValue(self_.list_collection_symbol_.name());
       }
 
+      if (key && cache_.CanInsert(result.ValueList().size())) {
+        const auto size = result.ValueList().size();
+        SubqueryCache::Rows results(cache_.GetMemoryResource());
+        SubqueryCache::Row row(cache_.GetMemoryResource());
+        row.emplace_back(result);
+        results.push_back(std::move(row));
+        cache_.Insert(std::move(*key), std::move(results), size);
+      }
+
       frame[self_.result_symbol_] = result;
       // After a successful input from the list_collection_cursor_
       // reset state of cursor because it has to a Once at the beginning
@@ -6179,6 +6399,7 @@ class RollUpApplyCursor : public Cursor {
   const RollUpApply &self_;
   const UniqueCursorPtr input_cursor_;
   const UniqueCursorPtr list_collection_cursor_;
+  SubqueryCache cache_;
 };
 }  // namespace
 
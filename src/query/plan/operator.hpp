@@ -23,6 +23,7 @@
 #include "query/frontend/ast/ast.hpp"
 #include "query/frontend/semantic/symbol.hpp"
 #include "query/plan/preprocess.hpp"
+#include "query/plan/subquery_cache.hpp"
 #include "query/typed_value.hpp"
 #include "storage/v2/id_types.hpp"
 #include "utils/bound.hpp"
@@ -549,6 +550,10 @@ class ScanAll : public memgraph::query::plan::LogicalOperator {
   /// command. With @c storage::View::NEW, all vertices will be produced the current
   /// transaction sees along with their modifications.
   storage::View view_;
+  /// If set, each vertex is produced with the evaluated percentage
+  /// probability (`USING SAMPLE n PERCENT`), so only a random sample of the
+  /// vertices is scanned.
+  Expression *sample_percentage_{nullptr};
 
   std::string ToString() const override;
 
@@ -557,6 +562,7 @@ class ScanAll : public memgraph::query::plan::LogicalOperator {
     object->input_ = input_ ? input_->Clone(storage) : nullptr;
     object->output_symbol_ = output_symbol_;
     object->view_ = view_;
+    object->sample_percentage_ = sample_percentage_ ? sample_percentage_->Clone(storage) : nullptr;
     return object;
   }
 };
@@ -587,6 +593,7 @@ class ScanAllByLabel : public memgraph::query::plan::ScanAll {
     object->input_ = input_ ? input_->Clone(storage) : nullptr;
     object->output_symbol_ = output_symbol_;
     object->view_ = view_;
+    object->sample_percentage_ = sample_percentage_ ? sample_percentage_->Clone(storage) : nullptr;
     object->label_ = label_;
     return object;
   }
@@ -1066,6 +1073,7 @@ class Expand : public memgraph::query::plan::LogicalOperator {
     int64_t prev_existing_degree_{-1};
 
     bool InitEdges(Frame &, ExecutionContext &);
+    bool EdgeFilterHolds(Frame &, ExecutionContext &) const;
   };
 
   std::shared_ptr<memgraph::query::plan::LogicalOperator> input_;
@@ -1073,6 +1081,10 @@ class Expand : public memgraph::query::plan::LogicalOperator {
   memgraph::query::plan::ExpandCommon common_;
   /// State from which the input node should get expanded.
   storage::View view_;
+  /// Optional filter on the properties of the expanded edge. It is evaluated
+  /// as soon as the edge is placed on the frame, so edges which don't satisfy
+  /// it are skipped before the other node is produced.
+  Expression *edge_filter_{nullptr};
 
   std::string ToString() const override;
 
@@ -1082,6 +1094,7 @@ class Expand : public memgraph::query::plan::LogicalOperator {
     object->input_symbol_ = input_symbol_;
     object->common_ = common_;
     object->view_ = view_;
+    object->edge_filter_ = edge_filter_ ? edge_filter_->Clone(storage) : nullptr;
     return object;
   }
 };
@@ -1951,6 +1964,10 @@ class Aggregate : public memgraph::query::plan::LogicalOperator {
   std::vector<memgraph::query::plan::Aggregate::Element> aggregations_;
   std::vector<Expression *> group_by_;
   std::vector<Symbol> remember_;
+  /// Sample percentage of the sampled scans in the input, COUNT and SUM are
+  /// scaled up by the inverse of the sampled fraction for each of them.
+  Expression *sample_percentage_{nullptr};
+  uint64_t sampled_scans_{0};
 
   std::string ToString() const override {
     return fmt::format(
@@ -1971,6 +1988,8 @@ class Aggregate : public memgraph::query::plan::LogicalOperator {
       object->group_by_[i5] = group_by_[i5] ? group_by_[i5]->Clone(storage) : nullptr;
     }
     object->remember_ = remember_;
+    object->sample_percentage_ = sample_percentage_ ? sample_percentage_->Clone(storage) : nullptr;
+    object->sampled_scans_ = sampled_scans_;
     return object;
   }
 };
@@ -2691,12 +2710,22 @@ class Apply : public memgraph::query::plan::LogicalOperator {
   std::shared_ptr<memgraph::query::plan::LogicalOperator> input_;
   std::shared_ptr<memgraph::query::plan::LogicalOperator> subquery_;
   bool subquery_has_return_;
+  /// Maximum number of memoized subquery result rows, 0 if the results
+  /// aren't memoized.
+  uint64_t memoization_limit_{0};
+  /// Symbols from the input which the subquery reads, the memoization key.
+  std::vector<Symbol> memoization_symbols_;
+  /// Symbols set by the subquery, restored from the memoized results.
+  std::vector<Symbol> subquery_symbols_;
 
   std::unique_ptr<LogicalOperator> Clone(AstStorage *storage) const override {
     auto object = std::make_unique<Apply>();
     object->input_ = input_ ? input_->Clone(storage) : nullptr;
     object->subquery_ = subquery_ ? subquery_->Clone(storage) : nullptr;
     object->subquery_has_return_ = subquery_has_return_;
+    object->memoization_limit_ = memoization_limit_;
+    object->memoization_symbols_ = memoization_symbols_;
+    object->subquery_symbols_ = subquery_symbols_;
     return object;
   }
 
@@ -2714,6 +2743,12 @@ class Apply : public memgraph::query::plan::LogicalOperator {
     UniqueCursorPtr subquery_;
     bool pull_input_{true};
     bool subquery_has_return_{true};
+    SubqueryCache cache_;
+    // Memoized results being returned for the current input row
+    const SubqueryCache::Rows *cached_rows_{nullptr};
+    size_t cached_row_{0};
+    // Results being recorded for the current input row, if they can be memoized
+    std::optional<std::pair<SubqueryCache::Row, SubqueryCache::Rows>> recording_;
   };
 };
 
@@ -2834,6 +2869,8 @@ class RollUpApply : public memgraph::query::plan::LogicalOperator {
     object->list_collection_branch_ = list_collection_branch_ ? list_collection_branch_->Clone(storage) : nullptr;
     object->list_collection_symbol_ = list_collection_symbol_;
     object->result_symbol_ = result_symbol_;
+    object->memoization_limit_ = memoization_limit_;
+    object->memoization_symbols_ = memoization_symbols_;
     return object;
   }
 
@@ -2841,6 +2878,11 @@ class RollUpApply : public memgraph::query::plan::LogicalOperator {
   std::shared_ptr<memgraph::query::plan::LogicalOperator> list_collection_branch_;
   Symbol result_symbol_;
   Symbol list_collection_symbol_;
+  /// Maximum number of memoized lists, 0 if they aren't memoized.
+  uint64_t memoization_limit_{0};
+  /// Symbols from the input which the list collection branch reads, the
+  /// memoization key.
+  std::vector<Symbol> memoization_symbols_;
 };
 
 class PeriodicCommit : public memgraph::query::plan::LogicalOperator {
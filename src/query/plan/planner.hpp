@@ -29,6 +29,8 @@
 #include "query/plan/rewrite/join.hpp"
 #include "query/plan/rewrite/periodic_delete.hpp"
 #include "query/plan/rewrite/plan_validator.hpp"
+#include "query/plan/rewrite/sample_scans.hpp"
+#include "query/plan/rewrite/subquery_memoization.hpp"
 #include "query/plan/rule_based_planner.hpp"
 #include "query/plan/variable_start_planner.hpp"
 #include "query/plan/vertex_count_cache.hpp"
@@ -70,7 +72,12 @@ class PostProcessor final {
            [&](auto p) { return RewriteWithIndexLookup(std::move(p), symbol_table, ast, db, index_hints_); } |
            [&](auto p) { return RewriteWithJoinRewriter(std::move(p), symbol_table, ast, db); } |
            [&](auto p) { return RewriteWithEdgeIndexRewriter(std::move(p), symbol_table, ast, db); } |
-           [&](auto p) { return RewritePeriodicDelete(std::move(p), symbol_table, ast, db); };
+           [&](auto p) { return RewritePeriodicDelete(std::move(p), symbol_table, ast, db); } |
+           [&](auto p) { return RewriteSubqueryMemoization(std::move(p), symbol_table, ast, db); } |
+           [&](auto p) {
+             return RewriteSampleScans(std::move(p), symbol_table, ast, db,
+                                       context->query->pre_query_directives_.sample_percentage_);
+           };
   }
 
   bool IsValidPlan(const std::unique_ptr<LogicalOperator> &plan) { return query::plan::ValidatePlan(*plan); }
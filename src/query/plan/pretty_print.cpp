@@ -645,6 +645,9 @@ bool PlanToJsonVisitor::PreVisit(Expand &op) {
   self["edge_types"] = ToJson(op.common_.edge_types, *dba_);
   self["direction"] = ToString(op.common_.direction);
   self["existing_node"] = op.common_.existing_node;
+  if (op.edge_filter_) {
+    self["edge_filter"] = ToJson(op.edge_filter_, *dba_);
+  }
 
   op.input_->Accept(*this);
   self["input"] = PopOutput();
@@ -0,0 +1,83 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "query/plan/operator.hpp"
+
+namespace memgraph::query::plan {
+
+namespace impl {
+
+/// Marks the full and label scans of a `USING SAMPLE n PERCENT` query as
+/// sampled. Each aggregation remembers how many sampled scans feed it, since
+/// the number of rows it aggregates shrinks by the sampled fraction for each
+/// of them. Scans below a nested aggregation are accounted for by that one.
+class SampleScansRewriter final : public HierarchicalLogicalOperatorVisitor {
+ public:
+  explicit SampleScansRewriter(Expression *sample_percentage) : sample_percentage_(sample_percentage) {}
+
+  using HierarchicalLogicalOperatorVisitor::PostVisit;
+  using HierarchicalLogicalOperatorVisitor::PreVisit;
+  using HierarchicalLogicalOperatorVisitor::Visit;
+
+  bool Visit(Once & /*unused*/) override { return true; }
+
+  bool PreVisit(ScanAll &op) override {
+    Sample(op);
+    return true;
+  }
+
+  bool PreVisit(ScanAllByLabel &op) override {
+    Sample(op);
+    return true;
+  }
+
+  bool PreVisit(Aggregate & /*op*/) override {
+    sampled_scans_.push_back(0);
+    return true;
+  }
+
+  bool PostVisit(Aggregate &op) override {
+    op.sampled_scans_ = sampled_scans_.back();
+    op.sample_percentage_ = op.sampled_scans_ > 0 ? sample_percentage_ : nullptr;
+    sampled_scans_.pop_back();
+    return true;
+  }
+
+ private:
+  void Sample(ScanAll &op) {
+    op.sample_percentage_ = sample_percentage_;
+    if (!sampled_scans_.empty()) ++sampled_scans_.back();
+  }
+
+  Expression *sample_percentage_;
+  // Number of sampled scans below each of the aggregations being visited.
+  std::vector<uint64_t> sampled_scans_;
+};
+
+}  // namespace impl
+
+template <class TDbAccessor>
+std::unique_ptr<LogicalOperator> RewriteSampleScans(std::unique_ptr<LogicalOperator> root_op,
+                                                    SymbolTable * /*symbol_table*/, AstStorage * /*ast_storage*/,
+                                                    TDbAccessor * /*db*/, Expression *sample_percentage) {
+  if (!sample_percentage) return root_op;
+  auto rewriter = impl::SampleScansRewriter{sample_percentage};
+  root_op->Accept(rewriter);
+  return root_op;
+}
+
+}  // namespace memgraph::query::plan
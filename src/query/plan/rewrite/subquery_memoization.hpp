@@ -0,0 +1,73 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <memory>
+
+#include "query/plan/operator.hpp"
+#include "query/plan/read_write_type_checker.hpp"
+
+namespace memgraph::query::plan {
+
+namespace impl {
+
+/// The planner memoizes the results of read-only subqueries and pattern
+/// comprehensions, which is only correct if nothing else in the query writes
+/// either, since writes for one input row could change the results for the
+/// next one. Memoization is also useless when the input is a single row.
+class SubqueryMemoizationRewriter final : public HierarchicalLogicalOperatorVisitor {
+ public:
+  explicit SubqueryMemoizationRewriter(bool is_write) : is_write_(is_write) {}
+
+  using HierarchicalLogicalOperatorVisitor::PostVisit;
+  using HierarchicalLogicalOperatorVisitor::PreVisit;
+  using HierarchicalLogicalOperatorVisitor::Visit;
+
+  bool Visit(Once & /*unused*/) override { return true; }
+
+  bool PreVisit(Apply &op) override {
+    if (is_write_ || op.input_->GetTypeInfo() == Once::kType) {
+      op.memoization_limit_ = 0;
+      op.memoization_symbols_.clear();
+      op.subquery_symbols_.clear();
+    }
+    return true;
+  }
+
+  bool PreVisit(RollUpApply &op) override {
+    if (is_write_ || op.input_->GetTypeInfo() == Once::kType) {
+      op.memoization_limit_ = 0;
+      op.memoization_symbols_.clear();
+    }
+    return true;
+  }
+
+ private:
+  bool is_write_;
+};
+
+}  // namespace impl
+
+template <class TDbAccessor>
+std::unique_ptr<LogicalOperator> RewriteSubqueryMemoization(std::unique_ptr<LogicalOperator> root_op,
+                                                            SymbolTable * /*symbol_table*/,
+                                                            AstStorage * /*ast_storage*/, TDbAccessor * /*db*/) {
+  ReadWriteTypeChecker read_write_type_checker;
+  read_write_type_checker.InferRWType(*root_op);
+  const auto type = read_write_type_checker.type;
+  auto rewriter = impl::SubqueryMemoizationRewriter{type == ReadWriteTypeChecker::RWType::W ||
+                                                    type == ReadWriteTypeChecker::RWType::RW};
+  root_op->Accept(rewriter);
+  return root_op;
+}
+
+}  // namespace memgraph::query::plan
@@ -12,6 +12,7 @@
 #include "query/plan/rule_based_planner.hpp"
 
 #include <algorithm>
+#include <array>
 #include <functional>
 #include <limits>
 #include <memory>
@@ -27,6 +28,15 @@
 #include "utils/logging.hpp"
 #include "utils/typeinfo.hpp"
 
+// NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_bool(query_inline_edge_property_filters, false,
+            "Evaluate property filters on expanded relationships inside the Expand operator, before the other node "
+            "of the relationship is produced, instead of in a separate Filter operator.");
+// NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_uint64(query_subquery_cache_size, 0,
+              "Maximum number of result rows memoized by each read-only CALL subquery and pattern comprehension, so "
+              "they are computed once for each distinct value of the variables they import. 0 disables memoization.");
+
 namespace memgraph::query::plan {
 
 namespace {
@@ -504,6 +514,9 @@ class ReturnBodyContext : public HierarchicalTreeVisitor {
 
   const SymbolTable &symbol_table() const { return symbol_table_; }
 
+  // Symbols bound before the return body.
+  const auto &bound_symbols() const { return bound_symbols_; }
+
  private:
   const ReturnBody &body_;
   SymbolTable &symbol_table_;
@@ -550,8 +563,16 @@ std::unique_ptr<LogicalOperator> GenReturnBody(std::unique_ptr<LogicalOperator>
     auto list_collection_datas = body.pattern_comprehension_data();
     for (auto &list_collection_data : list_collection_datas) {
       auto list_collection_symbols = list_collection_data.op->ModifiedSymbols(body.symbol_table());
-      last_op = std::make_unique<RollUpApply>(std::move(last_op), std::move(list_collection_data.op),
-                                              list_collection_symbols, list_collection_data.result_symbol);
+      auto roll_up_apply = std::make_unique<RollUpApply>(std::move(last_op), std::move(list_collection_data.op),
+                                                         list_collection_symbols, list_collection_data.result_symbol);
+      if (FLAGS_query_subquery_cache_size > 0 && list_collection_data.pattern_comprehension) {
+        if (auto key = impl::GetMemoizationKey(*list_collection_data.pattern_comprehension, body.symbol_table(),
+                                               body.bound_symbols())) {
+          roll_up_apply->memoization_limit_ = FLAGS_query_subquery_cache_size;
+          roll_up_apply->memoization_symbols_ = std::move(*key);
+        }
+      }
+      last_op = std::move(roll_up_apply);
     }
   }
 
@@ -588,6 +609,51 @@ std::unique_ptr<LogicalOperator> GenReturnBody(std::unique_ptr<LogicalOperator>
   return last_op;
 }
 
+// Collects the symbols a subquery or a pattern comprehension reads and checks whether its results depend on nothing
+// else but their values and the state of the database.
+class MemoizationChecker : public UsedSymbolsCollector {
+ public:
+  using UsedSymbolsCollector::UsedSymbolsCollector;
+
+  using UsedSymbolsCollector::PostVisit;
+  using UsedSymbolsCollector::PreVisit;
+  using UsedSymbolsCollector::Visit;
+
+  bool PreVisit(query::Function &function) override {
+    // Temporal functions without arguments return the current time
+    static constexpr std::array kNonDeterministic{"RAND", "RANDOMUUID", "UNIFORMSAMPLE", "COUNTER", "TIMESTAMP"};
+    static constexpr std::array kCurrentTime{"DATE", "LOCALTIME", "LOCALDATETIME", "DATETIME"};
+    if (function.IsUserDefined() || utils::Contains(kNonDeterministic, function.function_name_) ||
+        (function.arguments_.empty() && utils::Contains(kCurrentTime, function.function_name_))) {
+      memoizable_ = false;
+    }
+    return true;
+  }
+
+  // Symbols forwarded by `*` aren't referenced by any identifier
+  bool PreVisit(query::With &with) override { return Check(!with.body_.all_identifiers); }
+  bool PreVisit(query::Return &ret) override { return Check(!ret.body_.all_identifiers); }
+
+  bool PreVisit(query::CallProcedure & /*unused*/) override { return Check(false); }
+  bool PreVisit(query::Create & /*unused*/) override { return Check(false); }
+  bool PreVisit(query::Merge & /*unused*/) override { return Check(false); }
+  bool PreVisit(query::Delete & /*unused*/) override { return Check(false); }
+  bool PreVisit(query::SetProperty & /*unused*/) override { return Check(false); }
+  bool PreVisit(query::SetProperties & /*unused*/) override { return Check(false); }
+  bool PreVisit(query::SetLabels & /*unused*/) override { return Check(false); }
+  bool PreVisit(query::RemoveProperty & /*unused*/) override { return Check(false); }
+  bool PreVisit(query::RemoveLabels & /*unused*/) override { return Check(false); }
+  bool PreVisit(query::Foreach & /*unused*/) override { return Check(false); }
+
+  bool memoizable_{true};
+
+ private:
+  bool Check(bool memoizable) {
+    memoizable_ &= memoizable;
+    return memoizable_;
+  }
+};
+
 }  // namespace
 
 namespace impl {
@@ -622,6 +688,27 @@ Expression *ExtractFilters(const std::unordered_set<Symbol> &bound_symbols, Filt
   return filter_expr;
 }
 
+Expression *ExtractEdgePropertyFilters(const Symbol &edge_symbol, const std::unordered_set<Symbol> &bound_symbols,
+                                       Filters &filters, AstStorage &storage) {
+  Expression *filter_expr = nullptr;
+  for (auto filters_it = filters.begin(); filters_it != filters.end();) {
+    auto const is_edge_property_filter = filters_it->type == FilterInfo::Type::Property &&
+                                         filters_it->property_filter->symbol_ == edge_symbol &&
+                                         !filters_it->property_filter->is_symbol_in_value_;
+    auto const uses_only_bound_symbols =
+        std::ranges::all_of(filters_it->used_symbols, [&edge_symbol, &bound_symbols](const auto &symbol) {
+          return symbol == edge_symbol || bound_symbols.contains(symbol);
+        });
+    if (is_edge_property_filter && uses_only_bound_symbols) {
+      filter_expr = impl::BoolJoin<AndOperator>(storage, filter_expr, filters_it->expression);
+      filters_it = filters.erase(filters_it);
+    } else {
+      filters_it++;
+    }
+  }
+  return filter_expr;
+}
+
 std::unordered_set<Symbol> GetSubqueryBoundSymbols(const std::vector<SingleQueryPart> &single_query_parts,
                                                    SymbolTable &symbol_table, AstStorage &storage,
                                                    PatternComprehensionDataMap &pc_ops) {
@@ -706,6 +793,32 @@ std::unique_ptr<LogicalOperator> GenUnion(const CypherUnion &cypher_union, std::
                                  right_op->OutputSymbols(symbol_table));
 }
 
+template <class TTree>
+std::optional<std::vector<Symbol>> CollectMemoizationKey(TTree &tree, const SymbolTable &symbol_table,
+                                                         const std::unordered_set<Symbol> &bound_symbols) {
+  MemoizationChecker checker(symbol_table);
+  tree.Accept(checker);
+  if (!checker.memoizable_) return std::nullopt;
+  std::vector<Symbol> key;
+  for (const auto &symbol : checker.symbols_) {
+    if (bound_symbols.contains(symbol)) key.push_back(symbol);
+  }
+  std::sort(key.begin(), key.end(),
+            [](const Symbol &lhs, const Symbol &rhs) { return lhs.position() < rhs.position(); });
+  return key;
+}
+
+std::optional<std::vector<Symbol>> GetMemoizationKey(CypherQuery &subquery, const SymbolTable &symbol_table,
+                                                     const std::unordered_set<Symbol> &bound_symbols) {
+  return CollectMemoizationKey(subquery, symbol_table, bound_symbols);
+}
+
+std::optional<std::vector<Symbol>> GetMemoizationKey(PatternComprehension &pattern_comprehension,
+                                                     const SymbolTable &symbol_table,
+                                                     const std::unordered_set<Symbol> &bound_symbols) {
+  return CollectMemoizationKey(pattern_comprehension, symbol_table, bound_symbols);
+}
+
 Symbol GetSymbol(NodeAtom *atom, const SymbolTable &symbol_table) { return symbol_table.at(*atom->identifier_); }
 Symbol GetSymbol(EdgeAtom *atom, const SymbolTable &symbol_table) { return symbol_table.at(*atom->identifier_); }
 
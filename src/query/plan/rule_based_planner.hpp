@@ -16,6 +16,8 @@
 #include <optional>
 #include <variant>
 
+#include <gflags/gflags.h>
+
 #include "flags/run_time_configurable.hpp"
 #include "query/database_access.hpp"
 #include "query/frontend/ast/ast.hpp"
@@ -28,6 +30,9 @@
 #include "utils/logging.hpp"
 #include "utils/typeinfo.hpp"
 
+DECLARE_bool(query_inline_edge_property_filters);
+DECLARE_uint64(query_subquery_cache_size);
+
 namespace memgraph::query::plan {
 
 struct PatternComprehensionData {
@@ -101,6 +106,12 @@ namespace impl {
 // removed from `Filters`.
 Expression *ExtractFilters(const std::unordered_set<Symbol> &, Filters &, AstStorage &);
 
+// Extracts property filters on `edge_symbol` which can be evaluated as soon as
+// the edge is expanded (all other used symbols are bound) and joins them via
+// `AndOperator`. The extracted filters are removed from `Filters`.
+Expression *ExtractEdgePropertyFilters(const Symbol &edge_symbol, const std::unordered_set<Symbol> &bound_symbols,
+                                       Filters &filters, AstStorage &storage);
+
 /// Checks if the filters has all the bound symbols to be included in the current part of the query
 bool HasBoundFilterSymbols(const std::unordered_set<Symbol> &bound_symbols, const FilterInfo &filter);
 
@@ -110,6 +121,15 @@ std::unordered_set<Symbol> GetSubqueryBoundSymbols(const std::vector<SingleQuery
                                                    SymbolTable &symbol_table, AstStorage &storage,
                                                    PatternComprehensionDataMap &pc_ops);
 
+// Returns the symbols from `bound_symbols` which the subquery or pattern comprehension reads, sorted by position. The
+// results only depend on their values if it doesn't write to the database, call procedures or non-deterministic
+// functions, otherwise std::nullopt is returned.
+std::optional<std::vector<Symbol>> GetMemoizationKey(CypherQuery &subquery, const SymbolTable &symbol_table,
+                                                     const std::unordered_set<Symbol> &bound_symbols);
+std::optional<std::vector<Symbol>> GetMemoizationKey(PatternComprehension &pattern_comprehension,
+                                                     const SymbolTable &symbol_table,
+                                                     const std::unordered_set<Symbol> &bound_symbols);
+
 Symbol GetSymbol(NodeAtom *atom, const SymbolTable &symbol_table);
 Symbol GetSymbol(EdgeAtom *atom, const SymbolTable &symbol_table);
 
@@ -277,7 +297,8 @@ class RuleBasedPlanner {
                                            single_query_part, merge_id);
           } else if (auto *call_sub = utils::Downcast<query::CallSubquery>(clause)) {
             input_op = HandleSubquery(std::move(input_op), single_query_part.subqueries[subquery_id++],
-                                      *context.symbol_table, *context_->ast_storage, pattern_comprehension_ops,
+                                      *call_sub->cypher_query_, *context.symbol_table, *context_->ast_storage,
+                                      pattern_comprehension_ops,
                                       call_sub->cypher_query_->pre_query_directives_.commit_frequency_);
             if (context.is_write_query && !has_periodic_commit) {
               input_op = std::make_unique<Accumulate>(std::move(input_op),
@@ -867,8 +888,16 @@ class RuleBasedPlanner {
                                                  edge->lower_bound_, edge->upper_bound_, existing_node, filter_lambda,
                                                  weight_lambda, total_weight);
     } else {
-      last_op = std::make_unique<Expand>(std::move(last_op), node1_symbol, node_symbol, edge_symbol,
-                                         expansion.direction, edge_types, existing_node, view);
+      // Expansions straight from a ScanAll are left for the edge index rewriter, which needs the edge property
+      // filters to be in a Filter operator.
+      Expression *edge_filter = nullptr;
+      if (FLAGS_query_inline_edge_property_filters && last_op->GetTypeInfo() != ScanAll::kType) {
+        edge_filter = impl::ExtractEdgePropertyFilters(edge_symbol, bound_symbols, filters, storage);
+      }
+      auto expand = std::make_unique<Expand>(std::move(last_op), node1_symbol, node_symbol, edge_symbol,
+                                             expansion.direction, edge_types, existing_node, view);
+      expand->edge_filter_ = edge_filter;
+      last_op = std::move(expand);
     }
 
     // Bind the expanded edge and node.
@@ -937,9 +966,9 @@ class RuleBasedPlanner {
   }
 
   std::unique_ptr<LogicalOperator> HandleSubquery(std::unique_ptr<LogicalOperator> last_op,
-                                                  std::shared_ptr<QueryParts> subquery, SymbolTable &symbol_table,
-                                                  AstStorage &storage, PatternComprehensionDataMap &pc_ops,
-                                                  Expression *commit_frequency) {
+                                                  std::shared_ptr<QueryParts> subquery, CypherQuery &subquery_ast,
+                                                  SymbolTable &symbol_table, AstStorage &storage,
+                                                  PatternComprehensionDataMap &pc_ops, Expression *commit_frequency) {
     std::unordered_set<Symbol> outer_scope_bound_symbols;
     outer_scope_bound_symbols.insert(std::make_move_iterator(context_->bound_symbols.begin()),
                                      std::make_move_iterator(context_->bound_symbols.end()));
@@ -960,7 +989,17 @@ class RuleBasedPlanner {
 
     bool has_periodic_commit = commit_frequency != nullptr;
     if (!has_periodic_commit) {
-      last_op = std::make_unique<Apply>(std::move(last_op), std::move(subquery_op), subquery_has_return);
+      auto apply = std::make_unique<Apply>(std::move(last_op), std::move(subquery_op), subquery_has_return);
+      // Results of a subquery which only reads are reused for input rows with the same values of the symbols the
+      // subquery imports. Whether the whole query is read-only is checked once it's planned.
+      if (subquery_has_return && FLAGS_query_subquery_cache_size > 0) {
+        if (auto key = impl::GetMemoizationKey(subquery_ast, symbol_table, context_->bound_symbols)) {
+          apply->memoization_limit_ = FLAGS_query_subquery_cache_size;
+          apply->memoization_symbols_ = std::move(*key);
+          apply->subquery_symbols_ = apply->subquery_->ModifiedSymbols(symbol_table);
+        }
+      }
+      last_op = std::move(apply);
     } else {
       // this periodic commit is from CALL IN TRANSACTIONS OF x ROWS
       last_op = std::make_unique<PeriodicSubquery>(std::move(last_op), std::move(subquery_op), commit_frequency,
@@ -0,0 +1,128 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+
+#include "query/typed_value.hpp"
+#include "utils/fnv.hpp"
+#include "utils/memory.hpp"
+#include "utils/pmr/unordered_map.hpp"
+#include "utils/pmr/vector.hpp"
+
+namespace memgraph::query::plan {
+
+/**
+ * Results of a correlated subquery memoized by the values of the symbols the
+ * subquery reads from its input, so that the subquery runs once for each
+ * distinct combination of them.
+ *
+ * The cache holds at most `limit` result rows, results of further keys aren't
+ * memoized. When the lookups don't hit often enough to pay for copying the
+ * results, the cache disables itself.
+ */
+class SubqueryCache {
+ public:
+  using Row = utils::pmr::vector<TypedValue>;
+  using Rows = utils::pmr::vector<Row>;
+
+  SubqueryCache(uint64_t limit, utils::MemoryResource *memory) : limit_(limit), entries_(memory) {}
+
+  bool Enabled() const { return limit_ > 0; }
+
+  /// Returns false if the key contains values which can't be hashed, i.e.
+  /// graphs and functions.
+  static bool IsValidKey(const Row &key) { return std::all_of(key.begin(), key.end(), IsHashable); }
+
+  /// Returns the memoized results for the key, nullptr if there are none.
+  const Rows *Find(const Row &key) {
+    ++lookups_;
+    auto it = entries_.find(key);
+    if (it != entries_.end()) {
+      ++hits_;
+      return &it->second;
+    }
+    if (lookups_ >= kProbeLookups && hits_ * kMinHitRatio < lookups_) {
+      limit_ = 0;
+      entries_.clear();
+    }
+    return nullptr;
+  }
+
+  /// Returns true if results with the given number of rows can still be memoized.
+  bool CanInsert(uint64_t rows) const { return Enabled() && size_ + std::max<uint64_t>(rows, 1) <= limit_; }
+
+  /// Memoizes the results for the key, `rows` is what they count towards the
+  /// limit.
+  void Insert(Row key, Rows results, uint64_t rows) {
+    size_ += std::max<uint64_t>(rows, 1);
+    entries_.emplace(std::move(key), std::move(results));
+  }
+
+  utils::MemoryResource *GetMemoryResource() const { return entries_.get_allocator().GetMemoryResource(); }
+
+ private:
+  static bool IsHashable(const TypedValue &value) {
+    switch (value.type()) {
+      case TypedValue::Type::List:
+        return std::all_of(value.ValueList().begin(), value.ValueList().end(), IsHashable);
+      case TypedValue::Type::Map:
+        return std::all_of(value.ValueMap().begin(), value.ValueMap().end(),
+                           [](const auto &entry) { return IsHashable(entry.second); });
+      case TypedValue::Type::Graph:
+      case TypedValue::Type::Function:
+        return false;
+      default:
+        return true;
+    }
+  }
+
+  // Values only match if they are of the same type, unlike in Cypher equality
+  // where 1 = 1.0, because the subquery can tell them apart.
+  struct RowEqual {
+    static bool Identical(const TypedValue &lhs, const TypedValue &rhs) {
+      if (lhs.type() != rhs.type()) return false;
+      switch (lhs.type()) {
+        case TypedValue::Type::List:
+          return std::equal(lhs.ValueList().begin(), lhs.ValueList().end(), rhs.ValueList().begin(),
+                            rhs.ValueList().end(), Identical);
+        case TypedValue::Type::Map: {
+          const auto &lhs_map = lhs.ValueMap();
+          const auto &rhs_map = rhs.ValueMap();
+          if (lhs_map.size() != rhs_map.size()) return false;
+          return std::all_of(lhs_map.begin(), lhs_map.end(), [&](const auto &entry) {
+            auto it = rhs_map.find(entry.first);
+            return it != rhs_map.end() && Identical(entry.second, it->second);
+          });
+        }
+        default:
+          return TypedValue::BoolEqual{}(lhs, rhs);
+      }
+    }
+
+    bool operator()(const Row &lhs, const Row &rhs) const {
+      return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(), Identical);
+    }
+  };
+
+  static constexpr uint64_t kProbeLookups = 1024;
+  static constexpr uint64_t kMinHitRatio = 8;
+
+  uint64_t limit_;
+  uint64_t size_{0};
+  uint64_t lookups_{0};
+  uint64_t hits_{0};
+  utils::pmr::unordered_map<Row, Rows, utils::FnvCollection<Row, TypedValue, TypedValue::Hash>, RowEqual> entries_;
+};
+
+}  // namespace memgraph::query::plan
@@ -3004,6 +3004,11 @@ mgp_error mgp_graph_is_transactional(mgp_graph *graph, int *result) {
   return mgp_error::MGP_ERROR_NO_ERROR;
 }
 
+mgp_error mgp_graph_get_database_name(mgp_graph *graph, const char **result) {
+  *result = graph->getImpl()->DatabaseName().c_str();
+  return mgp_error::MGP_ERROR_NO_ERROR;
+}
+
 mgp_error mgp_graph_is_mutable(mgp_graph *graph, int *result) {
   *result = MgpGraphIsMutable(*graph) ? 1 : 0;
   return mgp_error::MGP_ERROR_NO_ERROR;
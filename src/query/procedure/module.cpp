@@ -816,6 +816,8 @@ class SharedLibraryModule final : public Module {
 
   std::optional<std::filesystem::path> Path() const override { return file_path_; }
 
+  void OnDatabaseDrop(std::string_view database_name) override;
+
  private:
   /// Path as requested for loading the module from a library.
   std::filesystem::path file_path_;
@@ -825,6 +827,8 @@ class SharedLibraryModule final : public Module {
   std::function<int(mgp_module *, mgp_memory *)> init_fn_;
   /// Optional shutdown function called on module unload.
   std::function<int()> shutdown_fn_;
+  /// Optional function called when a database is dropped.
+  std::function<int(const char *)> database_drop_fn_;
   /// Registered procedures
   std::map<std::string, mgp_proc, std::less<>> procedures_;
   /// Registered transformations
@@ -892,6 +896,9 @@ bool SharedLibraryModule::Load(const std::filesystem::path &file_path) {
   shutdown_fn_ = reinterpret_cast<int (*)()>(dlsym(handle_, "mgp_shutdown_module"));
   dl_errored = dlerror();
   if (dl_errored) spdlog::warn("When loading module {}; {}", file_path, dl_errored);
+  // Get optional mgp_on_database_drop
+  database_drop_fn_ = reinterpret_cast<int (*)(const char *)>(dlsym(handle_, "mgp_on_database_drop"));
+  dlerror();  // A missing symbol is not an error.
   spdlog::info("Loaded module {}", file_path);
   return true;
 }
@@ -917,6 +924,14 @@ bool SharedLibraryModule::Close() {
   return true;
 }
 
+void SharedLibraryModule::OnDatabaseDrop(std::string_view database_name) {
+  if (!handle_ || !database_drop_fn_) return;
+  const auto name = std::string{database_name};
+  if (const int res = database_drop_fn_(name.c_str()); res != 0) {
+    spdlog::warn("When dropping database {}; mgp_on_database_drop of module {} returned {}", name, file_path_, res);
+  }
+}
+
 const std::map<std::string, mgp_proc, std::less<>> *SharedLibraryModule::Procedures() const {
   MG_ASSERT(handle_,
             "Attempting to access procedures of a module that has not "
@@ -1314,6 +1329,13 @@ void ModuleRegistry::UnloadAllModules() {
   DoUnloadAllModules();
 }
 
+void ModuleRegistry::NotifyDatabaseDrop(const std::string_view database_name) const {
+  auto guard = std::shared_lock{lock_};
+  for (const auto &[_, module] : modules_) {
+    module->OnDatabaseDrop(database_name);
+  }
+}
+
 utils::MemoryResource &ModuleRegistry::GetSharedMemoryResource() noexcept { return *shared_; }
 
 bool ModuleRegistry::RegisterMgProcedure(const std::string_view name, mgp_proc proc) {
@@ -54,6 +54,9 @@ class Module {
   virtual const std::map<std::string, mgp_func, std::less<>> *Functions() const = 0;
 
   virtual std::optional<std::filesystem::path> Path() const = 0;
+
+  /// Lets the module release the state it keeps for a dropped database.
+  virtual void OnDatabaseDrop(std::string_view /*database_name*/) {}
 };
 
 /// Thread-safe registration of modules from libraries, uses utils::RWLock.
@@ -118,6 +121,10 @@ class ModuleRegistry final {
   /// Takes a write lock.
   void UnloadAllModules();
 
+  /// Notify all modules that a database was dropped.
+  /// Takes a read lock.
+  void NotifyDatabaseDrop(std::string_view database_name) const;
+
   /// Returns the shared memory allocator used by modules
   utils::MemoryResource &GetSharedMemoryResource() noexcept;
 
@@ -100,6 +100,8 @@ struct Config {
 
     Type type{Type::PERIODIC};
     std::chrono::milliseconds interval{std::chrono::milliseconds(1000)};
+    // How long committed versions stay readable through AS OF accessors; 0 disables history retention.
+    std::chrono::milliseconds history_retention{0};
     friend bool operator==(const Gc &lrh, const Gc &rhs) = default;
   } gc;  // SYSTEM FLAG
 
@@ -117,6 +119,9 @@ struct Config {
 
     uint64_t wal_file_size_kibibytes{20 * 1024};  // PER DATABASE
     uint64_t wal_file_flush_every_n_tx{100000};   // PER DATABASE
+    uint64_t wal_file_recycle_count{0};           // PER DATABASE
+
+    std::chrono::milliseconds scrub_interval{0};  // PER DATABASE
 
     bool snapshot_on_exit{false};                      // PER DATABASE
     bool restore_replication_state_on_startup{false};  // PER INSTANCE
@@ -130,6 +135,11 @@ struct Config {
 
   struct Transaction {
     IsolationLevel isolation_level{IsolationLevel::SNAPSHOT_ISOLATION};
+    // Label index scans start where a concurrent scan over the same label is and wrap around
+    bool synchronized_scans{false};
+    // Read-only queries on a replica read the state between batches of replicated transactions without locks or
+    // delta chains, batches wait for the running ones
+    bool replica_epoch_reads{false};
     friend bool operator==(const Transaction &lrh, const Transaction &rhs) = default;
   } transaction;  // PER DATABASE
 
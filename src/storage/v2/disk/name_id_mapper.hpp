@@ -73,7 +73,8 @@ class DiskNameIdMapper final : public NameIdMapper {
   }
 
  private:
-  std::optional<std::reference_wrapper<const uint64_t>> MaybeNameToId(const std::string_view name) const {
+  std::optional<uint64_t> MaybeNameToId(const std::string_view name) const {
+    if (auto id = hashed_name_to_id_.Find(name); id.has_value()) return id;
     auto name_to_id_acc = name_to_id_.access();
     auto result = name_to_id_acc.find(name);
     if (result == name_to_id_acc.end()) {
@@ -84,12 +85,13 @@ class DiskNameIdMapper final : public NameIdMapper {
 
   const std::string &InsertNameIdEntryToCache(const std::string &name, uint64_t id) {
     auto name_to_id_acc = name_to_id_.access();
-    return name_to_id_acc.insert({std::string(name), id}).first->name;
+    auto it = name_to_id_acc.insert({std::string(name), id}).first;
+    hashed_name_to_id_.Publish(it->name, it->id);
+    return it->name;
   }
 
   const std::string &InsertIdNameEntryToCache(uint64_t id, const std::string &name) {
-    auto id_to_name_acc = id_to_name_.access();
-    return id_to_name_acc.insert({id, std::string(name)}).first->name;
+    return InsertIdToName(id, name);
   }
 
   void InitializeFromDisk() {
@@ -1831,6 +1831,13 @@ utils::BasicResult<StorageManipulationError, void> DiskStorage::DiskAccessor::Co
     }
   }
 
+  // Built before the commit, like on the in-memory storage
+  TextIndex::PendingBatch text_index_batch;
+  if (flags::AreExperimentsEnabled(flags::Experiments::TEXT_SEARCH)) {
+    text_index_batch =
+        disk_storage->indices_.text_index_.PrepareCommit(transaction_, disk_storage->name_id_mapper_.get());
+  }
+
   if (commit_timestamp_) {
     // commit_timestamp_ is set only if the transaction has writes.
     logging::AssertRocksDBStatus(transaction_.disk_transaction_->SetCommitTimestamp(*commit_timestamp_));
@@ -1847,7 +1854,10 @@ utils::BasicResult<StorageManipulationError, void> DiskStorage::DiskAccessor::Co
 
   spdlog::trace("rocksdb: Commit successful");
   if (flags::AreExperimentsEnabled(flags::Experiments::TEXT_SEARCH)) {
-    disk_storage->indices_.text_index_.Commit();
+    // Without writes there is no commit timestamp, but then there are no text index changes either
+    disk_storage->indices_.text_index_.Commit(std::move(text_index_batch),
+                                              commit_timestamp_.value_or(transaction_.start_timestamp));
+    disk_storage->indices_.text_index_.ApplyCommitted();
   }
   disk_storage->durable_metadata_.UpdateMetaData(disk_storage->timestamp_, disk_storage->vertex_count_,
                                                  disk_storage->edge_count_);
@@ -1977,9 +1987,7 @@ void DiskStorage::DiskAccessor::Abort() {
   // query_plan_accumulate_aggregate.cpp
   transaction_.disk_transaction_->Rollback();
   transaction_.disk_transaction_->ClearSnapshot();
-  if (flags::AreExperimentsEnabled(flags::Experiments::TEXT_SEARCH)) {
-    storage_->indices_.text_index_.Rollback();
-  }
+  transaction_.text_index_changes_.clear();
   delete transaction_.disk_transaction_;
   transaction_.disk_transaction_ = nullptr;
   is_transaction_active_ = false;
@@ -12,6 +12,7 @@
 #pragma once
 
 #include <cstdint>
+#include <filesystem>
 #include <string>
 
 #include "utils/timestamp.hpp"
@@ -21,6 +22,7 @@ namespace memgraph::storage::durability {
 static const std::string kSnapshotDirectory{"snapshots"};
 static const std::string kWalDirectory{"wal"};
 static const std::string kBackupDirectory{".backup"};
+static const std::string kWalRecycleDirectory{".wal_recycle"};
 static const std::string kLockFile{".lock"};
 
 // This is the prefix used for Snapshot and WAL filenames. It is a timestamp
@@ -40,6 +42,12 @@ inline std::string MakeWalName() {
   return date_str + "_current";
 }
 
+// WAL files are renamed with `RemakeWalName` when they are finalized, so only
+// the files which were still being written keep the `_current` suffix.
+inline bool IsCurrentWalName(const std::filesystem::path &path) {
+  return path.filename().string().ends_with("_current");
+}
+
 // Generates the name for a WAL file in a well-defined sortable format with the
 // range of timestamps contained [from, to] appended to the name.
 inline std::string RemakeWalName(const std::string &current_name, uint64_t from_timestamp, uint64_t to_timestamp) {
@@ -19,6 +19,7 @@
 #include "storage/v2/property_value.hpp"
 #include "storage/v2/temporal.hpp"
 #include "utils/cast.hpp"
+#include "utils/crc32c.hpp"
 #include "utils/endian.hpp"
 #include "utils/temporal.hpp"
 
@@ -52,7 +53,10 @@ void Encoder::Close() {
   }
 }
 
-void Encoder::Write(const uint8_t *data, uint64_t size) { file_.Write(data, size); }
+void Encoder::Write(const uint8_t *data, uint64_t size) {
+  file_.Write(data, size);
+  if (checksum_) checksum_ = utils::Crc32c(*checksum_, data, size);
+}
 
 void Encoder::WriteMarker(Marker marker) {
   auto value = static_cast<uint8_t>(marker);
@@ -207,6 +211,18 @@ std::pair<const uint8_t *, size_t> Encoder::CurrentFileBuffer() const { return f
 
 size_t Encoder::GetSize() { return file_.GetSize(); }
 
+size_t Encoder::GetFlushedPosition() { return file_.GetFlushedPosition(); }
+
+bool Encoder::Preallocate(size_t size) { return file_.Preallocate(size); }
+
+void Encoder::TruncateAtPosition() { file_.TruncateAtPosition(); }
+
+void Encoder::EnableTerminator() { file_.EnableTerminator(); }
+
+void Encoder::ResetChecksum() { checksum_ = 0; }
+
+uint32_t Encoder::Checksum() const { return checksum_.value_or(0); }
+
 //////////////////////////
 // Decoder implementation.
 //////////////////////////
@@ -239,7 +255,11 @@ std::optional<uint64_t> Decoder::Initialize(const std::filesystem::path &path, c
   return utils::LittleEndianToHost(version_encoded);
 }
 
-bool Decoder::Read(uint8_t *data, size_t size) { return file_.Read(data, size); }
+bool Decoder::Read(uint8_t *data, size_t size) {
+  if (!file_.Read(data, size)) return false;
+  if (checksum_) checksum_ = utils::Crc32c(*checksum_, data, size);
+  return true;
+}
 
 bool Decoder::Peek(uint8_t *data, size_t size) { return file_.Peek(data, size); }
 
@@ -677,4 +697,8 @@ std::optional<uint64_t> Decoder::GetPosition() { return file_.GetPosition(); }
 
 bool Decoder::SetPosition(uint64_t position) { return !!file_.SetPosition(utils::InputFile::Position::SET, position); }
 
+void Decoder::ResetChecksum() { checksum_ = 0; }
+
+uint32_t Decoder::Checksum() const { return checksum_.value_or(0); }
+
 }  // namespace memgraph::storage::durability
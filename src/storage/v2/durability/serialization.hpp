@@ -13,6 +13,7 @@
 
 #include <cstdint>
 #include <filesystem>
+#include <optional>
 #include <string_view>
 
 #include "storage/v2/config.hpp"
@@ -82,8 +83,26 @@ class Encoder final : public BaseEncoder {
   // Get the total size of the current file.
   size_t GetSize();
 
+  // Get the current position without the data in the internal buffer.
+  size_t GetFlushedPosition();
+
+  // Allocate disk space for the first `size` bytes of the file.
+  bool Preallocate(size_t size);
+
+  // Truncate the file at the current position.
+  void TruncateAtPosition();
+
+  // Keep a zero byte after the flushed data, see `utils::OutputFile::EnableTerminator`.
+  void EnableTerminator();
+
+  // Start calculating the checksum of the data written from now on.
+  void ResetChecksum();
+  // Get the CRC32C checksum of the data written since the last reset.
+  uint32_t Checksum() const;
+
  private:
   utils::OutputFile file_;
+  std::optional<uint32_t> checksum_;
 };
 
 /// Decoder interface class. Used to implement streams from different sources
@@ -136,8 +155,14 @@ class Decoder final : public BaseDecoder {
   std::optional<uint64_t> GetPosition();
   bool SetPosition(uint64_t position);
 
+  // Start calculating the checksum of the data read from now on.
+  void ResetChecksum();
+  // Get the CRC32C checksum of the data read since the last reset.
+  uint32_t Checksum() const;
+
  private:
   utils::InputFile file_;
+  std::optional<uint32_t> checksum_;
 };
 
 }  // namespace memgraph::storage::durability
@@ -11,6 +11,7 @@
 
 #include "storage/v2/durability/snapshot.hpp"
 
+#include <limits>
 #include <thread>
 
 #include "flags/experimental.hpp"
@@ -37,6 +38,7 @@
 #include "storage/v2/vertex.hpp"
 #include "storage/v2/vertex_accessor.hpp"
 #include "utils/concepts.hpp"
+#include "utils/crc32c.hpp"
 #include "utils/file.hpp"
 #include "utils/file_locker.hpp"
 #include "utils/logging.hpp"
@@ -114,9 +116,13 @@ namespace memgraph::storage::durability {
 //     * edge batch infos
 //        * starting offset of the batch
 //        * number of edges in the batch
+//        * size of the batch (from version 21)
+//        * CRC32C checksum of the batch (from version 21)
 //     * vertex batch infos
 //        * starting offset of the batch
 //        * number of vertices in the batch
+//        * size of the batch (from version 21)
+//        * CRC32C checksum of the batch (from version 21)
 //
 // IMPORTANT: When changing snapshot encoding/decoding bump the snapshot/WAL
 // version in `version.hpp`.
@@ -124,6 +130,9 @@ namespace memgraph::storage::durability {
 struct BatchInfo {
   uint64_t offset;
   uint64_t count;
+  // Snapshots older than `kChecksumsVersion` don't store these.
+  uint64_t size{0};
+  std::optional<uint32_t> checksum{};
 };
 
 // Function used to read information about the snapshot file.
@@ -212,7 +221,7 @@ SnapshotInfo ReadSnapshotInfo(const std::filesystem::path &path) {
   return info;
 }
 
-std::vector<BatchInfo> ReadBatchInfos(Decoder &snapshot) {
+std::vector<BatchInfo> ReadBatchInfos(Decoder &snapshot, bool with_checksums = false) {
   std::vector<BatchInfo> infos;
   const auto infos_size = snapshot.ReadUint();
   if (!infos_size.has_value()) {
@@ -230,11 +239,70 @@ std::vector<BatchInfo> ReadBatchInfos(Decoder &snapshot) {
     if (!count.has_value()) {
       throw RecoveryFailure("Couldn't read batch info count!");
     }
-    infos.push_back(BatchInfo{*offset, *count});
+    BatchInfo info{.offset = *offset, .count = *count};
+
+    if (with_checksums) {
+      const auto size = snapshot.ReadUint();
+      if (!size.has_value()) {
+        throw RecoveryFailure("Couldn't read batch info size!");
+      }
+      info.size = *size;
+
+      const auto checksum = snapshot.ReadUint();
+      if (!checksum.has_value() || *checksum > std::numeric_limits<uint32_t>::max()) {
+        throw RecoveryFailure("Couldn't read batch info checksum!");
+      }
+      info.checksum = static_cast<uint32_t>(*checksum);
+    }
+    infos.push_back(info);
   }
   return infos;
 }
 
+// Reads the data of the batch once more and compares its checksum with the
+// stored one, so that corrupt data is detected before it is loaded.
+void VerifyBatchChecksum(const std::filesystem::path &path, const BatchInfo &batch) {
+  if (!batch.checksum) return;
+  utils::InputFile file;
+  if (!file.Open(path) || !file.SetPosition(utils::InputFile::Position::SET, static_cast<ssize_t>(batch.offset))) {
+    throw RecoveryFailure("Couldn't read data from snapshot!");
+  }
+  constexpr uint64_t kChunkSize = 64 * 1024;
+  std::vector<uint8_t> buffer(std::min(batch.size, kChunkSize));
+  uint32_t checksum = 0;
+  for (uint64_t remaining = batch.size; remaining > 0;) {
+    const auto chunk = std::min(remaining, kChunkSize);
+    if (!file.Read(buffer.data(), chunk)) throw RecoveryFailure("Couldn't read data from snapshot!");
+    checksum = utils::Crc32c(checksum, buffer.data(), chunk);
+    remaining -= chunk;
+  }
+  if (checksum != *batch.checksum) {
+    throw RecoveryFailure(fmt::format("Snapshot batch at offset {} is corrupt!", batch.offset));
+  }
+}
+
+bool VerifySnapshotFile(const std::filesystem::path &path) {
+  try {
+    const auto info = ReadSnapshotInfo(path);
+    Decoder snapshot;
+    const auto version = snapshot.Initialize(path, kSnapshotMagic);
+    if (!version) return false;
+    if (*version < kChecksumsVersion) return true;
+
+    auto verify_batches = [&](uint64_t offset) {
+      if (!snapshot.SetPosition(offset)) throw RecoveryFailure("Couldn't read data from snapshot!");
+      for (const auto &batch : ReadBatchInfos(snapshot, true)) {
+        VerifyBatchChecksum(path, batch);
+      }
+    };
+    if (info.offset_edges != 0) verify_batches(info.offset_edge_batches);
+    verify_batches(info.offset_vertex_batches);
+    return true;
+  } catch (const RecoveryFailure &) {
+    return false;
+  }
+}
+
 template <typename TFunc>
 void LoadPartialEdges(const std::filesystem::path &path, utils::SkipList<Edge> &edges, const uint64_t from_offset,
                       const uint64_t edges_count, const SalientConfig::Items items, TFunc get_property_from_id) {
@@ -2739,12 +2807,13 @@ RecoveredSnapshot LoadSnapshot(const std::filesystem::path &path, utils::SkipLis
       if (!snapshot.SetPosition(info.offset_edge_batches)) {
         throw RecoveryFailure("Couldn't read data from snapshot!");
       }
-      const auto edge_batches = ReadBatchInfos(snapshot);
+      const auto edge_batches = ReadBatchInfos(snapshot, *version >= kChecksumsVersion);
 
       RecoverOnMultipleThreads(
           config.durability.recovery_thread_count,
           [path, edges, items = config.salient.items, &get_property_from_id](const size_t /*batch_index*/,
                                                                              const BatchInfo &batch) {
+            VerifyBatchChecksum(path, batch);
             LoadPartialEdges(path, *edges, batch.offset, batch.count, items, get_property_from_id);
           },
           edge_batches);
@@ -2759,11 +2828,12 @@ RecoveredSnapshot LoadSnapshot(const std::filesystem::path &path, utils::SkipLis
       throw RecoveryFailure("Couldn't read data from snapshot!");
     }
 
-    const auto vertex_batches = ReadBatchInfos(snapshot);
+    const auto vertex_batches = ReadBatchInfos(snapshot, *version >= kChecksumsVersion);
     RecoverOnMultipleThreads(
         config.durability.recovery_thread_count,
         [path, vertices, schema_info, &vertex_batches, &get_label_from_id, &get_property_from_id, &last_vertex_gid](
             const size_t batch_index, const BatchInfo &batch) {
+          VerifyBatchChecksum(path, batch);
           const auto last_vertex_gid_in_batch = LoadPartialVertices(
               path, *vertices, schema_info, batch.offset, batch.count, get_label_from_id, get_property_from_id);
           if (batch_index == vertex_batches.size() - 1) {
@@ -3266,10 +3336,19 @@ void CreateSnapshot(Storage *storage, Transaction *transaction, const std::files
   std::vector<BatchInfo> edge_batch_infos;
   auto items_in_current_batch{0UL};
   auto batch_start_offset{0UL};
+  auto finish_batch = [&snapshot, &items_in_current_batch, &batch_start_offset] {
+    const auto position = snapshot.GetPosition();
+    BatchInfo batch{batch_start_offset, items_in_current_batch, position - batch_start_offset, snapshot.Checksum()};
+    items_in_current_batch = 0;
+    batch_start_offset = position;
+    snapshot.ResetChecksum();
+    return batch;
+  };
   // Store all edges.
   if (storage->config_.salient.items.properties_on_edges) {
     offset_edges = snapshot.GetPosition();
     batch_start_offset = offset_edges;
+    snapshot.ResetChecksum();
     auto acc = edges->access();
     for (auto &edge : acc) {
       // The edge visibility check must be done here manually because we don't
@@ -3330,15 +3409,13 @@ void CreateSnapshot(Storage *storage, Transaction *transaction, const std::files
       ++edges_count;
       ++items_in_current_batch;
       if (items_in_current_batch == storage->config_.durability.items_per_batch) {
-        edge_batch_infos.push_back(BatchInfo{batch_start_offset, items_in_current_batch});
-        batch_start_offset = snapshot.GetPosition();
-        items_in_current_batch = 0;
+        edge_batch_infos.push_back(finish_batch());
       }
     }
   }
 
   if (items_in_current_batch > 0) {
-    edge_batch_infos.push_back(BatchInfo{batch_start_offset, items_in_current_batch});
+    edge_batch_infos.push_back(finish_batch());
   }
 
   std::vector<BatchInfo> vertex_batch_infos;
@@ -3347,6 +3424,7 @@ void CreateSnapshot(Storage *storage, Transaction *transaction, const std::files
     items_in_current_batch = 0;
     offset_vertices = snapshot.GetPosition();
     batch_start_offset = offset_vertices;
+    snapshot.ResetChecksum();
     auto acc = vertices->access();
     for (auto &vertex : acc) {
       // The visibility check is implemented for vertices so we use it here.
@@ -3415,14 +3493,12 @@ void CreateSnapshot(Storage *storage, Transaction *transaction, const std::files
       ++vertices_count;
       ++items_in_current_batch;
       if (items_in_current_batch == storage->config_.durability.items_per_batch) {
-        vertex_batch_infos.push_back(BatchInfo{batch_start_offset, items_in_current_batch});
-        batch_start_offset = snapshot.GetPosition();
-        items_in_current_batch = 0;
+        vertex_batch_infos.push_back(finish_batch());
       }
     }
 
     if (items_in_current_batch > 0) {
-      vertex_batch_infos.push_back(BatchInfo{batch_start_offset, items_in_current_batch});
+      vertex_batch_infos.push_back(finish_batch());
     }
   }
 
@@ -3640,6 +3716,8 @@ void CreateSnapshot(Storage *storage, Transaction *transaction, const std::files
     for (const auto &batch_info : batch_infos) {
       snapshot.WriteUint(batch_info.offset);
       snapshot.WriteUint(batch_info.count);
+      snapshot.WriteUint(batch_info.size);
+      snapshot.WriteUint(*batch_info.checksum);
     }
   };
 
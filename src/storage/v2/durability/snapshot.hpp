@@ -64,6 +64,11 @@ struct RecoveredSnapshot {
 /// @throw RecoveryFailure
 SnapshotInfo ReadSnapshotInfo(const std::filesystem::path &path);
 
+/// Function used to check the checksums of all vertex and edge batches of the
+/// snapshot file. Snapshots older than `kChecksumsVersion` only get their
+/// info checked.
+bool VerifySnapshotFile(const std::filesystem::path &path);
+
 /// Function used to load the snapshot data into the storage.
 /// @throw RecoveryFailure
 RecoveredSnapshot LoadSnapshot(std::filesystem::path const &path, utils::SkipList<Vertex> *vertices,
@@ -11,6 +11,8 @@
 
 #include "storage/v2/durability/wal.hpp"
 
+#include <limits>
+
 #include "storage/v2/constraints/type_constraints_kind.hpp"
 #include "storage/v2/delta.hpp"
 #include "storage/v2/durability/exceptions.hpp"
@@ -557,10 +559,20 @@ WalInfo ReadWalInfo(const std::filesystem::path &path) {
 
   // Read deltas.
   info.num_deltas = 0;
-  auto validate_delta = [&wal, version = *version]() -> std::optional<std::pair<uint64_t, bool>> {
+  auto validate_delta = [&wal, &info, version = *version]() -> std::optional<std::pair<uint64_t, bool>> {
     try {
       auto timestamp = ReadWalDeltaHeader(&wal);
       auto type = SkipWalDeltaData(&wal);
+      // The checksum covers all of the data since the previous checksum.
+      const auto expected_checksum = wal.Checksum();
+      const auto checksum = ReadWalTransactionChecksum(&wal, type, version);
+      if (checksum) {
+        if (*checksum != expected_checksum) {
+          info.checksum_mismatch = true;
+          return std::nullopt;
+        }
+        wal.ResetChecksum();
+      }
       return {{timestamp, IsWalDeltaDataTypeTransactionEnd(type, version)}};
     } catch (const RecoveryFailure &) {
       return std::nullopt;
@@ -576,6 +588,8 @@ WalInfo ReadWalInfo(const std::filesystem::path &path) {
   // non-transactional operation).
   std::optional<uint64_t> current_timestamp;
   uint64_t num_deltas = 0;
+  info.offset_end = info.offset_deltas;
+  wal.ResetChecksum();
   while (wal.GetPosition() != size) {
     auto ret = validate_delta();
     if (!ret) break;
@@ -591,6 +605,7 @@ WalInfo ReadWalInfo(const std::filesystem::path &path) {
       if (timestamp < info.from_timestamp || timestamp < info.to_timestamp) break;
       info.to_timestamp = timestamp;
       info.num_deltas += num_deltas;
+      info.offset_end = *wal.GetPosition();
       current_timestamp = std::nullopt;
       num_deltas = 0;
     }
@@ -601,6 +616,17 @@ WalInfo ReadWalInfo(const std::filesystem::path &path) {
   return info;
 }
 
+bool VerifyWalFile(const std::filesystem::path &path) {
+  try {
+    auto info = ReadWalInfo(path);
+    return info.offset_end == std::filesystem::file_size(path);
+  } catch (const RecoveryFailure &) {
+    return false;
+  } catch (const std::filesystem::filesystem_error &) {
+    return false;
+  }
+}
+
 bool operator==(const WalDeltaData &a, const WalDeltaData &b) {
   if (a.type != b.type) return false;
   switch (a.type) {
@@ -716,6 +742,13 @@ WalDeltaData::Type SkipWalDeltaData(BaseDecoder *decoder) {
   return delta.type;
 }
 
+std::optional<uint32_t> ReadWalTransactionChecksum(BaseDecoder *decoder, WalDeltaData::Type type, uint64_t version) {
+  if (version < kChecksumsVersion || !IsWalDeltaDataTypeTransactionEnd(type, version)) return std::nullopt;
+  auto checksum = decoder->ReadUint();
+  if (!checksum || *checksum > std::numeric_limits<uint32_t>::max()) throw RecoveryFailure("Invalid WAL data!");
+  return static_cast<uint32_t>(*checksum);
+}
+
 void EncodeDelta(BaseEncoder *encoder, NameIdMapper *name_id_mapper, SalientConfig::Items items, const Delta &delta,
                  const Vertex &vertex, uint64_t timestamp) {
   // When converting a Delta to a WAL delta the logic is inverted. That is
@@ -835,6 +868,13 @@ RecoveryInfo LoadWal(const std::filesystem::path &path, RecoveredIndicesAndConst
   auto info = ReadWalInfo(path);
   ret.last_durable_timestamp = info.to_timestamp;
 
+  // Only the WAL file which was being written can end with a torn transaction.
+  // A finalized WAL file was synced as a whole, so a checksum mismatch in it is
+  // corruption and the deltas after it can't be dropped silently.
+  if (info.checksum_mismatch && !IsCurrentWalName(path)) {
+    throw RecoveryFailure("Checksum mismatch in a finalized WAL file!");
+  }
+
   // Check timestamp.
   if (last_loaded_timestamp && info.to_timestamp <= *last_loaded_timestamp) {
     spdlog::info("Skip loading WAL file because it is too old.");
@@ -1228,11 +1268,12 @@ RecoveryInfo LoadWal(const std::filesystem::path &path, RecoveredIndicesAndConst
           break;
         }
       }
+      ReadWalTransactionChecksum(&wal, delta.type, *version);
       ret.next_timestamp = std::max(ret.next_timestamp, timestamp + 1);
       ++deltas_applied;
     } else {
       // This delta should be skipped.
-      SkipWalDeltaData(&wal);
+      ReadWalTransactionChecksum(&wal, SkipWalDeltaData(&wal), *version);
     }
   }
 
@@ -1242,9 +1283,46 @@ RecoveryInfo LoadWal(const std::filesystem::path &path, RecoveredIndicesAndConst
   return ret;
 }
 
+WalSegmentPool::WalSegmentPool(std::filesystem::path directory, uint64_t segment_size, uint64_t capacity)
+    : directory_(std::move(directory)), segment_size_(segment_size), capacity_(capacity) {}
+
+bool WalSegmentPool::Acquire(const std::filesystem::path &path) {
+  std::lock_guard guard(lock_);
+  while (!segments_.empty()) {
+    auto segment = std::move(segments_.back());
+    segments_.pop_back();
+    if (utils::RenamePath(segment, path)) return true;
+    spdlog::warn("Couldn't reuse the WAL file {}!", segment);
+  }
+  return false;
+}
+
+bool WalSegmentPool::Release(const std::filesystem::path &path, utils::FileRetainer *file_retainer) {
+  std::lock_guard guard(lock_);
+  if (segments_.size() >= capacity_) return false;
+  utils::EnsureDirOrDie(directory_);
+  auto segment = directory_ / std::to_string(next_id_++);
+  if (!file_retainer->MoveFileIfUnlocked(path, segment)) return false;
+  segments_.push_back(std::move(segment));
+  return true;
+}
+
+void WalSegmentPool::Clear() {
+  std::lock_guard guard(lock_);
+  segments_.clear();
+  std::error_code error_code;
+  std::filesystem::remove_all(directory_, error_code);
+  if (error_code) spdlog::warn("Couldn't clear the WAL recycle directory {}: {}", directory_, error_code.message());
+}
+
+uint64_t WalSegmentPool::Size() const {
+  std::lock_guard guard(lock_);
+  return segments_.size();
+}
+
 WalFile::WalFile(const std::filesystem::path &wal_directory, const std::string_view uuid,
                  const std::string_view epoch_id, SalientConfig::Items items, NameIdMapper *name_id_mapper,
-                 uint64_t seq_num, utils::FileRetainer *file_retainer)
+                 uint64_t seq_num, utils::FileRetainer *file_retainer, WalSegmentPool *segment_pool)
     : items_(items),
       name_id_mapper_(name_id_mapper),
       path_(wal_directory / MakeWalName()),
@@ -1252,12 +1330,25 @@ WalFile::WalFile(const std::filesystem::path &wal_directory, const std::string_v
       to_timestamp_(0),
       count_(0),
       seq_num_(seq_num),
-      file_retainer_(file_retainer) {
+      file_retainer_(file_retainer),
+      segment_pool_(segment_pool && segment_pool->Enabled() ? segment_pool : nullptr) {
   // Ensure that the storage directory exists.
   utils::EnsureDirOrDie(wal_directory);
 
-  // Initialize the WAL file.
+  // Initialize the WAL file, reusing a pooled one if possible.
+  if (segment_pool_ && !segment_pool_->Acquire(path_)) {
+    spdlog::trace("No recycled WAL file available, preallocating {}", path_);
+  }
   wal_.Initialize(path_, kWalMagic, kVersion);
+  if (segment_pool_) {
+    if (!wal_.Preallocate(segment_pool_->SegmentSize())) {
+      spdlog::warn("The filesystem doesn't support preallocating WAL files.");
+    }
+    // A reused file still has the deltas of its previous WAL after the new
+    // data. Zero isn't a valid marker, so a zero byte after the flushed data
+    // stops readers before they get to the old deltas.
+    wal_.EnableTerminator();
+  }
 
   // Write placeholder offsets.
   uint64_t offset_offsets = 0;
@@ -1282,6 +1373,9 @@ WalFile::WalFile(const std::filesystem::path &wal_directory, const std::string_v
   wal_.WriteUint(offset_deltas);
   wal_.SetPosition(offset_deltas);
 
+  // The first transaction checksum starts after the header.
+  wal_.ResetChecksum();
+
   // Sync the initial data.
   wal_.Sync();
 }
@@ -1296,12 +1390,16 @@ WalFile::WalFile(std::filesystem::path current_wal_path, SalientConfig::Items it
       to_timestamp_(to_timestamp),
       count_(count),
       seq_num_(seq_num),
-      file_retainer_(file_retainer) {
+      file_retainer_(file_retainer),
+      segment_pool_(nullptr) {
   wal_.OpenExisting(path_);
+  wal_.ResetChecksum();
 }
 
 void WalFile::FinalizeWal() {
   if (count_ != 0) {
+    // Finalized WAL files don't keep the preallocated space.
+    if (segment_pool_) wal_.TruncateAtPosition();
     wal_.Finalize();
     // Rename file.
     std::filesystem::path new_path(path_);
@@ -1309,7 +1407,9 @@ void WalFile::FinalizeWal() {
 
     utils::CopyFile(path_, new_path);
     wal_.Close();
-    file_retainer_->DeleteFile(path_);
+    if (!segment_pool_ || !segment_pool_->Release(path_, file_retainer_)) {
+      file_retainer_->DeleteFile(path_);
+    }
     path_ = std::move(new_path);
   }
 }
@@ -1322,7 +1422,10 @@ void WalFile::DeleteWal() {
 WalFile::~WalFile() {
   if (count_ == 0) {
     // Remove empty WAL file.
-    utils::DeleteFile(path_);
+    wal_.Close();
+    if (!segment_pool_ || !segment_pool_->Release(path_, file_retainer_)) {
+      utils::DeleteFile(path_);
+    }
   }
 }
 
@@ -1338,12 +1441,24 @@ void WalFile::AppendDelta(const Delta &delta, const Edge &edge, uint64_t timesta
 
 void WalFile::AppendTransactionEnd(uint64_t timestamp) {
   EncodeTransactionEnd(&wal_, timestamp);
+  // Each transaction is followed by the checksum of all of its deltas.
+  wal_.WriteUint(wal_.Checksum());
+  wal_.ResetChecksum();
   UpdateStats(timestamp);
 }
 
 void WalFile::Sync() { wal_.Sync(); }
 
-uint64_t WalFile::GetSize() { return wal_.GetSize(); }
+uint64_t WalFile::GetSize() {
+  // The size of a preallocated file doesn't tell how much was written to it.
+  if (segment_pool_) return wal_.GetFlushedPosition() + wal_.CurrentFileBuffer().second;
+  return wal_.GetSize();
+}
+
+uint64_t WalFile::GetFlushedSize() {
+  if (segment_pool_) return wal_.GetFlushedPosition();
+  return std::filesystem::file_size(path_);
+}
 
 uint64_t WalFile::SequenceNumber() const { return seq_num_; }
 
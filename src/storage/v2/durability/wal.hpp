@@ -13,8 +13,10 @@
 
 #include <cstdint>
 #include <filesystem>
+#include <mutex>
 #include <set>
 #include <string>
+#include <vector>
 
 #include "storage/v2/config.hpp"
 #include "storage/v2/delta.hpp"
@@ -46,6 +48,11 @@ struct WalInfo {
   uint64_t from_timestamp;
   uint64_t to_timestamp;
   uint64_t num_deltas;
+  // End of the last valid transaction.
+  uint64_t offset_end;
+  // The transaction starting at `offset_end` was read completely, but its
+  // checksum doesn't match.
+  bool checksum_mismatch{false};
 };
 
 /// Structure used to return loaded WAL delta data.
@@ -239,6 +246,10 @@ constexpr bool IsWalDeltaDataTypeTransactionEnd(const WalDeltaData::Type type, c
 /// @throw RecoveryFailure
 WalInfo ReadWalInfo(const std::filesystem::path &path);
 
+/// Function used to check that the whole WAL file consists of valid
+/// transactions whose checksums match.
+bool VerifyWalFile(const std::filesystem::path &path);
+
 /// Function used to read the WAL delta header. The function returns the delta
 /// timestamp.
 /// @throw RecoveryFailure
@@ -256,6 +267,12 @@ WalDeltaData ReadWalDeltaData(BaseDecoder *decoder);
 /// @throw RecoveryFailure
 WalDeltaData::Type SkipWalDeltaData(BaseDecoder *decoder);
 
+/// Function used to read the checksum which follows the last delta of each
+/// transaction in WAL files since `kChecksumsVersion`. The function returns
+/// std::nullopt if the delta of the given type isn't followed by a checksum.
+/// @throw RecoveryFailure
+std::optional<uint32_t> ReadWalTransactionChecksum(BaseDecoder *decoder, WalDeltaData::Type type, uint64_t version);
+
 /// Function used to encode a `Delta` that originated from a `Vertex`.
 void EncodeDelta(BaseEncoder *encoder, NameIdMapper *name_id_mapper, SalientConfig::Items items, const Delta &delta,
                  const Vertex &vertex, uint64_t timestamp);
@@ -298,11 +315,60 @@ RecoveryInfo LoadWal(std::filesystem::path const &path, RecoveredIndicesAndConst
                      std::function<std::optional<std::tuple<EdgeRef, EdgeTypeId, Vertex *, Vertex *>>(Gid)> find_edge);
 
 /// WalFile class used to append deltas and operations to the WAL file.
+/// Pool of WAL files which are no longer needed, kept so that new WAL files
+/// can reuse them. Writing to a file whose blocks are already allocated and
+/// which doesn't grow lets `fdatasync` skip the filesystem metadata, which is
+/// what makes syncing after every transaction expensive. New WAL files that
+/// can't reuse a pooled file are preallocated to the segment size instead.
+///
+/// Reused files still contain the deltas of their previous WAL after the
+/// written data. Those deltas are older than any delta in the new WAL, so
+/// reading stops at them, but that only holds while the timestamps grow, so
+/// the pool has to be cleared whenever the storage timestamps are reset.
+class WalSegmentPool {
+ public:
+  /// Pooled files are kept in `directory`. A `capacity` of 0 disables the
+  /// pool and the preallocation.
+  WalSegmentPool(std::filesystem::path directory, uint64_t segment_size, uint64_t capacity);
+
+  WalSegmentPool(const WalSegmentPool &) = delete;
+  WalSegmentPool(WalSegmentPool &&) = delete;
+  WalSegmentPool &operator=(const WalSegmentPool &) = delete;
+  WalSegmentPool &operator=(WalSegmentPool &&) = delete;
+
+  ~WalSegmentPool() = default;
+
+  bool Enabled() const { return capacity_ > 0; }
+
+  uint64_t SegmentSize() const { return segment_size_; }
+
+  /// Moves a pooled file to `path`. Returns false if the pool is empty.
+  bool Acquire(const std::filesystem::path &path);
+
+  /// Moves the file at `path` into the pool. Returns false if the pool is full
+  /// or the file is locked by the retainer.
+  bool Release(const std::filesystem::path &path, utils::FileRetainer *file_retainer);
+
+  /// Deletes all pooled files, including the ones left in the directory by a
+  /// previous run.
+  void Clear();
+
+  uint64_t Size() const;
+
+ private:
+  std::filesystem::path directory_;
+  uint64_t segment_size_;
+  uint64_t capacity_;
+  uint64_t next_id_{0};
+  std::vector<std::filesystem::path> segments_;
+  mutable std::mutex lock_;
+};
+
 class WalFile {
  public:
   WalFile(const std::filesystem::path &wal_directory, const std::string_view uuid, const std::string_view epoch_id,
           SalientConfig::Items items, NameIdMapper *name_id_mapper, uint64_t seq_num,
-          utils::FileRetainer *file_retainer);
+          utils::FileRetainer *file_retainer, WalSegmentPool *segment_pool = nullptr);
   WalFile(std::filesystem::path current_wal_path, SalientConfig::Items items, NameIdMapper *name_id_mapper,
           uint64_t seq_num, uint64_t from_timestamp, uint64_t to_timestamp, uint64_t count,
           utils::FileRetainer *file_retainer);
@@ -330,6 +396,10 @@ class WalFile {
 
   uint64_t GetSize();
 
+  // Get the size of the data that is written to the file, without the data in
+  // the internal buffer.
+  uint64_t GetFlushedSize();
+
   uint64_t SequenceNumber() const;
 
   auto FromTimestamp() const { return from_timestamp_; }
@@ -368,6 +438,7 @@ class WalFile {
   uint64_t seq_num_;
 
   utils::FileRetainer *file_retainer_;
+  WalSegmentPool *segment_pool_;
 };
 
 }  // namespace memgraph::storage::durability
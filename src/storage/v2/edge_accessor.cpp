@@ -49,13 +49,13 @@ bool EdgeAccessor::IsVisible(const View view) const {
     bool attached = true;
     Delta *delta = nullptr;
     {
-      auto guard = std::shared_lock{from_vertex_->lock};
+      auto guard = LockForRead(*from_vertex_, transaction_);
       // Initialize deleted by checking if out edges contain edge_
       attached =
           std::find_if(from_vertex_->out_edges.begin(), from_vertex_->out_edges.end(), [&](const auto &out_edge) {
             return std::get<2>(out_edge) == edge_ && std::get<0>(out_edge) == edge_type_;
           }) != from_vertex_->out_edges.end();
-      delta = from_vertex_->delta;
+      delta = DeltaForRead(*from_vertex_, transaction_);
     }
     ApplyDeltasForRead(transaction_, delta, view, [&](const Delta &delta) {
       switch (delta.action) {
@@ -88,12 +88,12 @@ bool EdgeAccessor::IsVisible(const View view) const {
     bool attached = true;
     Delta *delta = nullptr;
     {
-      auto guard = std::shared_lock{to_vertex_->lock};
+      auto guard = LockForRead(*to_vertex_, transaction_);
       // Initialize deleted by checking if out edges contain edge_
       attached = std::find_if(to_vertex_->in_edges.begin(), to_vertex_->in_edges.end(), [&](const auto &in_edge) {
                    return std::get<2>(in_edge) == edge_ && std::get<0>(in_edge) == edge_type_;
                  }) != to_vertex_->in_edges.end();
-      delta = to_vertex_->delta;
+      delta = DeltaForRead(*to_vertex_, transaction_);
     }
     ApplyDeltasForRead(transaction_, delta, view, [&](const Delta &delta) {
       switch (delta.action) {
@@ -126,9 +126,9 @@ bool EdgeAccessor::IsVisible(const View view) const {
     bool deleted = true;
     Delta *delta = nullptr;
     {
-      auto guard = std::shared_lock{edge_.ptr->lock};
+      auto guard = LockForRead(*edge_.ptr, transaction_);
       deleted = edge_.ptr->deleted;
-      delta = edge_.ptr->delta;
+      delta = DeltaForRead(*edge_.ptr, transaction_);
     }
     ApplyDeltasForRead(transaction_, delta, view, [&](const Delta &delta) {
       switch (delta.action) {
@@ -330,10 +330,10 @@ Result<PropertyValue> EdgeAccessor::GetProperty(PropertyId property, View view)
   std::optional<PropertyValue> value;
   Delta *delta = nullptr;
   {
-    auto guard = std::shared_lock{edge_.ptr->lock};
+    auto guard = LockForRead(*edge_.ptr, transaction_);
     deleted = edge_.ptr->deleted;
     value.emplace(edge_.ptr->properties.GetProperty(property));
-    delta = edge_.ptr->delta;
+    delta = DeltaForRead(*edge_.ptr, transaction_);
   }
   ApplyDeltasForRead(transaction_, delta, view, [&exists, &deleted, &value, property](const Delta &delta) {
     switch (delta.action) {
@@ -369,8 +369,8 @@ Result<PropertyValue> EdgeAccessor::GetProperty(PropertyId property, View view)
 Result<uint64_t> EdgeAccessor::GetPropertySize(PropertyId property, View view) const {
   if (!storage_->config_.salient.items.properties_on_edges) return 0;
 
-  auto guard = std::shared_lock{edge_.ptr->lock};
-  Delta *delta = edge_.ptr->delta;
+  auto guard = LockForRead(*edge_.ptr, transaction_);
+  Delta *delta = DeltaForRead(*edge_.ptr, transaction_);
   if (!delta) {
     return edge_.ptr->properties.PropertySize(property);
   }
@@ -394,10 +394,10 @@ Result<std::map<PropertyId, PropertyValue>> EdgeAccessor::Properties(View view)
   std::map<PropertyId, PropertyValue> properties;
   Delta *delta = nullptr;
   {
-    auto guard = std::shared_lock{edge_.ptr->lock};
+    auto guard = LockForRead(*edge_.ptr, transaction_);
     deleted = edge_.ptr->deleted;
     properties = edge_.ptr->properties.Properties();
-    delta = edge_.ptr->delta;
+    delta = DeltaForRead(*edge_.ptr, transaction_);
   }
   ApplyDeltasForRead(transaction_, delta, view, [&exists, &deleted, &properties](const Delta &delta) {
     switch (delta.action) {
@@ -9,6 +9,8 @@
 // by the Apache License, Version 2.0, included in the file
 // licenses/APL.txt.
 
+#pragma once
+
 #include <thread>
 #include "storage/v2/delta.hpp"
 #include "storage/v2/durability/recovery_type.hpp"
@@ -234,11 +236,11 @@ inline bool CurrentVersionHasLabelProperty(const Vertex &vertex, LabelId label,
   bool current_value_equal_to_value = value.IsNull();
   const Delta *delta = nullptr;
   {
-    auto guard = std::shared_lock{vertex.lock};
+    auto guard = LockForRead(vertex, transaction);
     deleted = vertex.deleted;
     has_label = utils::Contains(vertex.labels, label);
     current_value_equal_to_value = vertex.properties.IsPropertyEqual(key, value);
-    delta = vertex.delta;
+    delta = DeltaForRead(vertex, transaction);
   }
 
   // Checking cache has a cost, only do it if we have any deltas
@@ -292,10 +294,10 @@ inline bool CurrentEdgeVersionHasProperty(const Edge &edge, PropertyId key, cons
   bool current_value_equal_to_value = value.IsNull();
   const Delta *delta = nullptr;
   {
-    auto guard = std::shared_lock{edge.lock};
+    auto guard = LockForRead(edge, transaction);
     deleted = edge.deleted;
     current_value_equal_to_value = edge.properties.IsPropertyEqual(key, value);
-    delta = edge.delta;
+    delta = DeltaForRead(edge, transaction);
   }
 
   // Checking cache has a cost, only do it if we have any deltas
@@ -419,4 +421,39 @@ inline bool CanSeeEntityWithTimestamp(uint64_t insertion_timestamp, Transaction
   return insertion_timestamp < transaction->original_start_timestamp.value();
 }
 
+// Index entries point to vertices which are scattered across the vertices skip list, so every step of an index scan
+// is a cache miss on the vertex. The prefetcher keeps an iterator `kDistance` entries ahead of the scan and hints the
+// CPU to start loading the vertex it points to (its labels and the lock/delta part, which are on different cache
+// lines), so the loads overlap with checking the visibility of the entries in between. Only the lookahead iterator
+// stalls on loading the index nodes, the scan finds them in the cache afterwards.
+inline constexpr uint64_t kIndexPrefetchDistance = 8;
+
+template <typename TIndexIterator, uint64_t kDistance = kIndexPrefetchDistance>
+class IndexedVertexPrefetcher {
+ public:
+  // Has to be called for every entry the scan visits, in order.
+  void Step(TIndexIterator const &index_iterator, TIndexIterator const &index_end) {
+    if (distance_ == 0) {
+      ahead_ = index_iterator;
+    } else {
+      --distance_;
+    }
+    while (distance_ < kDistance && ahead_ != index_end) {
+      ++ahead_;
+      ++distance_;
+      if (ahead_ == index_end) break;
+      Vertex const *vertex = ahead_->vertex;
+      __builtin_prefetch(&vertex->labels);
+      __builtin_prefetch(&vertex->delta);
+    }
+  }
+
+  // Has to be called when the scan jumps to another position.
+  void Reset() { distance_ = 0; }
+
+ private:
+  TIndexIterator ahead_{};
+  uint64_t distance_{0};
+};
+
 }  // namespace memgraph::storage
@@ -17,13 +17,45 @@
 #include "query/exceptions.hpp"  // TODO: remove from storage
 #include "storage/v2/id_types.hpp"
 #include "storage/v2/property_value.hpp"
+#include "storage/v2/transaction.hpp"
 #include "storage/v2/view.hpp"
+#include "utils/event_histogram.hpp"
 
+#include <algorithm>
+#include <iterator>
+#include <map>
+#include <set>
+#include <shared_mutex>
 #include <span>
 #include <vector>
 
+namespace memgraph::metrics {
+extern const Event TextIndexRefreshLag_us;
+}  // namespace memgraph::metrics
+
 namespace memgraph::storage {
 
+TextIndex::TextIndex() {
+  if (flags::AreExperimentsEnabled(flags::Experiments::TEXT_SEARCH) && FLAGS_text_search_refresh_interval_ms > 0) {
+    refresher_.Run("TextIndexRefresh", std::chrono::milliseconds(FLAGS_text_search_refresh_interval_ms), [this] {
+      try {
+        Refresh();
+      } catch (const std::exception &e) {
+        spdlog::error("Failed to apply pending text index changes: {}", e.what());
+      }
+    });
+  }
+}
+
+TextIndex::~TextIndex() {
+  refresher_.Stop();
+  try {
+    Refresh();
+  } catch (const std::exception &e) {
+    spdlog::error("Failed to apply pending text index changes: {}", e.what());
+  }
+}
+
 std::string GetPropertyName(PropertyId prop_id, NameIdMapper *name_id_mapper) {
   return name_id_mapper->IdToName(prop_id.AsUint());
 }
@@ -118,28 +150,8 @@ std::string TextIndex::StringifyProperties(const std::map<PropertyId, PropertyVa
   return utils::Join(indexable_properties_as_string, " ");
 }
 
-std::vector<mgcxx::text_search::Context *> TextIndex::GetApplicableTextIndices(
-    std::span<storage::LabelId const> labels) {
-  if (!flags::AreExperimentsEnabled(flags::Experiments::TEXT_SEARCH)) {
-    throw query::TextSearchDisabledException();
-  }
-
-  std::vector<mgcxx::text_search::Context *> applicable_text_indices;
-  for (const auto &label : labels) {
-    if (label_to_index_.contains(label)) {
-      applicable_text_indices.push_back(&index_.at(label_to_index_.at(label)).context_);
-    }
-  }
-  return applicable_text_indices;
-}
-
-void TextIndex::LoadNodeToTextIndices(const std::int64_t gid, const nlohmann::json &properties,
-                                      const std::string &property_values_as_str,
-                                      const std::vector<mgcxx::text_search::Context *> &applicable_text_indices) {
-  if (applicable_text_indices.empty()) {
-    return;
-  }
-
+std::string TextIndex::MakeDocument(std::int64_t gid, const nlohmann::json &properties,
+                                    const std::string &property_values_as_str) {
   // NOTE: Text indexes are presently all-property indices. If we allow text indexes restricted to specific properties,
   // an indexable document should be created for each applicable index.
   nlohmann::json document = {};
@@ -149,14 +161,21 @@ void TextIndex::LoadNodeToTextIndices(const std::int64_t gid, const nlohmann::js
   document["metadata"]["gid"] = gid;
   document["metadata"]["deleted"] = false;
   document["metadata"]["is_node"] = true;
+  return document.dump(-1, ' ', false, nlohmann::json::error_handler_t::replace);
+}
+
+void TextIndex::LoadNodeToTextIndices(const std::int64_t gid, const nlohmann::json &properties,
+                                      const std::string &property_values_as_str,
+                                      const std::vector<mgcxx::text_search::Context *> &applicable_text_indices) {
+  if (applicable_text_indices.empty()) {
+    return;
+  }
 
+  auto const document = MakeDocument(gid, properties, property_values_as_str);
   for (auto *index_context : applicable_text_indices) {
     try {
-      mgcxx::text_search::add_document(
-          *index_context,
-          mgcxx::text_search::DocumentInput{
-              .data = document.dump(-1, ' ', false, nlohmann::json::error_handler_t::replace)},
-          kDoSkipCommit);
+      mgcxx::text_search::add_document(*index_context, mgcxx::text_search::DocumentInput{.data = document},
+                                       kDoSkipCommit);
     } catch (const std::exception &e) {
       throw query::TextSearchException("Tantivy error: {}", e.what());
     }
@@ -174,59 +193,29 @@ void TextIndex::CommitLoadedNodes(mgcxx::text_search::Context &index_context) {
   }
 }
 
-void TextIndex::AddNode(
-    Vertex *vertex_after_update, NameIdMapper *name_id_mapper,
-    const std::optional<std::vector<mgcxx::text_search::Context *>> &maybe_applicable_text_indices) {
+void TextIndex::AddNode(Vertex *vertex, Transaction &transaction) {
   if (!flags::AreExperimentsEnabled(flags::Experiments::TEXT_SEARCH)) {
     throw query::TextSearchDisabledException();
   }
 
-  auto applicable_text_indices =
-      maybe_applicable_text_indices.value_or(GetApplicableTextIndices(vertex_after_update->labels));
-  if (applicable_text_indices.empty()) {
-    return;
-  }
-
-  auto vertex_properties = vertex_after_update->properties.Properties();
-  LoadNodeToTextIndices(vertex_after_update->gid.AsInt(), SerializeProperties(vertex_properties, name_id_mapper),
-                        StringifyProperties(vertex_properties), applicable_text_indices);
+  transaction.text_index_changes_.try_emplace(vertex);
 }
 
-void TextIndex::UpdateNode(Vertex *vertex_after_update, NameIdMapper *name_id_mapper,
-                           const std::vector<LabelId> &removed_labels) {
+void TextIndex::UpdateNode(Vertex *vertex, Transaction &transaction, const std::vector<LabelId> &removed_labels) {
   if (!flags::AreExperimentsEnabled(flags::Experiments::TEXT_SEARCH)) {
     throw query::TextSearchDisabledException();
   }
 
-  if (!removed_labels.empty()) {
-    auto indexes_to_remove_node_from = GetApplicableTextIndices(removed_labels);
-    RemoveNode(vertex_after_update, indexes_to_remove_node_from);
-  }
-
-  auto applicable_text_indices = GetApplicableTextIndices(vertex_after_update->labels);
-  if (applicable_text_indices.empty()) return;
-  RemoveNode(vertex_after_update, applicable_text_indices);
-  AddNode(vertex_after_update, name_id_mapper, applicable_text_indices);
+  auto &vertex_removed_labels = transaction.text_index_changes_[vertex];
+  vertex_removed_labels.insert(vertex_removed_labels.end(), removed_labels.begin(), removed_labels.end());
 }
 
-void TextIndex::RemoveNode(
-    Vertex *vertex_after_update,
-    const std::optional<std::vector<mgcxx::text_search::Context *>> &maybe_applicable_text_indices) {
+void TextIndex::RemoveNode(Vertex *vertex, Transaction &transaction) {
   if (!flags::AreExperimentsEnabled(flags::Experiments::TEXT_SEARCH)) {
     throw query::TextSearchDisabledException();
   }
 
-  auto search_node_to_be_deleted =
-      mgcxx::text_search::SearchInput{.search_query = fmt::format("metadata.gid:{}", vertex_after_update->gid.AsInt())};
-
-  for (auto *index_context :
-       maybe_applicable_text_indices.value_or(GetApplicableTextIndices(vertex_after_update->labels))) {
-    try {
-      mgcxx::text_search::delete_document(*index_context, search_node_to_be_deleted, kDoSkipCommit);
-    } catch (const std::exception &e) {
-      throw query::TextSearchException("Tantivy error: {}", e.what());
-    }
-  }
+  transaction.text_index_changes_.try_emplace(vertex);
 }
 
 void TextIndex::CreateIndex(std::filesystem::path const &storage_dir, std::string const &index_name, LabelId label,
@@ -235,6 +224,9 @@ void TextIndex::CreateIndex(std::filesystem::path const &storage_dir, std::strin
     throw query::TextSearchDisabledException();
   }
 
+  auto guard = std::lock_guard{indexer_lock_};
+  ApplyPendingChanges();
+
   CreateEmptyIndex(storage_dir, index_name, label);
 
   for (const auto &v : vertices) {
@@ -256,6 +248,8 @@ void TextIndex::RecoverIndex(const std::filesystem::path &storage_dir, const std
     throw query::TextSearchDisabledException();
   }
 
+  auto guard = std::lock_guard{indexer_lock_};
+
   // Clear Tantivy-internal files if they exist from previous sessions
   std::filesystem::remove_all(storage_dir / kTextIndicesDirectory / index_name);
 
@@ -279,6 +273,9 @@ LabelId TextIndex::DropIndex(const std::filesystem::path &storage_dir, const std
     throw query::TextSearchDisabledException();
   }
 
+  auto guard = std::lock_guard{indexer_lock_};
+  ApplyPendingChanges();
+
   if (!index_.contains(index_name)) {
     throw query::TextSearchException("Text index \"{}\" doesn’t exist.", index_name);
   }
@@ -349,6 +346,10 @@ std::vector<Gid> TextIndex::Search(const std::string &index_name, const std::str
     throw query::TextSearchException("Text index \"{}\" doesn’t exist.", index_name);
   }
 
+  if (FLAGS_text_search_wait_for_refresh) {
+    Refresh();
+  }
+
   mgcxx::text_search::SearchOutput search_results;
   switch (search_mode) {
     case text_search_mode::SPECIFIED_PROPERTIES:
@@ -388,6 +389,10 @@ std::string TextIndex::Aggregate(const std::string &index_name, const std::strin
     throw query::TextSearchException("Text index \"{}\" doesn’t exist.", index_name);
   }
 
+  if (FLAGS_text_search_wait_for_refresh) {
+    Refresh();
+  }
+
   mgcxx::text_search::DocumentOutput aggregation_result;
   try {
     aggregation_result = mgcxx::text_search::aggregate(
@@ -405,23 +410,135 @@ std::string TextIndex::Aggregate(const std::string &index_name, const std::strin
   return result_string;
 }
 
-void TextIndex::Commit() {
+TextIndex::PendingBatch TextIndex::PrepareCommit(Transaction &transaction, NameIdMapper *name_id_mapper) {
   if (!flags::AreExperimentsEnabled(flags::Experiments::TEXT_SEARCH)) {
     throw query::TextSearchDisabledException();
   }
 
-  for (auto &[_, index_data] : index_) {
-    mgcxx::text_search::commit(index_data.context_);
+  PendingBatch batch;
+  for (auto const &[vertex, removed_labels] : transaction.text_index_changes_) {
+    bool deleted = false;
+    std::vector<LabelId> labels;
+    std::map<PropertyId, PropertyValue> properties;
+    {
+      auto guard = std::shared_lock{vertex->lock};
+      deleted = vertex->deleted;
+      labels.assign(vertex->labels.begin(), vertex->labels.end());
+      if (!deleted && std::ranges::any_of(labels, [&](auto label) { return label_to_index_.contains(label); })) {
+        properties = vertex->properties.Properties();
+      }
+    }
+
+    auto const gid = vertex->gid.AsInt();
+    std::vector<std::string_view> changed_indices;
+    if (!deleted) {
+      std::optional<std::string> document;
+      for (auto label : labels) {
+        auto it = label_to_index_.find(label);
+        if (it == label_to_index_.end()) continue;
+        if (!document) {
+          document = MakeDocument(gid, SerializeProperties(properties, name_id_mapper), StringifyProperties(properties));
+        }
+        batch.changes.push_back({.index_name = it->second, .gid = gid, .document = document});
+        changed_indices.emplace_back(it->second);
+      }
+    }
+
+    // Documents in indices the vertex no longer belongs to are only deleted
+    auto const remove_from = [&](LabelId label) {
+      auto it = label_to_index_.find(label);
+      if (it == label_to_index_.end() || std::ranges::find(changed_indices, it->second) != changed_indices.end()) {
+        return;
+      }
+      batch.changes.push_back({.index_name = it->second, .gid = gid, .document = std::nullopt});
+      changed_indices.emplace_back(it->second);
+    };
+    std::ranges::for_each(removed_labels, remove_from);
+    if (deleted) std::ranges::for_each(labels, remove_from);
+  }
+  transaction.text_index_changes_.clear();
+  return batch;
+}
+
+void TextIndex::Commit(PendingBatch batch, uint64_t commit_timestamp) {
+  if (batch.changes.empty()) {
+    return;
   }
+  batch.commit_timestamp = commit_timestamp;
+  batch.committed_at = std::chrono::steady_clock::now();
+  pending_batches_.WithLock([&](auto &pending_batches) { pending_batches.push_back(std::move(batch)); });
 }
 
-void TextIndex::Rollback() {
-  if (!flags::AreExperimentsEnabled(flags::Experiments::TEXT_SEARCH)) {
-    throw query::TextSearchDisabledException();
+void TextIndex::ApplyCommitted() {
+  if (FLAGS_text_search_refresh_interval_ms != 0) {
+    return;
+  }
+  try {
+    Refresh();
+  } catch (const std::exception &e) {
+    spdlog::error("Failed to apply pending text index changes: {}", e.what());
+  }
+}
+
+void TextIndex::Refresh() {
+  auto guard = std::lock_guard{indexer_lock_};
+  ApplyPendingChanges();
+}
+
+void TextIndex::ApplyPendingChanges() {
+  auto batches = pending_batches_.WithLock([](auto &pending_batches) { return std::exchange(pending_batches, {}); });
+  if (batches.empty()) {
+    return;
+  }
+
+  // Every change replaces the whole document, so only the change of the newest transaction has to be applied
+  std::map<std::pair<std::string_view, std::int64_t>, std::pair<uint64_t, const PendingChange *>> last_changes;
+  for (auto const &batch : batches) {
+    for (auto const &change : batch.changes) {
+      auto [it, inserted] =
+          last_changes.try_emplace({change.index_name, change.gid}, batch.commit_timestamp, &change);
+      if (!inserted && it->second.first <= batch.commit_timestamp) {
+        it->second = {batch.commit_timestamp, &change};
+      }
+    }
+  }
+
+  try {
+    std::set<mgcxx::text_search::Context *> changed_contexts;
+    for (auto const &[_, last_change] : last_changes) {
+      auto const *change = last_change.second;
+      auto it = index_.find(change->index_name);
+      // The index was dropped in the meantime
+      if (it == index_.end()) continue;
+
+      auto &index_context = it->second.context_;
+      mgcxx::text_search::delete_document(
+          index_context, mgcxx::text_search::SearchInput{.search_query = fmt::format("metadata.gid:{}", change->gid)},
+          kDoSkipCommit);
+      if (change->document) {
+        mgcxx::text_search::add_document(index_context, mgcxx::text_search::DocumentInput{.data = *change->document},
+                                         kDoSkipCommit);
+      }
+      changed_contexts.insert(&index_context);
+    }
+
+    for (auto *index_context : changed_contexts) {
+      mgcxx::text_search::commit(*index_context);
+    }
+  } catch (const std::exception &e) {
+    // The changes belong to committed transactions and can't be dropped. Applying a change again is harmless since
+    // the old document is always deleted first, so the batches go back in front of the ones queued in the meantime.
+    pending_batches_.WithLock([&](auto &pending_batches) {
+      pending_batches.insert(pending_batches.begin(), std::make_move_iterator(batches.begin()),
+                             std::make_move_iterator(batches.end()));
+    });
+    throw query::TextSearchException("Tantivy error: {}", e.what());
   }
 
-  for (auto &[_, index_data] : index_) {
-    mgcxx::text_search::rollback(index_data.context_);
+  auto const now = std::chrono::steady_clock::now();
+  for (auto const &batch : batches) {
+    memgraph::metrics::Measure(memgraph::metrics::TextIndexRefreshLag_us,
+                               std::chrono::duration_cast<std::chrono::microseconds>(now - batch.committed_at).count());
   }
 }
 
@@ -11,6 +11,9 @@
 
 #pragma once
 
+#include <chrono>
+#include <mutex>
+
 #include <json/json.hpp>
 #include "mg_procedure.h"
 #include "storage/v2/id_types.hpp"
@@ -18,12 +21,17 @@
 #include "storage/v2/vertex.hpp"
 #include "storage/v2/vertices_iterable.hpp"
 #include "text_search.hpp"
+#include "utils/scheduler.hpp"
+#include "utils/spin_lock.hpp"
+#include "utils/synchronized.hpp"
 
 namespace memgraph::query {
 class DbAccessor;
 }
 
 namespace memgraph::storage {
+struct Transaction;
+
 struct TextIndexData {
   mgcxx::text_search::Context context_;
   LabelId scope_;
@@ -43,12 +51,17 @@ class TextIndex {
 
   std::string StringifyProperties(const std::map<PropertyId, PropertyValue> &properties);
 
-  std::vector<mgcxx::text_search::Context *> GetApplicableTextIndices(std::span<storage::LabelId const> labels);
+  static std::string MakeDocument(std::int64_t gid, const nlohmann::json &properties,
+                                  const std::string &property_values_as_str);
 
   void LoadNodeToTextIndices(const std::int64_t gid, const nlohmann::json &properties,
                              const std::string &property_values_as_str,
                              const std::vector<mgcxx::text_search::Context *> &applicable_text_indices);
 
+  /// Applies all pending batches with a single Tantivy commit per touched index. Must be called while holding
+  /// `indexer_lock_`. The batches are queued again if applying them fails.
+  void ApplyPendingChanges();
+
   void CommitLoadedNodes(mgcxx::text_search::Context &index_context);
 
   mgcxx::text_search::SearchOutput SearchGivenProperties(const std::string &index_name,
@@ -59,27 +72,39 @@ class TextIndex {
   mgcxx::text_search::SearchOutput SearchAllProperties(const std::string &index_name, const std::string &search_query);
 
  public:
-  TextIndex() = default;
+  // Document change of a committed transaction that still has to be applied to Tantivy. The old document is always
+  // deleted; a new one is added if `document` is set.
+  struct PendingChange {
+    std::string index_name;
+    std::int64_t gid;
+    std::optional<std::string> document;
+  };
+
+  struct PendingBatch {
+    std::vector<PendingChange> changes;
+    uint64_t commit_timestamp{0};
+    std::chrono::steady_clock::time_point committed_at;
+  };
+
+  TextIndex();
 
   TextIndex(const TextIndex &) = delete;
   TextIndex(TextIndex &&) = delete;
   TextIndex &operator=(const TextIndex &) = delete;
   TextIndex &operator=(TextIndex &&) = delete;
 
-  ~TextIndex() = default;
+  ~TextIndex();
 
   std::map<std::string, TextIndexData> index_;
   std::map<LabelId, std::string> label_to_index_;
 
-  void AddNode(
-      Vertex *vertex, NameIdMapper *name_id_mapper,
-      const std::optional<std::vector<mgcxx::text_search::Context *>> &maybe_applicable_text_indices = std::nullopt);
+  /// The following three functions only record the vertex in `transaction`; its documents are rebuilt once when the
+  /// transaction commits, no matter how many times it was changed.
+  void AddNode(Vertex *vertex, Transaction &transaction);
 
-  void UpdateNode(Vertex *vertex, NameIdMapper *name_id_mapper, const std::vector<LabelId> &removed_labels = {});
+  void UpdateNode(Vertex *vertex, Transaction &transaction, const std::vector<LabelId> &removed_labels = {});
 
-  void RemoveNode(
-      Vertex *vertex,
-      const std::optional<std::vector<mgcxx::text_search::Context *>> &maybe_applicable_text_indices = std::nullopt);
+  void RemoveNode(Vertex *vertex, Transaction &transaction);
 
   void CreateIndex(std::filesystem::path const &storage_dir, std::string const &index_name, LabelId label,
                    memgraph::storage::VerticesIterable vertices, NameIdMapper *nameIdMapper);
@@ -96,11 +121,28 @@ class TextIndex {
   std::string Aggregate(const std::string &index_name, const std::string &search_query,
                         const std::string &aggregation_query);
 
-  void Commit();
+  /// Turns the changes recorded in `transaction` into documents. Must be called before the commit is published, while
+  /// the changed vertices still hold the state of `transaction` and can't be freed by GC.
+  PendingBatch PrepareCommit(Transaction &transaction, NameIdMapper *name_id_mapper);
+
+  /// Queues the documents of the transaction committed at `commit_timestamp`. Must be called before the engine lock
+  /// is released, so that a newer transaction changing the same vertex can't queue its documents first.
+  void Commit(PendingBatch batch, uint64_t commit_timestamp);
 
-  void Rollback();
+  /// Applies the queued documents to Tantivy right away, unless the background indexer does it every
+  /// `--text-search-refresh-interval-ms`. The transactions are already committed at this point, so a failure is only
+  /// logged and the documents stay queued for the next refresh.
+  void ApplyCommitted();
+
+  /// Applies all changes of committed transactions that are still waiting for the background indexer.
+  void Refresh();
 
   std::vector<std::pair<std::string, LabelId>> ListIndices() const;
+
+ private:
+  std::mutex indexer_lock_;
+  utils::Synchronized<std::vector<PendingBatch>, utils::SpinLock> pending_batches_;
+  utils::Scheduler refresher_;
 };
 
 }  // namespace memgraph::storage
@@ -11,6 +11,7 @@
 
 #include "storage/v2/inmemory/label_index.hpp"
 
+#include <functional>
 #include <span>
 
 #include "storage/v2/constraints/constraints.hpp"
@@ -67,7 +68,10 @@ bool InMemoryLabelIndex::CreateIndex(
   return create_index_seq(label, vertices, it);
 }
 
-bool InMemoryLabelIndex::DropIndex(LabelId label) { return index_.erase(label) > 0; }
+bool InMemoryLabelIndex::DropIndex(LabelId label) {
+  scan_positions_->erase(label);
+  return index_.erase(label) > 0;
+}
 
 bool InMemoryLabelIndex::IndexExists(LabelId label) const { return index_.find(label) != index_.end(); }
 
@@ -124,19 +128,33 @@ void InMemoryLabelIndex::AbortEntries(LabelId labelId, std::span<Vertex *const>
 
 InMemoryLabelIndex::Iterable::Iterable(utils::SkipList<Entry>::Accessor index_accessor,
                                        utils::SkipList<Vertex>::ConstAccessor vertices_accessor, LabelId label,
-                                       View view, Storage *storage, Transaction *transaction)
+                                       View view, Storage *storage, Transaction *transaction,
+                                       ScanPositions *scan_positions)
     : pin_accessor_(std::move(vertices_accessor)),
       index_accessor_(std::move(index_accessor)),
       label_(label),
       view_(view),
       storage_(storage),
-      transaction_(transaction) {}
+      transaction_(transaction),
+      scan_positions_(scan_positions) {
+  if (scan_positions_) {
+    auto positions = scan_positions_->Lock();
+    if (auto it = positions->find(label_); it != positions->end()) scan_start_ = it->second;
+  }
+}
+
+InMemoryLabelIndex::Iterable::Iterator InMemoryLabelIndex::Iterable::begin() {
+  if (!scan_start_) return {this, index_accessor_.begin(), true};
+  return {this, index_accessor_.find_equal_or_greater(Entry{scan_start_, 0}), false};
+}
 
-InMemoryLabelIndex::Iterable::Iterator::Iterator(Iterable *self, utils::SkipList<Entry>::Iterator index_iterator)
+InMemoryLabelIndex::Iterable::Iterator::Iterator(Iterable *self, utils::SkipList<Entry>::Iterator index_iterator,
+                                                 bool wrapped)
     : self_(self),
       index_iterator_(index_iterator),
       current_vertex_accessor_(nullptr, self_->storage_, nullptr),
-      current_vertex_(nullptr) {
+      current_vertex_(nullptr),
+      wrapped_(wrapped) {
   AdvanceUntilValid();
 }
 
@@ -147,25 +165,51 @@ InMemoryLabelIndex::Iterable::Iterator &InMemoryLabelIndex::Iterable::Iterator::
 }
 
 void InMemoryLabelIndex::Iterable::Iterator::AdvanceUntilValid() {
-  for (; index_iterator_ != self_->index_accessor_.end(); ++index_iterator_) {
-    if (index_iterator_->vertex == current_vertex_) {
-      continue;
-    }
+  while (true) {
+    for (; index_iterator_ != self_->index_accessor_.end(); ++index_iterator_) {
+      if (self_->scan_start_ && wrapped_ && !std::less<Vertex *>{}(index_iterator_->vertex, self_->scan_start_)) {
+        // Back where the synchronized scan started, everything from here on was already visited
+        index_iterator_ = self_->index_accessor_.end();
+        return;
+      }
 
-    if (!CanSeeEntityWithTimestamp(index_iterator_->timestamp, self_->transaction_)) {
-      continue;
-    }
+      prefetcher_.Step(index_iterator_, self_->index_accessor_.end());
+
+      if (index_iterator_->vertex == current_vertex_) {
+        continue;
+      }
+
+      if (!CanSeeEntityWithTimestamp(index_iterator_->timestamp, self_->transaction_)) {
+        continue;
+      }
 
-    auto accessor = VertexAccessor{index_iterator_->vertex, self_->storage_, self_->transaction_};
-    auto res = accessor.HasLabel(self_->label_, self_->view_);
-    if (!res.HasError() and res.GetValue()) {
-      current_vertex_ = accessor.vertex_;
-      current_vertex_accessor_ = accessor;
-      break;
+      auto accessor = VertexAccessor{index_iterator_->vertex, self_->storage_, self_->transaction_};
+      auto res = accessor.HasLabel(self_->label_, self_->view_);
+      if (!res.HasError() and res.GetValue()) {
+        current_vertex_ = accessor.vertex_;
+        current_vertex_accessor_ = accessor;
+        ReportPosition();
+        return;
+      }
     }
+    if (wrapped_) return;
+    // A synchronized scan continues from the beginning of the index up to the position it started at
+    wrapped_ = true;
+    index_iterator_ = self_->index_accessor_.begin();
+    prefetcher_.Reset();
   }
 }
 
+void InMemoryLabelIndex::Iterable::Iterator::ReportPosition() {
+  // Reporting every vertex would make the scans contend on the lock, a scan
+  // that joins a bit behind the others catches up with them through the cache.
+  constexpr uint64_t kReportInterval = 1024;
+  if (!self_->scan_positions_ || ++since_last_report_ < kReportInterval) return;
+  since_last_report_ = 0;
+  self_->scan_positions_->WithLock(
+      [&](auto &positions) { positions.insert_or_assign(self_->label_, current_vertex_); });
+}
+
 uint64_t InMemoryLabelIndex::ApproximateVertexCount(LabelId label) const {
   auto it = index_.find(label);
   MG_ASSERT(it != index_.end(), "Index for label {} doesn't exist", label.AsUint());
@@ -186,7 +230,8 @@ InMemoryLabelIndex::Iterable InMemoryLabelIndex::Vertices(LabelId label, View vi
   auto vertices_acc = static_cast<InMemoryStorage const *>(storage)->vertices_.access();
   const auto it = index_.find(label);
   MG_ASSERT(it != index_.end(), "Index for label {} doesn't exist", label.AsUint());
-  return {it->second.access(), std::move(vertices_acc), label, view, storage, transaction};
+  auto *scan_positions = storage->config_.transaction.synchronized_scans ? &scan_positions_ : nullptr;
+  return {it->second.access(), std::move(vertices_acc), label, view, storage, transaction, scan_positions};
 }
 
 InMemoryLabelIndex::Iterable InMemoryLabelIndex::Vertices(
@@ -244,6 +289,7 @@ std::vector<LabelId> InMemoryLabelIndex::Analysis() const {
 void InMemoryLabelIndex::DropGraphClearIndices() {
   index_.clear();
   stats_->clear();
+  scan_positions_->clear();
 }
 
 }  // namespace memgraph::storage
@@ -11,14 +11,17 @@
 
 #pragma once
 
+#include <map>
 #include <span>
 
 #include "storage/v2/constraints/constraints.hpp"
 #include "storage/v2/durability/recovery_type.hpp"
+#include "storage/v2/indices/indices_utils.hpp"
 #include "storage/v2/indices/label_index.hpp"
 #include "storage/v2/indices/label_index_stats.hpp"
 #include "storage/v2/vertex.hpp"
 #include "utils/rw_lock.hpp"
+#include "utils/spin_lock.hpp"
 #include "utils/synchronized.hpp"
 
 namespace memgraph::storage {
@@ -35,6 +38,10 @@ class InMemoryLabelIndex : public storage::LabelIndex {
     bool operator==(const Entry &rhs) const { return vertex == rhs.vertex && timestamp == rhs.timestamp; }
   };
 
+  // The vertex each label was last scanned at. The pointers are only used as
+  // a position in the index and are never dereferenced.
+  using ScanPositions = utils::Synchronized<std::map<LabelId, Vertex *>, utils::SpinLock>;
+
  public:
   InMemoryLabelIndex() = default;
 
@@ -61,14 +68,24 @@ class InMemoryLabelIndex : public storage::LabelIndex {
 
   std::vector<LabelId> Analysis() const;
 
+  /// Iterates over the vertices with the given label.
+  ///
+  /// When `scan_positions` is given the scan is synchronized with the other
+  /// scans over the same label: it starts at the position the most recent scan
+  /// reported, runs to the end of the index and then wraps around to the
+  /// beginning to visit the entries it skipped. Concurrent scans over the same
+  /// label therefore walk the index together and share the cache instead of
+  /// each of them making a separate pass. The order of the vertices differs
+  /// between scans, the set of them doesn't.
   class Iterable {
    public:
     Iterable(utils::SkipList<Entry>::Accessor index_accessor, utils::SkipList<Vertex>::ConstAccessor vertices_accessor,
-             LabelId label, View view, Storage *storage, Transaction *transaction);
+             LabelId label, View view, Storage *storage, Transaction *transaction,
+             ScanPositions *scan_positions = nullptr);
 
     class Iterator {
      public:
-      Iterator(Iterable *self, utils::SkipList<Entry>::Iterator index_iterator);
+      Iterator(Iterable *self, utils::SkipList<Entry>::Iterator index_iterator, bool wrapped);
 
       VertexAccessor const &operator*() const { return current_vertex_accessor_; }
 
@@ -79,15 +96,20 @@ class InMemoryLabelIndex : public storage::LabelIndex {
 
      private:
       void AdvanceUntilValid();
+      void ReportPosition();
 
       Iterable *self_;
       utils::SkipList<Entry>::Iterator index_iterator_;
       VertexAccessor current_vertex_accessor_;
       Vertex *current_vertex_;
+      IndexedVertexPrefetcher<utils::SkipList<Entry>::Iterator> prefetcher_;
+      // Set once a synchronized scan went past the end of the index
+      bool wrapped_;
+      uint64_t since_last_report_{0};
     };
 
-    Iterator begin() { return {this, index_accessor_.begin()}; }
-    Iterator end() { return {this, index_accessor_.end()}; }
+    Iterator begin();
+    Iterator end() { return {this, index_accessor_.end(), true}; }
 
    private:
     utils::SkipList<Vertex>::ConstAccessor pin_accessor_;
@@ -96,6 +118,8 @@ class InMemoryLabelIndex : public storage::LabelIndex {
     View view_;
     Storage *storage_;
     Transaction *transaction_;
+    ScanPositions *scan_positions_;
+    Vertex *scan_start_{nullptr};
   };
 
   uint64_t ApproximateVertexCount(LabelId label) const override;
@@ -120,6 +144,7 @@ class InMemoryLabelIndex : public storage::LabelIndex {
  private:
   std::map<LabelId, utils::SkipList<Entry>> index_;
   utils::Synchronized<std::map<LabelId, storage::LabelIndexStats>, utils::ReadPrioritizedRWLock> stats_;
+  ScanPositions scan_positions_;
 };
 
 }  // namespace memgraph::storage
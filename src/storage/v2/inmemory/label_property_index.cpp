@@ -200,6 +200,8 @@ InMemoryLabelPropertyIndex::Iterable::Iterator &InMemoryLabelPropertyIndex::Iter
 
 void InMemoryLabelPropertyIndex::Iterable::Iterator::AdvanceUntilValid() {
   for (; index_iterator_ != self_->index_accessor_.end(); ++index_iterator_) {
+    prefetcher_.Step(index_iterator_, self_->index_accessor_.end());
+
     if (index_iterator_->vertex == current_vertex_) {
       continue;
     }
@@ -16,6 +16,7 @@
 #include "storage/v2/constraints/constraints.hpp"
 #include "storage/v2/durability/recovery_type.hpp"
 #include "storage/v2/id_types.hpp"
+#include "storage/v2/indices/indices_utils.hpp"
 #include "storage/v2/indices/label_property_index.hpp"
 #include "storage/v2/indices/label_property_index_stats.hpp"
 #include "storage/v2/property_value.hpp"
@@ -102,6 +103,7 @@ class InMemoryLabelPropertyIndex : public storage::LabelPropertyIndex {
       utils::SkipList<Entry>::Iterator index_iterator_;
       VertexAccessor current_vertex_accessor_;
       Vertex *current_vertex_;
+      IndexedVertexPrefetcher<utils::SkipList<Entry>::Iterator> prefetcher_;
     };
 
     Iterator begin();
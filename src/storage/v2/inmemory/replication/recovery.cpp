@@ -34,7 +34,7 @@ class InMemoryCurrentWalHandler {
 
   void AppendSize(size_t size);
 
-  void AppendFileData(utils::InputFile *file);
+  void AppendFileData(utils::InputFile *file, size_t size);
 
   void AppendBufferData(const uint8_t *buffer, size_t buffer_size);
 
@@ -60,9 +60,9 @@ void InMemoryCurrentWalHandler::AppendSize(const size_t size) {
   encoder.WriteUint(size);
 }
 
-void InMemoryCurrentWalHandler::AppendFileData(utils::InputFile *file) {
+void InMemoryCurrentWalHandler::AppendFileData(utils::InputFile *file, const size_t size) {
   replication::Encoder encoder(stream_.GetBuilder());
-  encoder.WriteFileData(file);
+  encoder.WriteFileData(file, size);
 }
 
 void InMemoryCurrentWalHandler::AppendBufferData(const uint8_t *buffer, const size_t buffer_size) {
@@ -94,13 +94,15 @@ replication::SnapshotRes TransferSnapshot(const utils::UUID &main_uuid, const ut
 }
 
 uint64_t ReplicateCurrentWal(const utils::UUID &main_uuid, const InMemoryStorage *storage, rpc::Client &client,
-                             durability::WalFile const &wal_file) {
+                             durability::WalFile &wal_file) {
   InMemoryCurrentWalHandler stream{main_uuid, storage, client};
   stream.AppendFilename(wal_file.Path().filename());
   utils::InputFile file;
   MG_ASSERT(file.Open(wal_file.Path()), "Failed to open current WAL file at {}!", wal_file.Path());
-  stream.AppendSize(file.GetSize());
-  stream.AppendFileData(&file);
+  // A preallocated WAL file is larger than the data written to it.
+  const auto size = wal_file.GetFlushedSize();
+  stream.AppendSize(size);
+  stream.AppendFileData(&file, size);
   auto response = stream.Finalize();
   return response.current_commit_timestamp;
 }
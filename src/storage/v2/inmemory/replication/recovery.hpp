@@ -26,7 +26,7 @@ replication::SnapshotRes TransferSnapshot(const utils::UUID &main_uuid, const ut
                                           const std::filesystem::path &path);
 
 uint64_t ReplicateCurrentWal(const utils::UUID &main_uuid, const InMemoryStorage *storage, rpc::Client &client,
-                             durability::WalFile const &wal_file);
+                             durability::WalFile &wal_file);
 
 auto GetRecoverySteps(uint64_t replica_commit, utils::FileRetainer::FileLocker *file_locker,
                       const InMemoryStorage *storage) -> std::vector<RecoveryStep>;
@@ -122,6 +122,8 @@ InMemoryStorage::InMemoryStorage(Config config, std::optional<free_mem_fn> free_
                 config.durability.storage_directory / durability::kWalDirectory},
       lock_file_path_(config.durability.storage_directory / durability::kLockFile),
       uuid_(utils::GenerateUUID()),
+      wal_segment_pool_(config.durability.storage_directory / durability::kWalRecycleDirectory,
+                        config.durability.wal_file_size_kibibytes * 1024, config.durability.wal_file_recycle_count),
       global_locker_(file_retainer_.AddLocker()) {
   MG_ASSERT(config.salient.storage_mode != StorageMode::ON_DISK_TRANSACTIONAL,
             "Invalid storage mode sent to InMemoryStorage constructor!");
@@ -149,6 +151,10 @@ InMemoryStorage::InMemoryStorage(Config config, std::optional<free_mem_fn> free_
               "storage directory, please stop it first before starting this "
               "process!",
               config_.durability.storage_directory);
+
+    // Recycled WAL files left by the previous run could have deltas newer than
+    // the recovered data.
+    wal_segment_pool_.Clear();
   }
   if (config_.durability.recover_on_startup) {
     auto info = recovery_.RecoverData(&uuid_, repl_storage_state_, &vertices_, &edges_, &edges_metadata_, &edge_count_,
@@ -213,6 +219,10 @@ InMemoryStorage::InMemoryStorage(Config config, std::optional<free_mem_fn> free_
     // TODO: move out of storage have one global gc_runner_
     gc_runner_.Run("Storage GC", config_.gc.interval, [this] { this->FreeMemory({}, true); });
   }
+  if (config_.durability.snapshot_wal_mode != Config::Durability::SnapshotWalMode::DISABLED &&
+      config_.durability.scrub_interval != std::chrono::milliseconds::zero()) {
+    scrub_runner_.Run("Durability scrub", config_.durability.scrub_interval, [this] { ScrubDurabilityFiles(); });
+  }
   if (timestamp_ == kTimestampInitialId) {
     commit_log_.emplace();
   } else {
@@ -222,6 +232,7 @@ InMemoryStorage::InMemoryStorage(Config config, std::optional<free_mem_fn> free_
 
 InMemoryStorage::~InMemoryStorage() {
   stop_source.request_stop();
+  scrub_runner_.Stop();
 
   if (config_.gc.type == Config::Gc::Type::PERIODIC) {
     gc_runner_.Stop();
@@ -247,7 +258,9 @@ InMemoryStorage::InMemoryAccessor::InMemoryAccessor(auto tag, InMemoryStorage *s
                                                     StorageMode storage_mode)
     : Accessor(tag, storage, isolation_level, storage_mode), config_(storage->config_.salient.items) {}
 InMemoryStorage::InMemoryAccessor::InMemoryAccessor(InMemoryAccessor &&other) noexcept
-    : Accessor(std::move(other)), config_(other.config_) {}
+    : Accessor(std::move(other)),
+      config_(other.config_),
+      replica_epoch_guard_(std::move(other.replica_epoch_guard_)) {}
 
 InMemoryStorage::InMemoryAccessor::~InMemoryAccessor() {
   if (is_transaction_active_) {
@@ -328,22 +341,35 @@ InMemoryStorage::InMemoryAccessor::DetachDelete(std::vector<VertexAccessor *> no
 
   auto &[deleted_vertices, deleted_edges] = *value;
 
-  // Need to inform the next CollectGarbage call that there are some
-  // non-transactional deletions that need to be collected
-
-  auto const inform_gc_vertex_deletion = utils::OnScopeExit{[this, &deleted_vertices = deleted_vertices]() {
-    if (!deleted_vertices.empty() && transaction_.storage_mode == StorageMode::IN_MEMORY_ANALYTICAL) {
-      auto *mem_storage = static_cast<InMemoryStorage *>(storage_);
-      mem_storage->gc_full_scan_vertices_delete_ = true;
+  // IN_MEMORY_ANALYTICAL deletions don't create deltas, so the GC can't discover them by unlinking delta chains.
+  // Hand the deleted objects over in bulk (one lock per call) so the next CollectGarbage run can remove exactly
+  // these objects instead of scanning the whole vertex/edge skip lists.
+  if (transaction_.storage_mode == StorageMode::IN_MEMORY_ANALYTICAL) {
+    auto *mem_storage = static_cast<InMemoryStorage *>(storage_);
+    // The edge indices have to be cleaned even without edge gids, their entries point to the deleted vertices. Set
+    // before the vertices are handed over, so GC can't free them without cleaning the edge indices first.
+    if (!deleted_edges.empty()) {
+      mem_storage->analytical_edges_deleted_.store(true, std::memory_order_release);
     }
-  }};
-
-  auto const inform_gc_edge_deletion = utils::OnScopeExit{[this, &deleted_edges = deleted_edges]() {
-    if (!deleted_edges.empty() && transaction_.storage_mode == StorageMode::IN_MEMORY_ANALYTICAL) {
-      auto *mem_storage = static_cast<InMemoryStorage *>(storage_);
-      mem_storage->gc_full_scan_edges_delete_ = true;
+    if (!deleted_vertices.empty()) {
+      mem_storage->analytical_deleted_vertices_.WithLock([&](auto &analytical_deleted_vertices) {
+        analytical_deleted_vertices.reserve(analytical_deleted_vertices.size() + deleted_vertices.size());
+        for (auto const &vertex : deleted_vertices) {
+          analytical_deleted_vertices.push_back(vertex.vertex_->gid);
+        }
+      });
     }
-  }};
+    // Without properties on edges there are no edge objects to remove, only the vertex adjacency entries which are
+    // already gone
+    if (!deleted_edges.empty() && mem_storage->config_.salient.items.properties_on_edges) {
+      mem_storage->analytical_deleted_edges_.WithLock([&](auto &analytical_deleted_edges) {
+        analytical_deleted_edges.reserve(analytical_deleted_edges.size() + deleted_edges.size());
+        for (auto const &edge : deleted_edges) {
+          analytical_deleted_edges.push_back(edge.edge_.ptr->gid);
+        }
+      });
+    }
+  }
 
   for (auto const &vertex : deleted_vertices) {
     transaction_.manyDeltasCache.Invalidate(vertex.vertex_);
@@ -900,11 +926,29 @@ utils::BasicResult<StorageManipulationError, void> InMemoryStorage::InMemoryAcce
 
   auto *mem_storage = static_cast<InMemoryStorage *>(storage_);
 
+  // AS OF transactions read a past version of the graph, writes based on it can't be committed.
+  if (transaction_.registered_start_timestamp && (!transaction_.deltas.empty() || !transaction_.md_deltas.empty())) {
+    Abort();
+    return StorageManipulationError{SerializationError{}};
+  }
+
   // TODO: duplicated transaction finalisation in md_deltas and deltas processing cases
   if (transaction_.deltas.empty() && transaction_.md_deltas.empty()) {
     // We don't have to update the commit timestamp here because no one reads
     // it.
-    mem_storage->commit_log_->MarkFinished(transaction_.start_timestamp);
+    // IN_MEMORY_ANALYTICAL transactions don't create deltas, but can still change text indices
+    TextIndex::PendingBatch text_index_batch;
+    if (!transaction_.text_index_changes_.empty()) {
+      text_index_batch =
+          mem_storage->indices_.text_index_.PrepareCommit(transaction_, mem_storage->name_id_mapper_.get());
+    }
+    mem_storage->FinishHistoricalRead(transaction_);
+    // Without deltas there is no commit timestamp, the start timestamp orders the batch among the others
+    mem_storage->indices_.text_index_.Commit(std::move(text_index_batch), transaction_.start_timestamp);
+    mem_storage->commit_log_->MarkFinished(transaction_.RegisteredStartTimestamp());
+    if (flags::AreExperimentsEnabled(flags::Experiments::TEXT_SEARCH)) {
+      mem_storage->indices_.text_index_.ApplyCommitted();
+    }
   } else {
     // This is usually done by the MVCC, but it does not handle the metadata deltas
     transaction_.EnsureCommitTimestampExists();
@@ -934,6 +978,14 @@ utils::BasicResult<StorageManipulationError, void> InMemoryStorage::InMemoryAcce
     // Save these so we can mark them used in the commit log.
     uint64_t start_timestamp = transaction_.start_timestamp;
 
+    // The documents are built while the changed vertices still hold the state of this transaction. Once the commit
+    // is published, other transactions can change them and GC can free the deleted ones.
+    TextIndex::PendingBatch text_index_batch;
+    if (flags::AreExperimentsEnabled(flags::Experiments::TEXT_SEARCH)) {
+      text_index_batch =
+          mem_storage->indices_.text_index_.PrepareCommit(transaction_, mem_storage->name_id_mapper_.get());
+    }
+
     {
       auto engine_guard = std::unique_lock{storage_->engine_lock_};
 
@@ -1038,12 +1090,26 @@ utils::BasicResult<StorageManipulationError, void> InMemoryStorage::InMemoryAcce
           // TODO: release lock, and update all deltas to have a local copy of the commit timestamp
           MG_ASSERT(transaction_.commit_timestamp != nullptr, "Invalid database state!");
           transaction_.commit_timestamp->store(*commit_timestamp_, std::memory_order_release);
+          // Recorded under the engine lock so the history stays ordered by commit timestamp
+          if (mem_storage->RetainsHistory()) {
+            auto const now = std::chrono::system_clock::now();
+            mem_storage->commit_history_.WithLock([&](auto &history) {
+              history.Record(now, *commit_timestamp_);
+              // Trimmed here as well, GC might not run at all
+              history.Trim(now - mem_storage->config_.gc.history_retention);
+            });
+          }
           // Replica can only update the last durable timestamp with
           // the commits received from main.
           // Update the last durable timestamp
           mem_storage->repl_storage_state_.last_durable_timestamp_.store(durability_commit_timestamp);
         }
 
+        // Queued under the engine lock so the text index applies the documents in commit order
+        if (flags::AreExperimentsEnabled(flags::Experiments::TEXT_SEARCH)) {
+          mem_storage->indices_.text_index_.Commit(std::move(text_index_batch), *commit_timestamp_);
+        }
+
         // Install the new point index, if needed
         mem_storage->indices_.point_index_.InstallNewPointIndex(transaction_.point_index_change_collector_,
                                                                 transaction_.point_index_ctx_);
@@ -1056,7 +1122,8 @@ utils::BasicResult<StorageManipulationError, void> InMemoryStorage::InMemoryAcce
         // check if we can fast discard deltas (ie. do not hand over to GC)
         bool no_older_transactions = mem_storage->commit_log_->OldestActive() == *commit_timestamp_;
         bool no_newer_transactions = mem_storage->transaction_id_ == transaction_.transaction_id + 1;
-        if (no_older_transactions && no_newer_transactions) [[unlikely]] {
+        // Retained history needs the deltas to stay linked
+        if (no_older_transactions && no_newer_transactions && !mem_storage->RetainsHistory()) [[unlikely]] {
           // STEP 0) Can only do fast discard if GC is not running
           //         We can't unlink our transcations deltas until all of the older deltas in GC have been unlinked
           //         must do a try here, to avoid deadlock between transactions `engine_lock_` and the GC `gc_lock_`
@@ -1076,7 +1143,7 @@ utils::BasicResult<StorageManipulationError, void> InMemoryStorage::InMemoryAcce
     }
 
     if (flags::AreExperimentsEnabled(flags::Experiments::TEXT_SEARCH)) {
-      mem_storage->indices_.text_index_.Commit();
+      mem_storage->indices_.text_index_.ApplyCommitted();
     }
   }
 
@@ -1181,7 +1248,7 @@ void InMemoryStorage::InMemoryAccessor::GCRapidDeltaCleanup(std::list<Gid> &curr
   unlink_remove_clear(transaction_.deltas);
 }
 
-void InMemoryStorage::InMemoryAccessor::FastDiscardOfDeltas(std::unique_lock<std::mutex> /*gc_guard*/) {
+void InMemoryStorage::InMemoryAccessor::FastDiscardOfDeltas(std::unique_lock<GcLock> /*gc_guard*/) {
   auto *mem_storage = static_cast<InMemoryStorage *>(storage_);
 
   // STEP 1 + STEP 2 - delta cleanup
@@ -1493,9 +1560,6 @@ void InMemoryStorage::InMemoryAccessor::Abort() {
       for (auto const &[property, prop_vertices] : property_cleanup) {
         storage_->indices_.AbortEntries(property, prop_vertices, transaction_.start_timestamp);
       }
-      if (flags::AreExperimentsEnabled(flags::Experiments::TEXT_SEARCH)) {
-        storage_->indices_.text_index_.Rollback();
-      }
       for (auto const &[edge_type, edge] : edge_type_cleanup) {
         storage_->indices_.AbortEntries(edge_type, edge, transaction_.start_timestamp);
       }
@@ -1526,7 +1590,9 @@ void InMemoryStorage::InMemoryAccessor::Abort() {
     }
   }
 
-  mem_storage->commit_log_->MarkFinished(transaction_.start_timestamp);
+  transaction_.text_index_changes_.clear();
+  mem_storage->FinishHistoricalRead(transaction_);
+  mem_storage->commit_log_->MarkFinished(transaction_.RegisteredStartTimestamp());
   is_transaction_active_ = false;
 }
 
@@ -1946,6 +2012,9 @@ void InMemoryStorage::CollectGarbage(std::unique_lock<utils::ResourceLock> main_
   // ones.
 
   uint64_t oldest_active_start_timestamp = commit_log_->OldestActive();
+  if (RetainsHistory()) {
+    oldest_active_start_timestamp = ClampToRetainedHistory(oldest_active_start_timestamp);
+  }
 
   {
     auto guard = std::unique_lock{engine_lock_};
@@ -1982,8 +2051,15 @@ void InMemoryStorage::CollectGarbage(std::unique_lock<utils::ResourceLock> main_
   deleted_vertices_.WithLock([&](auto &deleted_vertices) { current_deleted_vertices.swap(deleted_vertices); });
   deleted_edges_.WithLock([&](auto &deleted_edges) { current_deleted_edges.swap(deleted_edges); });
 
-  auto const need_full_scan_vertices = gc_full_scan_vertices_delete_.exchange(false);
-  auto const need_full_scan_edges = gc_full_scan_edges_delete_.exchange(false);
+  // Objects deleted by IN_MEMORY_ANALYTICAL transactions (they have no deltas to unlink)
+  std::vector<Gid> current_analytical_deleted_vertices{};
+  std::vector<Gid> current_analytical_deleted_edges{};
+
+  analytical_deleted_vertices_.WithLock(
+      [&](auto &analytical_deleted_vertices) { current_analytical_deleted_vertices.swap(analytical_deleted_vertices); });
+  analytical_deleted_edges_.WithLock(
+      [&](auto &analytical_deleted_edges) { current_analytical_deleted_edges.swap(analytical_deleted_edges); });
+  bool const analytical_edges_deleted = analytical_edges_deleted_.exchange(false, std::memory_order_acq_rel);
 
   // Short lock, to move to local variable. Hence allows other transactions to commit.
   auto linked_undo_buffers = std::list<GCDeltas>{};
@@ -2154,8 +2230,10 @@ void InMemoryStorage::CollectGarbage(std::unique_lock<utils::ResourceLock> main_
   // On object deletion, theses indexes MUST be cleaned for functional correctness, their entries with raw pointers to
   // the actual objects need removing before the object is removed itself. Also moving from IN_MEMORY_ANALYTICAL to
   // IN_MEMORY_TRANSACTIONAL any object could have been deleted so also index cleanup is required for correctness.
-  bool const index_cleanup_vertex_needed = need_full_scan_vertices || !current_deleted_vertices.empty();
-  bool const index_cleanup_edge_needed = need_full_scan_edges || !current_deleted_edges.empty();
+  bool const index_cleanup_vertex_needed =
+      !current_analytical_deleted_vertices.empty() || !current_deleted_vertices.empty();
+  bool const index_cleanup_edge_needed =
+      analytical_edges_deleted || !current_analytical_deleted_edges.empty() || !current_deleted_edges.empty();
 
   // Used to determine whether the Index GC should be run for performance reasons (removing redundant entries). It
   // should be run when hinted by FastDiscardOfDeltas or by the deltas we processed this GC run.
@@ -2232,30 +2310,28 @@ void InMemoryStorage::CollectGarbage(std::unique_lock<utils::ResourceLock> main_
     }
   }
 
-  // EXPENSIVE full scan, is only run if an IN_MEMORY_ANALYTICAL transaction involved any deletions
-  // TODO: implement a fast internal iteration inside the skip_list (to avoid unnecessary find_node calls),
-  //  accessor.remove_if([](auto const & item){ return item.delta == nullptr && item.deleted;});
-  //  alternatively, an auxiliary data structure within skip_list to track these, hence a full scan wouldn't be needed
-  //  we will wait for evidence that this is needed before doing so.
-  if (need_full_scan_vertices) {
+  // Objects deleted in IN_MEMORY_ANALYTICAL mode are tracked by gid, so only they are looked up and removed.
+  // The check is still needed because the object could have been removed in the meantime (e.g. by DropGraph).
+  if (!current_analytical_deleted_vertices.empty()) {
     auto vertex_acc = vertices_.access();
-    for (auto &vertex : vertex_acc) {
-      // a deleted vertex which as no deltas must have come from IN_MEMORY_ANALYTICAL deletion
-      if (vertex.delta == nullptr && vertex.deleted) {
-        vertex_acc.remove(vertex);
+    for (auto const gid : current_analytical_deleted_vertices) {
+      auto it = vertex_acc.find(gid);
+      // a deleted vertex which has no deltas must have come from IN_MEMORY_ANALYTICAL deletion
+      if (it != vertex_acc.end() && it->delta == nullptr && it->deleted) {
+        vertex_acc.remove(gid);
       }
     }
   }
 
-  // EXPENSIVE full scan, is only run if an IN_MEMORY_ANALYTICAL transaction involved any deletions
-  if (need_full_scan_edges) {
+  if (!current_analytical_deleted_edges.empty()) {
     auto edge_acc = edges_.access();
     auto edge_metadata_acc = edges_metadata_.access();
-    for (auto &edge : edge_acc) {
-      // a deleted edge which as no deltas must have come from IN_MEMORY_ANALYTICAL deletion
-      if (edge.delta == nullptr && edge.deleted) {
-        edge_acc.remove(edge);
-        edge_metadata_acc.remove(edge.gid);
+    for (auto const gid : current_analytical_deleted_edges) {
+      auto it = edge_acc.find(gid);
+      // a deleted edge which has no deltas must have come from IN_MEMORY_ANALYTICAL deletion
+      if (it != edge_acc.end() && it->delta == nullptr && it->deleted) {
+        edge_acc.remove(gid);
+        edge_metadata_acc.remove(gid);
       }
     }
   }
@@ -2332,7 +2408,7 @@ bool InMemoryStorage::InitializeWalFile(memgraph::replication::ReplicationEpoch
     return false;
   if (!wal_file_) {
     wal_file_.emplace(recovery_.wal_directory_, uuid_, epoch.id(), config_.salient.items, name_id_mapper_.get(),
-                      wal_seq_num_++, &file_retainer_);
+                      wal_seq_num_++, &file_retainer_, &wal_segment_pool_);
   }
   return true;
 }
@@ -2356,6 +2432,38 @@ void InMemoryStorage::FinalizeWalFile() {
   }
 }
 
+void InMemoryStorage::ScrubDurabilityFiles() {
+  auto file_locker = file_retainer_.AddLocker();
+  auto locker_acc = file_locker.Access();
+
+  std::string uuid;
+  uint64_t current_wal_seq_num = 0;
+  {
+    // Hold the storage lock so the current WAL file cannot be changed.
+    std::lock_guard transaction_guard{engine_lock_};
+    // The files are protected from being deleted while they are verified.
+    (void)locker_acc.AddPath(recovery_.wal_directory_);
+    (void)locker_acc.AddPath(recovery_.snapshot_directory_);
+    uuid = uuid_;
+    current_wal_seq_num = wal_file_ ? wal_file_->SequenceNumber() : wal_seq_num_;
+  }
+
+  uint64_t corrupt_files = 0;
+  for (const auto &snapshot : durability::GetSnapshotFiles(recovery_.snapshot_directory_, uuid)) {
+    if (durability::VerifySnapshotFile(snapshot.path)) continue;
+    spdlog::error("Snapshot file {} is corrupt!", snapshot.path);
+    ++corrupt_files;
+  }
+  if (auto wal_files = durability::GetWalFiles(recovery_.wal_directory_, uuid, current_wal_seq_num)) {
+    for (const auto &wal : *wal_files) {
+      if (durability::VerifyWalFile(wal.path)) continue;
+      spdlog::error("WAL file {} is corrupt!", wal.path);
+      ++corrupt_files;
+    }
+  }
+  if (corrupt_files == 0) spdlog::trace("All snapshot and WAL files are valid.");
+}
+
 bool InMemoryStorage::AppendToWal(const Transaction &transaction, uint64_t durability_commit_timestamp,
                                   DatabaseAccessProtector db_acc) {
   if (!InitializeWalFile(repl_storage_state_.epoch_)) {
@@ -2729,6 +2837,109 @@ std::unique_ptr<Storage::Accessor> InMemoryStorage::UniqueAccess(
       Storage::Accessor::unique_access, this, override_isolation_level.value_or(isolation_level_), storage_mode_});
 }
 
+std::unique_ptr<Storage::Accessor> InMemoryStorage::ReplicaReadAccess(
+    std::optional<IsolationLevel> override_isolation_level) {
+  if (!config_.transaction.replica_epoch_reads || storage_mode_ != StorageMode::IN_MEMORY_TRANSACTIONAL) {
+    return Access(override_isolation_level);
+  }
+  // Locked before the transaction starts, so every replicated transaction it can see is already fully applied
+  auto epoch_guard = std::shared_lock{replica_epoch_lock_};
+  auto acc = std::unique_ptr<InMemoryAccessor>(new InMemoryAccessor{
+      Storage::Accessor::shared_access, this, override_isolation_level.value_or(isolation_level_), storage_mode_});
+  acc->replica_epoch_guard_ = std::move(epoch_guard);
+  acc->GetTransaction()->stable_epoch = true;
+  return std::unique_ptr<Storage::Accessor>(std::move(acc));
+}
+
+std::unique_lock<utils::ResourceLock> InMemoryStorage::LockReplicaEpoch() {
+  if (!config_.transaction.replica_epoch_reads) return {replica_epoch_lock_, std::defer_lock};
+  return std::unique_lock{replica_epoch_lock_};
+}
+
+utils::BasicResult<HistoryNotRetainedError, std::unique_ptr<Storage::Accessor>> InMemoryStorage::AccessAsOf(
+    std::chrono::system_clock::time_point as_of) {
+  if (!RetainsHistory() || storage_mode_ != StorageMode::IN_MEMORY_TRANSACTIONAL) {
+    return HistoryNotRetainedError{};
+  }
+
+  // Register the reader under the same lock GC uses to move the horizon, so the versions it needs can't be unlinked
+  // in between.
+  auto as_of_timestamp = commit_history_.WithLock([&](auto &history) -> std::optional<uint64_t> {
+    // A transaction sees commits with a timestamp lower than its start timestamp, so the snapshot at `as_of` starts
+    // right after the last commit made before it.
+    auto after = std::upper_bound(history.commits.begin(), history.commits.end(), as_of,
+                                  [](auto const &time, auto const &commit) { return time < commit.first; });
+    uint64_t timestamp = 0;
+    if (after != history.commits.begin()) {
+      timestamp = std::prev(after)->second + 1;
+    } else if (after != history.commits.end()) {
+      timestamp = after->second;
+    } else {
+      // Nothing committed yet, the current state is the state at `as_of`
+      timestamp = history.horizon;
+    }
+    if (timestamp < history.horizon) return std::nullopt;
+    history.active_readers.insert(timestamp);
+    return timestamp;
+  });
+  if (!as_of_timestamp) {
+    return HistoryNotRetainedError{};
+  }
+
+  std::unique_ptr<InMemoryAccessor> acc;
+  try {
+    acc = std::unique_ptr<InMemoryAccessor>(new InMemoryAccessor{Storage::Accessor::shared_access, this,
+                                                                 IsolationLevel::SNAPSHOT_ISOLATION, storage_mode_});
+  } catch (...) {
+    // The reader isn't tied to a transaction yet, so nothing else would unregister it
+    commit_history_.WithLock(
+        [&](auto &history) { history.active_readers.erase(history.active_readers.find(*as_of_timestamp)); });
+    throw;
+  }
+  auto &transaction = *acc->GetTransaction();
+  transaction.registered_start_timestamp = std::exchange(transaction.start_timestamp, *as_of_timestamp);
+  return std::unique_ptr<Storage::Accessor>(std::move(acc));
+}
+
+uint64_t InMemoryStorage::ClampToRetainedHistory(uint64_t oldest_active_start_timestamp) {
+  auto const cutoff = std::chrono::system_clock::now() - config_.gc.history_retention;
+  return commit_history_.WithLock([&](auto &history) {
+    history.Trim(cutoff);
+    if (history.commits.empty()) {
+      history.horizon = std::max(history.horizon, oldest_active_start_timestamp);
+    }
+
+    auto oldest = std::min(oldest_active_start_timestamp, history.horizon);
+    if (!history.active_readers.empty()) {
+      oldest = std::min(oldest, *history.active_readers.begin());
+    }
+    return oldest;
+  });
+}
+
+void InMemoryStorage::CommitHistory::Record(std::chrono::system_clock::time_point time, uint64_t commit_timestamp) {
+  if (!commits.empty()) time = std::max(time, commits.back().first);
+  commits.emplace_back(time, commit_timestamp);
+}
+
+void InMemoryStorage::CommitHistory::Trim(std::chrono::system_clock::time_point cutoff) {
+  // Keep the last commit made before the cutoff, it defines the state at the start of the window
+  while (commits.size() > 1 && commits[1].first <= cutoff) {
+    commits.pop_front();
+  }
+  if (!commits.empty()) {
+    auto const &[time, commit_timestamp] = commits.front();
+    horizon = std::max(horizon, time <= cutoff ? commit_timestamp + 1 : commit_timestamp);
+  }
+}
+
+void InMemoryStorage::FinishHistoricalRead(const Transaction &transaction) {
+  if (!transaction.registered_start_timestamp) return;
+  commit_history_.WithLock([&](auto &history) {
+    history.active_readers.erase(history.active_readers.find(transaction.start_timestamp));
+  });
+}
+
 void InMemoryStorage::CreateSnapshotHandler(
     std::function<utils::BasicResult<InMemoryStorage::CreateSnapshotError>()> cb) {
   create_snapshot_handler = [cb]() {
@@ -2857,6 +3068,10 @@ void InMemoryStorage::InMemoryAccessor::DropGraph() {
   auto gc_guard = std::unique_lock{mem_storage->gc_lock_};
   mem_storage->garbage_undo_buffers_.WithLock([&](auto &garbage_undo_buffers) { garbage_undo_buffers.clear(); });
   mem_storage->committed_transactions_.WithLock([&](auto &committed_transactions) { committed_transactions.clear(); });
+  mem_storage->analytical_deleted_vertices_.WithLock([](auto &analytical_deleted) { analytical_deleted.clear(); });
+  mem_storage->analytical_deleted_edges_.WithLock([](auto &analytical_deleted) { analytical_deleted.clear(); });
+  mem_storage->analytical_edges_deleted_.store(false, std::memory_order_release);
+  mem_storage->commit_history_.WithLock([](auto &history) { history.commits.clear(); });
 
   // also, we're the only transaction running, so we can safely remove the data as well
   mem_storage->indices_.DropGraphClearIndices();
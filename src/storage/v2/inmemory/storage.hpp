@@ -11,9 +11,13 @@
 
 #pragma once
 
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
+#include <deque>
 #include <memory>
+#include <set>
+#include <shared_mutex>
 #include <utility>
 #include "storage/v2/indices/label_index_stats.hpp"
 #include "storage/v2/inmemory/edge_type_index.hpp"
@@ -33,6 +37,7 @@
 #include "storage/v2/replication/rpc.hpp"
 #include "storage/v2/replication/serialization.hpp"
 #include "storage/v2/transaction.hpp"
+#include "utils/lock_profile.hpp"
 #include "utils/memory.hpp"
 #include "utils/resource_lock.hpp"
 #include "utils/synchronized.hpp"
@@ -99,6 +104,7 @@ class InMemoryStorage final : public Storage {
 
  public:
   using free_mem_fn = std::function<void(std::unique_lock<utils::ResourceLock>, bool)>;
+  using GcLock = utils::ProfiledLock<std::mutex, utils::LockKind::GC>;
   enum class CreateSnapshotError : uint8_t { DisabledForReplica, ReachedMaxNumTries };
 
   /// @throw std::system_error
@@ -448,10 +454,12 @@ class InMemoryStorage final : public Storage {
 
     /// Duiring commit, in some cases you do not need to hand over deltas to GC
     /// in those cases this method is a light weight way to unlink and discard our deltas
-    void FastDiscardOfDeltas(std::unique_lock<std::mutex> gc_guard);
+    void FastDiscardOfDeltas(std::unique_lock<GcLock> gc_guard);
     void GCRapidDeltaCleanup(std::list<Gid> &current_deleted_edges, std::list<Gid> &current_deleted_vertices,
                              IndexPerformanceTracker &impact_tracker);
     SalientConfig::Items config_;
+    // Held by stable epoch reads, see `ReplicaReadAccess`
+    std::shared_lock<utils::ResourceLock> replica_epoch_guard_;
   };
 
   class ReplicationAccessor final : public InMemoryAccessor {
@@ -476,6 +484,24 @@ class InMemoryStorage final : public Storage {
   using Storage::UniqueAccess;
   std::unique_ptr<Accessor> UniqueAccess(std::optional<IsolationLevel> override_isolation_level) override;
 
+  /// Starts a read-only SNAPSHOT_ISOLATION transaction that observes the graph as it was at `as_of`. Fails if history
+  /// retention is disabled or `as_of` is older than the retained history. Committing writes made through the returned
+  /// accessor fails with a SerializationError.
+  utils::BasicResult<HistoryNotRetainedError, std::unique_ptr<Accessor>> AccessAsOf(
+      std::chrono::system_clock::time_point as_of) override;
+
+  /// Starts a transaction of a read-only query on a replica. With
+  /// `replica_epoch_reads` enabled the transaction reads the stable epoch left by
+  /// the last applied batch of replicated transactions: batches aren't applied
+  /// while it runs, so it reads objects without locking them or traversing their
+  /// delta chains. Batches wait for as long as the accessor lives, so it is only
+  /// meant for implicit (autocommit) queries.
+  std::unique_ptr<Accessor> ReplicaReadAccess(std::optional<IsolationLevel> override_isolation_level) override;
+
+  /// Blocks stable epoch reads while a batch of replicated transactions is
+  /// applied. Doesn't lock anything if `replica_epoch_reads` is disabled.
+  std::unique_lock<utils::ResourceLock> LockReplicaEpoch();
+
   void FreeMemory(std::unique_lock<utils::ResourceLock> main_guard, bool periodic) override;
 
   utils::FileRetainer::FileLockerAccessor::ret_type IsPathLocked();
@@ -511,6 +537,10 @@ class InMemoryStorage final : public Storage {
   bool InitializeWalFile(memgraph::replication::ReplicationEpoch &epoch);
   void FinalizeWalFile();
 
+  /// Verifies the checksums of all finalized snapshot and WAL files and logs
+  /// the corrupt ones.
+  void ScrubDurabilityFiles();
+
   StorageInfo GetBaseInfo() override;
   StorageInfo GetInfo() override;
 
@@ -563,11 +593,16 @@ class InMemoryStorage final : public Storage {
   utils::Scheduler snapshot_runner_;
   utils::SpinLock snapshot_lock_;
 
+  utils::Scheduler scrub_runner_;
+
   // UUID used to distinguish snapshots and to link snapshots to WALs
   std::string uuid_;
   // Sequence number used to keep track of the chain of WALs.
   uint64_t wal_seq_num_{0};
 
+  // Finished WAL files kept for reuse, must outlive `wal_file_`.
+  durability::WalSegmentPool wal_segment_pool_;
+
   std::optional<durability::WalFile> wal_file_;
   uint64_t wal_unsynced_transactions_{0};
 
@@ -583,7 +618,7 @@ class InMemoryStorage final : public Storage {
   std::optional<CommitLog> commit_log_;
 
   utils::Scheduler gc_runner_;
-  std::mutex gc_lock_;
+  GcLock gc_lock_;
 
   struct GCDeltas {
     GCDeltas(uint64_t mark_timestamp, delta_container deltas, std::unique_ptr<std::atomic<uint64_t>> commit_timestamp)
@@ -614,9 +649,41 @@ class InMemoryStorage final : public Storage {
   std::atomic<bool> gc_index_cleanup_vertex_performance_ = false;
   std::atomic<bool> gc_index_cleanup_edge_performance_ = false;
 
-  // Flags to inform CollectGarbage that it needs to do the more expensive full scans
-  std::atomic<bool> gc_full_scan_vertices_delete_ = false;
-  std::atomic<bool> gc_full_scan_edges_delete_ = false;
+  // Objects deleted by IN_MEMORY_ANALYTICAL transactions. They don't have deltas, so CollectGarbage removes them
+  // directly by gid instead of scanning the whole vertices_/edges_ skip lists.
+  utils::Synchronized<std::vector<Gid>, utils::SpinLock> analytical_deleted_vertices_;
+  utils::Synchronized<std::vector<Gid>, utils::SpinLock> analytical_deleted_edges_;
+  // Set for every analytical edge deletion. Without properties on edges there are no gids to collect above, but the
+  // edge indices still point to the deleted edges and their vertices.
+  std::atomic<bool> analytical_edges_deleted_ = false;
+
+  bool RetainsHistory() const { return config_.gc.history_retention.count() > 0; }
+
+  /// Lowers `oldest_active_start_timestamp` so GC keeps the versions inside the retention window and the ones
+  /// observed by active AS OF readers.
+  uint64_t ClampToRetainedHistory(uint64_t oldest_active_start_timestamp);
+
+  void FinishHistoricalRead(const Transaction &transaction);
+
+  // Commit timestamps of the transactions committed inside the history retention window, ordered by commit time.
+  // `horizon` is the oldest start timestamp an AS OF reader may still use.
+  struct CommitHistory {
+    std::deque<std::pair<std::chrono::system_clock::time_point, uint64_t>> commits;
+    std::multiset<uint64_t> active_readers;
+    uint64_t horizon{0};
+
+    /// Records a commit. The times are clamped to the last recorded one, so the commits stay sorted by time even if
+    /// the system clock goes back.
+    void Record(std::chrono::system_clock::time_point time, uint64_t commit_timestamp);
+
+    /// Drops the commits made before `cutoff`, except the last one, which defines the state at the start of the
+    /// retention window, and moves the horizon accordingly.
+    void Trim(std::chrono::system_clock::time_point cutoff);
+  };
+  utils::Synchronized<CommitHistory, utils::SpinLock> commit_history_;
+
+  // Shared by stable epoch reads, exclusively locked while replicated transactions are applied
+  utils::ResourceLock replica_epoch_lock_;
 
   free_mem_fn free_memory_func_;
 
@@ -14,12 +14,14 @@
 #include <atomic>
 #include <cstdint>
 #include <optional>
+#include <shared_mutex>
 
 #include "storage/v2/property_value.hpp"
 #include "storage/v2/transaction.hpp"
 #include "storage/v2/view.hpp"
 #include "utils/event_counter.hpp"
 #include "utils/rocksdb_serialization.hpp"
+#include "utils/rw_spin_lock.hpp"
 #include "utils/string.hpp"
 
 namespace memgraph::metrics {
@@ -39,8 +41,11 @@ template <typename TCallback>
 inline std::size_t ApplyDeltasForRead(Transaction const *transaction, const Delta *delta, View view,
                                       const TCallback &callback) {
   // Avoid work if no deltas or
-  // IsolationLevel::READ_UNCOMMITTED, where deltas are never applied
-  if (!delta || transaction->isolation_level == IsolationLevel::READ_UNCOMMITTED) return 0;
+  // IsolationLevel::READ_UNCOMMITTED, where deltas are never applied, or
+  // stable epoch reads, where all of the deltas are already visible
+  if (!delta || transaction->isolation_level == IsolationLevel::READ_UNCOMMITTED || transaction->stable_epoch) {
+    return 0;
+  }
 
   // if the transaction is not committed, then its deltas have transaction_id for the timestamp, otherwise they have
   // its commit timestamp set.
@@ -92,6 +97,21 @@ inline std::size_t ApplyDeltasForRead(Transaction const *transaction, const Delt
   return n_processed;
 }
 
+/// Locks the object for reading its current version. Stable epoch reads don't
+/// lock, the objects aren't modified while they run.
+template <typename TObj>
+inline std::shared_lock<utils::RWSpinLock> LockForRead(const TObj &object, Transaction const *transaction) {
+  if (transaction->stable_epoch) return {object.lock, std::defer_lock};
+  return std::shared_lock{object.lock};
+}
+
+/// Returns the head of the object's delta chain which has to be applied to
+/// its current version, stable epoch reads never apply any.
+template <typename TObj>
+inline Delta *DeltaForRead(const TObj &object, Transaction const *transaction) {
+  return transaction->stable_epoch ? nullptr : object.delta;
+}
+
 /// This function prepares the object for a write. It checks whether there are
 /// any serialization errors in the process (eg. the object can't be written to
 /// from this transaction because it is being written to from another
@@ -11,9 +11,16 @@
 
 #pragma once
 
+#include <array>
 #include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
 #include <string>
 #include <string_view>
+#include <utility>
+#include <vector>
 
 #include "utils/logging.hpp"
 #include "utils/skip_list.hpp"
@@ -44,6 +51,171 @@ class NameIdMapper {
     bool operator==(uint64_t other) const { return id == other; }
   };
 
+  /// Dense, append-only id -> name lookup table used to answer IdToName without
+  /// searching the skip list. IDs are handed out sequentially by `counter_`, so
+  /// they are stored in fixed-size chunks that are allocated on first use and
+  /// never moved or freed while the mapper is alive. Readers are lock-free; an
+  /// empty slot means the mapping wasn't published yet and the caller has to
+  /// fall back to `id_to_name_`.
+  class DenseIdToName {
+    static constexpr uint64_t kChunkSizeBits = 12;
+    static constexpr uint64_t kChunkSize = 1UL << kChunkSizeBits;
+    static constexpr uint64_t kMaxChunks = 1024;
+
+    using Chunk = std::array<std::atomic<const std::string *>, kChunkSize>;
+
+   public:
+    DenseIdToName() = default;
+    DenseIdToName(const DenseIdToName &) = delete;
+    DenseIdToName &operator=(const DenseIdToName &) = delete;
+    DenseIdToName(DenseIdToName &&) = delete;
+    DenseIdToName &operator=(DenseIdToName &&) = delete;
+
+    ~DenseIdToName() {
+      for (auto &chunk : chunks_) {
+        delete chunk.load(std::memory_order_acquire);
+      }
+    }
+
+    const std::string *Find(uint64_t id) const {
+      auto const chunk_idx = id >> kChunkSizeBits;
+      if (chunk_idx >= kMaxChunks) return nullptr;
+      auto const *chunk = chunks_[chunk_idx].load(std::memory_order_acquire);
+      if (chunk == nullptr) return nullptr;
+      return (*chunk)[id & (kChunkSize - 1)].load(std::memory_order_acquire);
+    }
+
+    /// `name` has to outlive the table (names are never removed from the
+    /// skip lists, so pointers to their strings are stable).
+    void Publish(uint64_t id, const std::string *name) {
+      auto const chunk_idx = id >> kChunkSizeBits;
+      // IDs outside of the dense range are served by the skip list only
+      if (chunk_idx >= kMaxChunks) return;
+      auto *chunk = chunks_[chunk_idx].load(std::memory_order_acquire);
+      if (chunk == nullptr) {
+        auto new_chunk = std::make_unique<Chunk>();
+        for (auto &slot : *new_chunk) {
+          slot.store(nullptr, std::memory_order_relaxed);
+        }
+        if (chunks_[chunk_idx].compare_exchange_strong(chunk, new_chunk.get(), std::memory_order_acq_rel)) {
+          chunk = new_chunk.release();
+        }
+        // otherwise another thread installed the chunk first and `chunk` now points to it
+      }
+      (*chunk)[id & (kChunkSize - 1)].store(name, std::memory_order_release);
+    }
+
+   private:
+    std::array<std::atomic<Chunk *>, kMaxChunks> chunks_{};
+  };
+
+  /// Insert-only name -> id hash table in front of `name_to_id_`, so NameToId
+  /// hashes the name once instead of comparing strings on every level of the
+  /// skip list. Buckets are chains of immutable nodes pointing to the names
+  /// owned by the skip list. A name that isn't found has to be looked up in
+  /// `name_to_id_`, which stays the one that assigns the IDs.
+  ///
+  /// Readers are lock-free. Writers are serialized, which is fine since every
+  /// name is published only once. Once there are more names than buckets, a
+  /// table with twice as many buckets is built from copies of the nodes and
+  /// published. Readers can still be walking the older tables, so they are
+  /// kept until the mapper is destroyed; together they are at most as big as
+  /// the current one.
+  class HashedNameToId {
+    static constexpr uint64_t kInitialBucketsBits = 10;
+
+    struct Node {
+      size_t hash;
+      std::string_view name;
+      uint64_t id;
+      Node *next;
+    };
+
+    struct Table {
+      explicit Table(uint64_t size) : buckets(size) {}
+      Table(const Table &) = delete;
+      Table &operator=(const Table &) = delete;
+      Table(Table &&) = delete;
+      Table &operator=(Table &&) = delete;
+
+      ~Table() {
+        for (auto &bucket : buckets) {
+          auto *node = bucket.load(std::memory_order_acquire);
+          while (node != nullptr) {
+            delete std::exchange(node, node->next);
+          }
+        }
+      }
+
+      std::atomic<Node *> &Bucket(size_t hash) { return buckets[hash & (buckets.size() - 1)]; }
+      const std::atomic<Node *> &Bucket(size_t hash) const { return buckets[hash & (buckets.size() - 1)]; }
+
+      // Prepends a copy of the mapping to its bucket
+      void Insert(size_t hash, const std::string_view name, uint64_t id) {
+        auto &bucket = Bucket(hash);
+        bucket.store(new Node{.hash = hash, .name = name, .id = id, .next = bucket.load(std::memory_order_relaxed)},
+                     std::memory_order_release);
+      }
+
+      std::vector<std::atomic<Node *>> buckets;
+    };
+
+   public:
+    HashedNameToId() {
+      tables_.push_back(std::make_unique<Table>(1UL << kInitialBucketsBits));
+      current_.store(tables_.back().get(), std::memory_order_release);
+    }
+    HashedNameToId(const HashedNameToId &) = delete;
+    HashedNameToId &operator=(const HashedNameToId &) = delete;
+    HashedNameToId(HashedNameToId &&) = delete;
+    HashedNameToId &operator=(HashedNameToId &&) = delete;
+    ~HashedNameToId() = default;
+
+    std::optional<uint64_t> Find(const std::string_view name) const {
+      auto const hash = Hash(name);
+      auto const *table = current_.load(std::memory_order_acquire);
+      for (auto const *node = table->Bucket(hash).load(std::memory_order_acquire); node != nullptr;
+           node = node->next) {
+        if (node->hash == hash && node->name == name) return node->id;
+      }
+      return std::nullopt;
+    }
+
+    /// `name` has to outlive the table, same as in `DenseIdToName::Publish`.
+    void Publish(const std::string_view name, uint64_t id) {
+      auto const hash = Hash(name);
+      auto guard = std::lock_guard{publish_lock_};
+      auto *table = current_.load(std::memory_order_relaxed);
+      for (auto const *it = table->Bucket(hash).load(std::memory_order_relaxed); it != nullptr; it = it->next) {
+        // Another thread published the same name first
+        if (it->hash == hash && it->name == name) return;
+      }
+      table->Insert(hash, name, id);
+      if (++size_ > table->buckets.size()) Grow(*table);
+    }
+
+    uint64_t BucketCount() const { return current_.load(std::memory_order_acquire)->buckets.size(); }
+
+   private:
+    static size_t Hash(const std::string_view name) { return std::hash<std::string_view>{}(name); }
+
+    void Grow(const Table &table) {
+      auto grown = std::make_unique<Table>(table.buckets.size() * 2);
+      for (auto const &bucket : table.buckets) {
+        for (auto const *node = bucket.load(std::memory_order_relaxed); node != nullptr; node = node->next) {
+          grown->Insert(node->hash, node->name, node->id);
+        }
+      }
+      current_.store(grown.get(), std::memory_order_release);
+      tables_.push_back(std::move(grown));
+    }
+
+    std::mutex publish_lock_;
+    uint64_t size_{0};
+    std::vector<std::unique_ptr<Table>> tables_;
+    std::atomic<Table *> current_{nullptr};
+  };
+
  public:
   explicit NameIdMapper() = default;
 
@@ -56,8 +228,11 @@ class NameIdMapper {
 
   /// @throw std::bad_alloc if unable to insert a new mapping
   virtual uint64_t NameToId(const std::string_view name) {
+    // Fast path, both mappings were already fully published
+    if (auto id = hashed_name_to_id_.Find(name); id.has_value()) return *id;
     auto name_to_id_acc = name_to_id_.access();
     auto found = name_to_id_acc.find(name);
+    const std::string *stored_name = nullptr;
     uint64_t id;
     if (found == name_to_id_acc.end()) {
       uint64_t new_id = counter_.fetch_add(1, std::memory_order_acq_rel);
@@ -67,19 +242,19 @@ class NameIdMapper {
       // return an iterator to the existing item. This prevents assignment of
       // two IDs to the same name when the mapping is being inserted
       // concurrently from two threads. One ID is wasted in that case, though.
-      id = name_to_id_acc.insert({std::string(name), new_id}).first->id;
+      auto inserted = name_to_id_acc.insert({std::string(name), new_id}).first;
+      id = inserted->id;
+      stored_name = &inserted->name;
     } else {
       id = found->id;
+      stored_name = &found->name;
     }
-    auto id_to_name_acc = id_to_name_.access();
     // We have to try to insert the ID to name mapping even if we are not the
     // one who assigned the ID because we have to make sure that after this
     // method returns that both mappings exist.
-    if (id_to_name_acc.find(id) == id_to_name_acc.end()) {
-      // We first try to find the `id` in the map to avoid making an unnecessary
-      // temporary memory allocation when the object already exists.
-      id_to_name_acc.insert({id, std::string(name)});
-    }
+    if (dense_id_to_name_.Find(id) == nullptr) InsertIdToName(id, name);
+    // Published last, so a hit in the hash table means that both mappings exist
+    hashed_name_to_id_.Publish(*stored_name, id);
     return id;
   }
 
@@ -87,6 +262,7 @@ class NameIdMapper {
   /// but just returns either std::nullopt or the value of the property id if it
   /// finds it.
   virtual std::optional<uint64_t> NameToIdIfExists(const std::string_view name) const {
+    if (auto id = hashed_name_to_id_.Find(name); id.has_value()) return id;
     auto name_to_id_acc = name_to_id_.access();
     auto found = name_to_id_acc.find(name);
     if (found == name_to_id_acc.end()) {
@@ -112,6 +288,9 @@ class NameIdMapper {
 
  protected:
   std::optional<std::reference_wrapper<const std::string>> MaybeIdToName(uint64_t id) const {
+    if (const auto *name = dense_id_to_name_.Find(id); name != nullptr) {
+      return *name;
+    }
     auto id_to_name_acc = id_to_name_.access();
     auto result = id_to_name_acc.find(id);
     if (result == id_to_name_acc.end()) {
@@ -120,8 +299,24 @@ class NameIdMapper {
     return result->name;
   }
 
+  /// Inserts the id -> name mapping (if it doesn't exist yet) and publishes it
+  /// to the dense lookup table. Returns the stored name.
+  const std::string &InsertIdToName(uint64_t id, const std::string_view name) {
+    auto id_to_name_acc = id_to_name_.access();
+    auto it = id_to_name_acc.find(id);
+    if (it == id_to_name_acc.end()) {
+      // We first try to find the `id` in the map to avoid making an unnecessary
+      // temporary memory allocation when the object already exists.
+      it = id_to_name_acc.insert({id, std::string(name)}).first;
+    }
+    dense_id_to_name_.Publish(id, &it->name);
+    return it->name;
+  }
+
   std::atomic<uint64_t> counter_{0};
   utils::SkipList<MapNameToId> name_to_id_;
   utils::SkipList<MapIdToName> id_to_name_;
+  DenseIdToName dense_id_to_name_;
+  HashedNameToId hashed_name_to_id_;
 };
 }  // namespace memgraph::storage
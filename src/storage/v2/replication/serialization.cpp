@@ -57,8 +57,9 @@ void Encoder::WritePropertyValue(const PropertyValue &value) {
 
 void Encoder::WriteBuffer(const uint8_t *buffer, const size_t buffer_size) { builder_->Save(buffer, buffer_size); }
 
-void Encoder::WriteFileData(utils::InputFile *file) {
-  auto file_size = file->GetSize();
+void Encoder::WriteFileData(utils::InputFile *file) { WriteFileData(file, file->GetSize()); }
+
+void Encoder::WriteFileData(utils::InputFile *file, size_t file_size) {
   uint8_t buffer[utils::kFileBufferSize];
   while (file_size > 0) {
     const auto chunk_size = std::min(file_size, utils::kFileBufferSize);
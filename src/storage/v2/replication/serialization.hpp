@@ -46,6 +46,7 @@ class Encoder final : public durability::BaseEncoder {
   void WriteBuffer(const uint8_t *buffer, size_t buffer_size);
 
   void WriteFileData(utils::InputFile *file);
+  void WriteFileData(utils::InputFile *file, size_t size);
 
   void WriteFile(const std::filesystem::path &path);
 
@@ -48,6 +48,7 @@
 #include "utils/event_counter.hpp"
 #include "utils/event_gauge.hpp"
 #include "utils/event_histogram.hpp"
+#include "utils/lock_profile.hpp"
 #include "utils/resource_lock.hpp"
 #include "utils/scheduler.hpp"
 #include "utils/synchronized_metadata_store.hpp"
@@ -288,11 +289,11 @@ class Storage {
     }
 
     void TextIndexAddVertex(const VertexAccessor &vertex) {
-      storage_->indices_.text_index_.AddNode(vertex.vertex_, storage_->name_id_mapper_.get());
+      storage_->indices_.text_index_.AddNode(vertex.vertex_, transaction_);
     }
 
     void TextIndexUpdateVertex(const VertexAccessor &vertex, const std::vector<LabelId> &removed_labels = {}) {
-      storage_->indices_.text_index_.UpdateNode(vertex.vertex_, storage_->name_id_mapper_.get(), removed_labels);
+      storage_->indices_.text_index_.UpdateNode(vertex.vertex_, transaction_, removed_labels);
     }
 
     std::vector<Gid> TextIndexSearch(const std::string &index_name, const std::string &search_query,
@@ -514,6 +515,18 @@ class Storage {
   virtual std::unique_ptr<Accessor> UniqueAccess(std::optional<IsolationLevel> override_isolation_level) = 0;
   std::unique_ptr<Accessor> UniqueAccess() { return UniqueAccess({}); }
 
+  /// Starts a transaction of a read-only query on a replica.
+  virtual std::unique_ptr<Accessor> ReplicaReadAccess(std::optional<IsolationLevel> override_isolation_level) {
+    return Access(override_isolation_level);
+  }
+
+  /// Starts a read-only transaction that observes the graph as it was at `as_of`. Only supported by storages which
+  /// retain history.
+  virtual utils::BasicResult<HistoryNotRetainedError, std::unique_ptr<Accessor>> AccessAsOf(
+      std::chrono::system_clock::time_point /*as_of*/) {
+    return HistoryNotRetainedError{};
+  }
+
   enum class SetIsolationLevelError : uint8_t { DisabledForAnalyticalMode };
 
   utils::BasicResult<SetIsolationLevelError> SetIsolationLevel(IsolationLevel isolation_level);
@@ -554,7 +567,7 @@ class Storage {
   Config config_;
 
   // Transaction engine
-  mutable utils::SpinLock engine_lock_;
+  mutable utils::ProfiledLock<utils::SpinLock, utils::LockKind::ENGINE> engine_lock_;
   uint64_t timestamp_{kTimestampInitialId};
   uint64_t transaction_id_{kTransactionInitialId};
 
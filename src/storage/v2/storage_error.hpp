@@ -36,6 +36,8 @@ using StorageIndexDefinitionError = IndexDefinitionError;
 
 struct ConstraintDefinitionError {};
 
+struct HistoryNotRetainedError {};
+
 using StorageExistenceConstraintDefinitionError = std::variant<ConstraintViolation, ConstraintDefinitionError>;
 
 using StorageExistenceConstraintDroppingError = ConstraintDefinitionError;
@@ -14,6 +14,8 @@
 #include <atomic>
 #include <limits>
 #include <memory>
+#include <unordered_map>
+#include <vector>
 
 #include "storage/v2/id_types.hpp"
 #include "utils/memory.hpp"
@@ -75,6 +77,10 @@ struct Transaction {
 
   bool IsDiskStorage() const { return storage_mode == StorageMode::ON_DISK_TRANSACTIONAL; }
 
+  /// Timestamp under which the transaction is tracked in the commit log. It differs from `start_timestamp` only for
+  /// AS OF reads, whose `start_timestamp` is rewound to the point in history they observe.
+  uint64_t RegisteredStartTimestamp() const { return registered_start_timestamp.value_or(start_timestamp); }
+
   /// @throw std::bad_alloc if failed to create the `commit_timestamp`
   void EnsureCommitTimestampExists() {
     if (commit_timestamp != nullptr) return;
@@ -101,6 +107,7 @@ struct Transaction {
   uint64_t transaction_id{};
   uint64_t start_timestamp{};
   std::optional<uint64_t> original_start_timestamp{};
+  std::optional<uint64_t> registered_start_timestamp{};
   // The `Transaction` object is stack allocated, but the `commit_timestamp`
   // must be heap allocated because `Delta`s have a pointer to it, and that
   // pointer must stay valid after the `Transaction` is moved into
@@ -114,6 +121,10 @@ struct Transaction {
   IsolationLevel isolation_level{};
   StorageMode storage_mode{};
   bool edge_import_mode_active{false};
+  // Read-only replica transaction which runs between batches of replicated transactions. Nothing modifies the
+  // objects while it runs and every delta was committed before it started, so the objects are read in their current
+  // version, without locking them or traversing their delta chains.
+  bool stable_epoch{false};
 
   // A cache which is consistent to the current transaction_id + command_id.
   // Used to speedup getting info about a vertex when there is a long delta
@@ -124,6 +135,9 @@ struct Transaction {
   // Store modified edges GID mapped to changed Delta and serialized edge key
   // Only for disk storage
   ModifiedEdgesMap modified_edges_{};
+  // Vertices whose text index documents have to be rebuilt once the transaction commits, with the labels that were
+  // removed from them in the meantime
+  std::unordered_map<Vertex *, std::vector<LabelId>> text_index_changes_{};
   rocksdb::Transaction *disk_transaction_{};
   /// Main storage
   std::optional<utils::SkipList<Vertex>> vertices_{};
@@ -59,9 +59,9 @@ std::pair<bool, bool> IsVisible(Vertex const *vertex, Transaction const *transac
   bool deleted = false;
   Delta *delta = nullptr;
   {
-    auto guard = std::shared_lock{vertex->lock};
+    auto guard = LockForRead(*vertex, transaction);
     deleted = vertex->deleted;
-    delta = vertex->delta;
+    delta = DeltaForRead(*vertex, transaction);
   }
 
   // Checking cache has a cost, only do it if we have any deltas
@@ -262,10 +262,10 @@ Result<bool> VertexAccessor::HasLabel(LabelId label, View view) const {
   bool has_label = false;
   Delta *delta = nullptr;
   {
-    auto guard = std::shared_lock{vertex_->lock};
+    auto guard = LockForRead(*vertex_, transaction_);
     deleted = vertex_->deleted;
     has_label = std::find(vertex_->labels.begin(), vertex_->labels.end(), label) != vertex_->labels.end();
-    delta = vertex_->delta;
+    delta = DeltaForRead(*vertex_, transaction_);
   }
 
   // Checking cache has a cost, only do it if we have any deltas
@@ -309,10 +309,10 @@ Result<utils::small_vector<LabelId>> VertexAccessor::Labels(View view) const {
   utils::small_vector<LabelId> labels;
   Delta *delta = nullptr;
   {
-    auto guard = std::shared_lock{vertex_->lock};
+    auto guard = LockForRead(*vertex_, transaction_);
     deleted = vertex_->deleted;
     labels = vertex_->labels;
-    delta = vertex_->delta;
+    delta = DeltaForRead(*vertex_, transaction_);
   }
 
   // Checking cache has a cost, only do it if we have any deltas
@@ -553,10 +553,10 @@ Result<PropertyValue> VertexAccessor::GetProperty(PropertyId property, View view
   PropertyValue value;
   Delta *delta = nullptr;
   {
-    auto guard = std::shared_lock{vertex_->lock};
+    auto guard = LockForRead(*vertex_, transaction_);
     deleted = vertex_->deleted;
     value = vertex_->properties.GetProperty(property);
-    delta = vertex_->delta;
+    delta = DeltaForRead(*vertex_, transaction_);
   }
 
   // Checking cache has a cost, only do it if we have any deltas
@@ -597,8 +597,8 @@ Result<PropertyValue> VertexAccessor::GetProperty(PropertyId property, View view
 
 Result<uint64_t> VertexAccessor::GetPropertySize(PropertyId property, View view) const {
   {
-    auto guard = std::shared_lock{vertex_->lock};
-    Delta *delta = vertex_->delta;
+    auto guard = LockForRead(*vertex_, transaction_);
+    Delta *delta = DeltaForRead(*vertex_, transaction_);
     if (!delta) {
       return vertex_->properties.PropertySize(property);
     }
@@ -621,10 +621,10 @@ Result<std::map<PropertyId, PropertyValue>> VertexAccessor::Properties(View view
   std::map<PropertyId, PropertyValue> properties;
   Delta *delta = nullptr;
   {
-    auto guard = std::shared_lock{vertex_->lock};
+    auto guard = LockForRead(*vertex_, transaction_);
     deleted = vertex_->deleted;
     properties = vertex_->properties.Properties();
-    delta = vertex_->delta;
+    delta = DeltaForRead(*vertex_, transaction_);
   }
 
   // Checking cache has a cost, only do it if we have any deltas
@@ -742,14 +742,14 @@ Result<EdgesVertexAccessorResult> VertexAccessor::InEdges(View view, const std::
   Delta *delta = nullptr;
   int64_t expanded_count = 0;
   {
-    auto guard = std::shared_lock{vertex_->lock};
+    auto guard = LockForRead(*vertex_, transaction_);
     deleted = vertex_->deleted;
     if (edge_types.empty() && !destination) {
       expanded_count = HandleExpansionsWithoutEdgeTypes(in_edges, hops_limit, EdgeDirection::IN);
     } else {
       expanded_count = HandleExpansionsWithEdgeTypes(in_edges, edge_types, destination, hops_limit, EdgeDirection::IN);
     }
-    delta = vertex_->delta;
+    delta = DeltaForRead(*vertex_, transaction_);
   }
 
   // Checking cache has a cost, only do it if we have any deltas
@@ -826,7 +826,7 @@ Result<EdgesVertexAccessorResult> VertexAccessor::OutEdges(View view, const std:
   Delta *delta = nullptr;
   int64_t expanded_count = 0;
   {
-    auto guard = std::shared_lock{vertex_->lock};
+    auto guard = LockForRead(*vertex_, transaction_);
     deleted = vertex_->deleted;
     if (edge_types.empty() && !destination) {
       expanded_count = HandleExpansionsWithoutEdgeTypes(out_edges, hops_limit, EdgeDirection::OUT);
@@ -834,7 +834,7 @@ Result<EdgesVertexAccessorResult> VertexAccessor::OutEdges(View view, const std:
       expanded_count =
           HandleExpansionsWithEdgeTypes(out_edges, edge_types, destination, hops_limit, EdgeDirection::OUT);
     }
-    delta = vertex_->delta;
+    delta = DeltaForRead(*vertex_, transaction_);
   }
 
   // Checking cache has a cost, only do it if we have any deltas
@@ -895,10 +895,10 @@ Result<size_t> VertexAccessor::InDegree(View view) const {
   size_t degree = 0;
   Delta *delta = nullptr;
   {
-    auto guard = std::shared_lock{vertex_->lock};
+    auto guard = LockForRead(*vertex_, transaction_);
     deleted = vertex_->deleted;
     degree = vertex_->in_edges.size();
-    delta = vertex_->delta;
+    delta = DeltaForRead(*vertex_, transaction_);
   }
 
   // Checking cache has a cost, only do it if we have any deltas
@@ -951,10 +951,10 @@ Result<size_t> VertexAccessor::OutDegree(View view) const {
   size_t degree = 0;
   Delta *delta = nullptr;
   {
-    auto guard = std::shared_lock{vertex_->lock};
+    auto guard = LockForRead(*vertex_, transaction_);
     deleted = vertex_->deleted;
     degree = vertex_->out_edges.size();
-    delta = vertex_->delta;
+    delta = DeltaForRead(*vertex_, transaction_);
   }
 
   // Checking cache has a cost, only do it if we have any deltas
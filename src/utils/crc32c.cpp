@@ -0,0 +1,78 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include "utils/crc32c.hpp"
+
+#include <array>
+#include <cstring>
+
+#if defined(__x86_64__)
+#include <nmmintrin.h>
+#endif
+
+namespace memgraph::utils {
+
+namespace {
+
+// Reversed Castagnoli polynomial.
+constexpr uint32_t kPolynomial = 0x82F63B78;
+
+constexpr std::array<uint32_t, 256> MakeTable() {
+  std::array<uint32_t, 256> table{};
+  for (uint32_t i = 0; i < 256; ++i) {
+    uint32_t crc = i;
+    for (int bit = 0; bit < 8; ++bit) {
+      crc = (crc & 1U) ? (crc >> 1U) ^ kPolynomial : crc >> 1U;
+    }
+    table[i] = crc;
+  }
+  return table;
+}
+
+constexpr auto kTable = MakeTable();
+
+uint32_t Crc32cSoftware(uint32_t crc, const uint8_t *data, size_t size) {
+  for (size_t i = 0; i < size; ++i) {
+    crc = kTable[(crc ^ data[i]) & 0xFFU] ^ (crc >> 8U);
+  }
+  return crc;
+}
+
+#if defined(__x86_64__)
+__attribute__((target("sse4.2"))) uint32_t Crc32cHardware(uint32_t crc, const uint8_t *data, size_t size) {
+  uint64_t crc64 = crc;
+  for (; size >= sizeof(uint64_t); size -= sizeof(uint64_t), data += sizeof(uint64_t)) {
+    uint64_t word = 0;
+    std::memcpy(&word, data, sizeof(word));
+    crc64 = _mm_crc32_u64(crc64, word);
+  }
+  auto crc32 = static_cast<uint32_t>(crc64);
+  for (; size > 0; --size, ++data) {
+    crc32 = _mm_crc32_u8(crc32, *data);
+  }
+  return crc32;
+}
+
+const bool kHasHardwareCrc = __builtin_cpu_supports("sse4.2");
+#endif
+
+}  // namespace
+
+uint32_t Crc32c(uint32_t crc, const void *data, size_t size) {
+  const auto *bytes = static_cast<const uint8_t *>(data);
+  crc = ~crc;
+#if defined(__x86_64__)
+  if (kHasHardwareCrc) return ~Crc32cHardware(crc, bytes, size);
+#endif
+  return ~Crc32cSoftware(crc, bytes, size);
+}
+
+}  // namespace memgraph::utils
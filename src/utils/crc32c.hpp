@@ -0,0 +1,29 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace memgraph::utils {
+
+/**
+ * Extends the CRC32C (Castagnoli) checksum `crc` with `size` bytes of
+ * `data`. Start with a `crc` of 0, calculating the checksum of a buffer in
+ * chunks gives the same result as calculating it at once.
+ *
+ * The SSE4.2 `crc32` instruction is used when the CPU supports it, otherwise
+ * the checksum is calculated with a lookup table.
+ */
+uint32_t Crc32c(uint32_t crc, const void *data, size_t size);
+
+}  // namespace memgraph::utils
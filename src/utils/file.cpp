@@ -295,12 +295,18 @@ OutputFile::~OutputFile() {
 }
 
 OutputFile::OutputFile(OutputFile &&other) noexcept
-    : fd_(other.fd_), written_since_last_sync_(other.written_since_last_sync_), path_(std::move(other.path_)) {
+    : fd_(other.fd_),
+      written_since_last_sync_(other.written_since_last_sync_),
+      path_(std::move(other.path_)),
+      terminator_enabled_(other.terminator_enabled_),
+      data_end_(other.data_end_) {
   memcpy(buffer_, other.buffer_, kFileBufferSize);
   buffer_position_.store(other.buffer_position_.load());
   other.fd_ = -1;
   other.written_since_last_sync_ = 0;
   other.buffer_position_ = 0;
+  other.terminator_enabled_ = false;
+  other.data_end_ = 0;
 }
 
 OutputFile &OutputFile::operator=(OutputFile &&other) noexcept {
@@ -311,10 +317,14 @@ OutputFile &OutputFile::operator=(OutputFile &&other) noexcept {
   path_ = std::move(other.path_);
   buffer_position_ = other.buffer_position_.load();
   memcpy(buffer_, other.buffer_, kFileBufferSize);
+  terminator_enabled_ = other.terminator_enabled_;
+  data_end_ = other.data_end_;
 
   other.fd_ = -1;
   other.written_since_last_sync_ = 0;
   other.buffer_position_ = 0;
+  other.terminator_enabled_ = false;
+  other.data_end_ = 0;
 
   return *this;
 }
@@ -430,9 +440,12 @@ bool OutputFile::AcquireLock() {
 void OutputFile::Sync() {
   FlushBuffer(true);
 
+  // `fdatasync` skips the metadata that isn't needed to read the data back,
+  // e.g. the modification time, so overwriting already allocated parts of
+  // the file doesn't have to go through the filesystem journal.
   int ret = 0;
   while (true) {
-    ret = fsync(fd_);
+    ret = fdatasync(fd_);
     if (ret == -1 && errno == EINTR) {
       // The call was interrupted, try again...
       continue;
@@ -499,6 +512,8 @@ void OutputFile::Close() noexcept {
   fd_ = -1;
   written_since_last_sync_ = 0;
   path_ = "";
+  terminator_enabled_ = false;
+  data_end_ = 0;
 }
 
 void OutputFile::FlushBuffer(bool force_flush) {
@@ -534,9 +549,35 @@ void OutputFile::FlushBufferInternal() {
     buffer += written;
   }
 
+  if (terminator_enabled_ && buffer != buffer_) WriteTerminator();
+
   buffer_position_.store(buffer_position);
 }
 
+void OutputFile::WriteTerminator() {
+  // Flushes after seeking back into already written data don't extend it
+  const auto position = SeekFile(Position::RELATIVE_TO_CURRENT, 0);
+  if (position < data_end_) return;
+  data_end_ = position;
+
+  const uint8_t terminator = 0;
+  while (true) {
+    auto written = pwrite(fd_, &terminator, sizeof(terminator), static_cast<off_t>(position));
+    if (written == -1 && errno == EINTR) {
+      continue;
+    }
+    MG_ASSERT(written == sizeof(terminator), "While trying to write to {} an error occurred: {} ({})", path_,
+              strerror(errno), errno);
+    break;
+  }
+}
+
+void OutputFile::EnableTerminator() {
+  MG_ASSERT(IsOpen(), "Trying to enable the terminator of an unopened file!");
+  terminator_enabled_ = true;
+  data_end_ = SeekFile(Position::RELATIVE_TO_CURRENT, 0) + buffer_position_.load();
+}
+
 void OutputFile::DisableFlushing() { flush_lock_.lock_shared(); }
 
 void OutputFile::EnableFlushing() {
@@ -557,6 +598,42 @@ size_t OutputFile::GetSize() {
   return SeekFile(Position::RELATIVE_TO_END, 0) + buffer_position_.load();
 }
 
+size_t OutputFile::GetFlushedPosition() { return SeekFile(Position::RELATIVE_TO_CURRENT, 0); }
+
+bool OutputFile::Preallocate(size_t size) {
+  MG_ASSERT(IsOpen(), "Trying to preallocate an unopened file!");
+  int ret = 0;
+  while (true) {
+    ret = fallocate(fd_, 0, 0, static_cast<off_t>(size));
+    if (ret == -1 && errno == EINTR) {
+      // The call was interrupted, try again...
+      continue;
+    } else {
+      break;
+    }
+  }
+  if (ret == -1 && errno == EOPNOTSUPP) return false;
+  MG_ASSERT(ret == 0, "While trying to preallocate {} bytes for {} an error occurred: {} ({})", size, path_,
+            strerror(errno), errno);
+  return true;
+}
+
+void OutputFile::TruncateAtPosition() {
+  FlushBuffer(true);
+  const auto position = SeekFile(Position::RELATIVE_TO_CURRENT, 0);
+  int ret = 0;
+  while (true) {
+    ret = ftruncate(fd_, static_cast<off_t>(position));
+    if (ret == -1 && errno == EINTR) {
+      // The call was interrupted, try again...
+      continue;
+    } else {
+      break;
+    }
+  }
+  MG_ASSERT(ret == 0, "While trying to truncate {} an error occurred: {} ({})", path_, strerror(errno), errno);
+}
+
 void OutputFile::TryFlushing() {
   if (std::unique_lock guard(flush_lock_, std::try_to_lock); guard.owns_lock()) {
     FlushBufferInternal();
@@ -256,9 +256,33 @@ class OutputFile {
   /// Get the size of the file.
   size_t GetSize();
 
+  /// Returns the current absolute position in the file without the data that
+  /// is still in the internal buffer. Unlike `GetPosition` it doesn't flush
+  /// the buffer, so it can also be used while the flushing is disabled.
+  size_t GetFlushedPosition();
+
+  /// Allocates disk space for the first `size` bytes of the file. If the file
+  /// is smaller it is extended with zeros, so writes within the allocated
+  /// space don't change the file size. Returns `false` if the filesystem
+  /// doesn't support preallocation. On other failures and misuse it crashes
+  /// the program.
+  bool Preallocate(size_t size);
+
+  /// Flushes the internal buffer and truncates the file at the current
+  /// position. On failure and misuse it crashes the program.
+  void TruncateAtPosition();
+
+  /// After this call every flush that extends the written data also writes a
+  /// zero byte right after it, without moving the position. Readers of a
+  /// reused file then never run from the new data into the old content. The
+  /// byte is overwritten by the next write and removed by
+  /// `TruncateAtPosition`.
+  void EnableTerminator();
+
  private:
   void FlushBuffer(bool force_flush);
   void FlushBufferInternal();
+  void WriteTerminator();
 
   size_t SeekFile(Position position, ssize_t offset);
 
@@ -267,6 +291,9 @@ class OutputFile {
   std::filesystem::path path_;
   uint8_t buffer_[kFileBufferSize];
   std::atomic<size_t> buffer_position_{0};
+  bool terminator_enabled_{false};
+  // End of the data written so far, the terminator is written there
+  size_t data_end_{0};
 
   // Flushing buffer should be a higher priority
   utils::RWLock flush_lock_{RWLock::Priority::WRITE};
@@ -38,6 +38,14 @@ void FileRetainer::DeleteFile(const std::filesystem::path &path) {
   DeleteOrAddToQueue(absolute_path);
 }
 
+bool FileRetainer::MoveFileIfUnlocked(const std::filesystem::path &path, const std::filesystem::path &new_path) {
+  if (active_accessors_.load()) return false;
+  std::unique_lock guard(main_lock_);
+  auto absolute_path = std::filesystem::absolute(path);
+  if (FileLocked(absolute_path)) return false;
+  return RenamePath(absolute_path, new_path);
+}
+
 FileRetainer::FileLocker FileRetainer::AddLocker() {
   const size_t current_locker_id = next_locker_id_.fetch_add(1);
   lockers_.WithLock([&](auto &lockers) { lockers.emplace(current_locker_id, LockerEntry{}); });
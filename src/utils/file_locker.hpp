@@ -158,6 +158,13 @@ class FileRetainer {
    */
   void DeleteFile(const std::filesystem::path &path);
 
+  /**
+   * Move a file to `new_path` if it isn't inside any of the lockers and no
+   * thread is modifying the lockers.
+   * Returns false if the file wasn't moved.
+   */
+  bool MoveFileIfUnlocked(const std::filesystem::path &path, const std::filesystem::path &new_path);
+
   /**
    * Create and return a new locker.
    */
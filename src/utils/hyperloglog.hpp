@@ -0,0 +1,80 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+#include "utils/memory.hpp"
+#include "utils/pmr/vector.hpp"
+
+namespace memgraph::utils {
+
+/**
+ * HyperLogLog sketch which estimates the number of distinct hashes added to
+ * it using 2^kPrecision bytes. The standard error of the estimate is about
+ * 1.04 / sqrt(2^kPrecision), i.e. 1.6%.
+ *
+ * The registers are allocated on the first `Add`, so an unused sketch doesn't
+ * take any memory. Hashes are mixed before use, so weak hashes such as the
+ * identity hash of integers are fine.
+ */
+class HyperLogLog {
+ public:
+  static constexpr uint64_t kPrecision = 12;
+  static constexpr size_t kRegisters = size_t{1} << kPrecision;
+
+  explicit HyperLogLog(MemoryResource *memory) : registers_(memory) {}
+
+  void Add(uint64_t hash) {
+    if (registers_.empty()) registers_.resize(kRegisters, 0);
+    hash = Mix(hash);
+    const auto index = hash >> (64 - kPrecision);
+    // The sentinel bit caps the rank when all of the remaining bits are zero.
+    const auto remaining = (hash << kPrecision) | (uint64_t{1} << (kPrecision - 1));
+    const auto rank = static_cast<uint8_t>(__builtin_clzll(remaining) + 1);
+    registers_[index] = std::max(registers_[index], rank);
+  }
+
+  uint64_t Estimate() const {
+    if (registers_.empty()) return 0;
+    double sum = 0.0;
+    size_t zeros = 0;
+    for (const auto rank : registers_) {
+      sum += std::ldexp(1.0, -static_cast<int>(rank));
+      if (rank == 0) ++zeros;
+    }
+    constexpr auto m = static_cast<double>(kRegisters);
+    const double alpha = 0.7213 / (1.0 + 1.079 / m);
+    auto estimate = alpha * m * m / sum;
+    // Linear counting is more accurate while many registers are still empty.
+    if (estimate <= 2.5 * m && zeros > 0) estimate = m * std::log(m / static_cast<double>(zeros));
+    return static_cast<uint64_t>(std::llround(estimate));
+  }
+
+ private:
+  // Finalizer of the SplitMix64 generator.
+  static uint64_t Mix(uint64_t hash) {
+    hash ^= hash >> 30;
+    hash *= 0xbf58476d1ce4e5b9ULL;
+    hash ^= hash >> 27;
+    hash *= 0x94d049bb133111ebULL;
+    hash ^= hash >> 31;
+    return hash;
+  }
+
+  pmr::vector<uint8_t> registers_;
+};
+
+}  // namespace memgraph::utils
@@ -0,0 +1,94 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include "utils/lock_profile.hpp"
+
+#include <array>
+
+#include "utils/event_histogram.hpp"
+
+namespace memgraph::utils {
+
+namespace detail {
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+std::atomic<bool> lock_profiling_enabled{false};
+}  // namespace detail
+
+namespace {
+
+constexpr auto kLockKindCount = static_cast<size_t>(LockKind::RW_SPIN_LOCK) + 1;
+
+// Every thread adds its acquisitions to the shared counter only once per this
+// many, so counting doesn't contend on the counter itself.
+constexpr uint64_t kAcquisitionSampleRate = 64;
+
+struct LockProfile {
+  std::atomic<uint64_t> acquisitions{0};
+  std::atomic<uint64_t> contentions{0};
+  std::atomic<uint64_t> wait_total_us{0};
+  std::atomic<uint64_t> wait_max_us{0};
+  metrics::Histogram wait_us;
+};
+
+constexpr std::array<std::pair<std::string_view, std::string_view>, kLockKindCount> kLockNames{{
+    {"engine", "EngineLock"},
+    {"gc", "GcLock"},
+    {"dbms", "DbmsLock"},
+    {"plan_cache", "PlanCacheLock"},
+    {"ring_buffer", "RingBufferLock"},
+    {"rw_spin_lock", "RWSpinLock"},
+}};
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+std::array<LockProfile, kLockKindCount> profiles;
+
+}  // namespace
+
+void EnableLockProfiling(bool enabled) { detail::lock_profiling_enabled.store(enabled, std::memory_order_relaxed); }
+
+void RecordLockAcquisition(LockKind kind) {
+  thread_local std::array<uint64_t, kLockKindCount> pending{};
+  const auto index = static_cast<size_t>(kind);
+  if (++pending[index] < kAcquisitionSampleRate) return;
+  profiles[index].acquisitions.fetch_add(pending[index], std::memory_order_relaxed);
+  pending[index] = 0;
+}
+
+void RecordLockContention(LockKind kind, std::chrono::steady_clock::duration wait) {
+  auto &profile = profiles[static_cast<size_t>(kind)];
+  const auto wait_us = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(wait).count());
+  profile.contentions.fetch_add(1, std::memory_order_relaxed);
+  profile.wait_total_us.fetch_add(wait_us, std::memory_order_relaxed);
+  auto max = profile.wait_max_us.load(std::memory_order_relaxed);
+  while (wait_us > max && !profile.wait_max_us.compare_exchange_weak(max, wait_us, std::memory_order_relaxed)) {
+  }
+  profile.wait_us.Measure(wait_us);
+}
+
+std::vector<LockStatistics> GetLockStatistics() {
+  std::vector<LockStatistics> statistics;
+  statistics.reserve(kLockKindCount);
+  for (size_t i = 0; i < kLockKindCount; ++i) {
+    const auto &profile = profiles[i];
+    statistics.push_back({.name = kLockNames[i].first,
+                          .metric_name = kLockNames[i].second,
+                          .acquisitions = profile.acquisitions.load(std::memory_order_relaxed),
+                          .contentions = profile.contentions.load(std::memory_order_relaxed),
+                          .wait_total_us = profile.wait_total_us.load(std::memory_order_relaxed),
+                          .wait_max_us = profile.wait_max_us.load(std::memory_order_relaxed),
+                          .wait_p50_us = profile.wait_us.Percentile(50),
+                          .wait_p90_us = profile.wait_us.Percentile(90),
+                          .wait_p99_us = profile.wait_us.Percentile(99)});
+  }
+  return statistics;
+}
+
+}  // namespace memgraph::utils
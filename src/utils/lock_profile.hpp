@@ -0,0 +1,122 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+namespace memgraph::utils {
+
+/// Locks whose contention is profiled. All locks of one kind share a single
+/// profile, so profiling doesn't add any state to the locks themselves.
+/// `RW_SPIN_LOCK` covers every `RWSpinLock`, which are mostly vertex and edge
+/// locks. Only its contended acquisitions are recorded, so the uncontended
+/// path of those locks stays as it is.
+enum class LockKind : uint8_t { ENGINE, GC, DBMS, PLAN_CACHE, RING_BUFFER, RW_SPIN_LOCK };
+
+struct LockStatistics {
+  std::string_view name;
+  std::string_view metric_name;
+  // Acquisitions are sampled per thread, so this is an estimate.
+  uint64_t acquisitions;
+  uint64_t contentions;
+  uint64_t wait_total_us;
+  uint64_t wait_max_us;
+  // Percentiles of the time spent waiting on a contended acquisition.
+  uint64_t wait_p50_us;
+  uint64_t wait_p90_us;
+  uint64_t wait_p99_us;
+};
+
+namespace detail {
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+extern std::atomic<bool> lock_profiling_enabled;
+}  // namespace detail
+
+inline bool LockProfilingEnabled() { return detail::lock_profiling_enabled.load(std::memory_order_relaxed); }
+
+void EnableLockProfiling(bool enabled);
+
+void RecordLockAcquisition(LockKind kind);
+
+void RecordLockContention(LockKind kind, std::chrono::steady_clock::duration wait);
+
+std::vector<LockStatistics> GetLockStatistics();
+
+/// Measures the time spent waiting for a contended lock, from construction
+/// until destruction. Does nothing when profiling is disabled.
+class LockContentionTimer {
+ public:
+  explicit LockContentionTimer(LockKind kind) : kind_(kind) {
+    if (LockProfilingEnabled()) [[unlikely]] {
+      start_ = std::chrono::steady_clock::now();
+    }
+  }
+
+  LockContentionTimer(const LockContentionTimer &) = delete;
+  LockContentionTimer &operator=(const LockContentionTimer &) = delete;
+  LockContentionTimer(LockContentionTimer &&) = delete;
+  LockContentionTimer &operator=(LockContentionTimer &&) = delete;
+
+  ~LockContentionTimer() {
+    if (start_) [[unlikely]] {
+      RecordLockContention(kind_, std::chrono::steady_clock::now() - *start_);
+    }
+  }
+
+ private:
+  LockKind kind_;
+  std::optional<std::chrono::steady_clock::time_point> start_;
+};
+
+/// `TMutex` that records its acquisitions and contended waits under the
+/// profile of `kind`. The lock is first tried without waiting, so only
+/// acquisitions that actually had to wait are timed. When profiling is
+/// disabled it behaves exactly like `TMutex`.
+template <typename TMutex, LockKind kind>
+class ProfiledLock : public TMutex {
+ public:
+  using TMutex::TMutex;
+
+  void lock() {
+    if (!LockProfilingEnabled()) [[likely]] {
+      TMutex::lock();
+      return;
+    }
+    RecordLockAcquisition(kind);
+    if (TMutex::try_lock()) return;
+    const auto timer = LockContentionTimer{kind};
+    TMutex::lock();
+  }
+
+  void lock_shared()
+    requires requires(TMutex &mutex) {
+      mutex.lock_shared();
+      mutex.try_lock_shared();
+    }
+  {
+    if (!LockProfilingEnabled()) [[likely]] {
+      TMutex::lock_shared();
+      return;
+    }
+    RecordLockAcquisition(kind);
+    if (TMutex::try_lock_shared()) return;
+    const auto timer = LockContentionTimer{kind};
+    TMutex::lock_shared();
+  }
+};
+
+}  // namespace memgraph::utils
@@ -15,6 +15,8 @@
 #include <atomic>
 #include <cstdint>
 
+#include "utils/lock_profile.hpp"
+
 namespace memgraph::utils {
 namespace {
 /// A helper for RWSpinLock, allows a contended spin lock to yield to another thread.
@@ -58,17 +60,15 @@ struct RWSpinLock {
   RWSpinLock &operator=(RWSpinLock &&) = default;
 
   void lock() {
-    // spin: to grant the UNIQUE_LOCKED bit
-    while (true) {
-      // optimistic: assume we will be granted the lock
-      auto const phase1 = std::atomic_ref{lock_status_}.fetch_or(UNIQUE_LOCKED, std::memory_order_acq_rel);
-      // check: we were granted UNIQUE_LOCK and no current readers
-      if (phase1 == 0) [[likely]]
-        return;
-      // check: we were granted UNIQUE_LOCK, but need to wait for readers
-      if ((phase1 & UNIQUE_LOCKED) != UNIQUE_LOCKED) [[likely]]
-        break;
+    // optimistic: assume we will be granted the lock
+    auto phase1 = std::atomic_ref{lock_status_}.fetch_or(UNIQUE_LOCKED, std::memory_order_acq_rel);
+    // check: we were granted UNIQUE_LOCK and no current readers
+    if (phase1 == 0) [[likely]]
+      return;
 
+    auto const contention = LockContentionTimer{LockKind::RW_SPIN_LOCK};
+    // spin: to grant the UNIQUE_LOCKED bit
+    while ((phase1 & UNIQUE_LOCKED) == UNIQUE_LOCKED) {
       // spin: to wait for UNIQUE_LOCKED to be available
       auto maybe_yield = yeilder{};
       while (true) {
@@ -78,6 +78,7 @@ struct RWSpinLock {
           break;
         maybe_yield();
       }
+      phase1 = std::atomic_ref{lock_status_}.fetch_or(UNIQUE_LOCKED, std::memory_order_acq_rel);
     }
 
     // spin: to wait for readers to leave
@@ -90,18 +91,19 @@ struct RWSpinLock {
     }
   }
 
+  bool try_lock() {
+    auto expected = status_t{0};
+    return std::atomic_ref{lock_status_}.compare_exchange_strong(expected, UNIQUE_LOCKED, std::memory_order_acq_rel);
+  }
+
   void unlock() { std::atomic_ref{lock_status_}.fetch_and(~UNIQUE_LOCKED, std::memory_order_release); }
 
   void lock_shared() {
-    while (true) {
-      // optimistic: assume we will be granted the lock
-      auto const phase1 = std::atomic_ref{lock_status_}.fetch_add(READER, std::memory_order_acquire);
-      // check: we incremented reader count without the UNIQUE_LOCK already being held
-      if ((phase1 & UNIQUE_LOCKED) != UNIQUE_LOCKED) [[likely]]
-        return;
-      // correct for our optimism, we shouldn't have modified the reader count
-      std::atomic_ref{lock_status_}.fetch_sub(READER, std::memory_order_release);
+    if (try_lock_shared()) [[likely]]
+      return;
 
+    auto const contention = LockContentionTimer{LockKind::RW_SPIN_LOCK};
+    while (true) {
       // spin: to wait for UNIQUE_LOCKED to be available
       auto maybe_yield = yeilder{};
       while (true) {
@@ -111,9 +113,21 @@ struct RWSpinLock {
           break;
         maybe_yield();
       }
+      if (try_lock_shared()) return;
     }
   }
 
+  bool try_lock_shared() {
+    // optimistic: assume we will be granted the lock
+    auto const phase1 = std::atomic_ref{lock_status_}.fetch_add(READER, std::memory_order_acquire);
+    // check: we incremented reader count without the UNIQUE_LOCK already being held
+    if ((phase1 & UNIQUE_LOCKED) != UNIQUE_LOCKED) [[likely]]
+      return true;
+    // correct for our optimism, we shouldn't have modified the reader count
+    std::atomic_ref{lock_status_}.fetch_sub(READER, std::memory_order_release);
+    return false;
+  }
+
   void unlock_shared() { std::atomic_ref{lock_status_}.fetch_sub(READER, std::memory_order_release); }
 
   bool is_locked() const { return std::atomic_ref{lock_status_}.load(std::memory_order_relaxed) != 0; }
@@ -63,11 +63,11 @@ constexpr uint64_t kSkipListGcHeightTrigger = 16;
 /// elements.
 constexpr int kSkipListCountEstimateDefaultLayer = 10;
 
-/// These variables define the storage sizes for the SkipListGc. The internal
-/// storage of the GC and the Stack storage used within the GC are all
+/// These variables define the storage sizes for the SkipListGc. The accessor
+/// stripes of the GC and the Stack storage used within the GC are all
 /// optimized to have block sizes that are a whole multiple of the memory page
 /// size.
-constexpr uint64_t kSkipListGcBlockSize = 8189;
+constexpr uint64_t kSkipListGcStripes = 64;
 constexpr uint64_t kSkipListGcStackSize = 8191;
 
 namespace detail {
@@ -92,6 +92,14 @@ struct SkipListNode_base {
     return __builtin_ffs(value);
   }
 };
+
+/// Stripe of the SkipListGc accessor counters used by the calling thread.
+/// Threads are assigned stripes round-robin on their first access.
+inline uint64_t SkipListGcThreadStripe() {
+  static std::atomic<uint64_t> next_stripe{0};
+  thread_local const uint64_t stripe = next_stripe.fetch_add(1, std::memory_order_relaxed) % kSkipListGcStripes;
+  return stripe;
+}
 }  // namespace detail
 
 /// This is the Node object that represents each element stored in the list. The
@@ -180,28 +188,22 @@ constexpr uint64_t SkipListLayerForAverageEqualsEstimation(const uint64_t N) {
 /// The skip list doesn't have built-in reclamation of removed nodes (objects).
 /// This class handles all operations necessary to remove the nodes safely.
 ///
-/// The principal of operation is as follows:
-/// Each accessor to the skip list is given an ID. When nodes are garbage
-/// collected the ID of the currently newest living accessor is recorded. When
-/// that accessor is destroyed the node can be safely destroyed.
+/// The principal of operation is epoch-based reclamation:
+/// Each accessor to the skip list announces itself in the current global
+/// epoch. When nodes are garbage collected the current epoch is recorded. The
+/// epoch is advanced only when no accessor is left in the previous epoch, so at
+/// most two epochs are alive at any time. A node removed in epoch `e` can be
+/// safely destroyed once the epoch reaches `e + 2`.
 /// This is correct because when the skip list removes the node it immediately
-/// unlinks it from the structure so no new accessors can reach it. The last
-/// possible accessor that can still have a reference to the removed object is
-/// the currently living accessor that has the largest ID.
-///
-/// To enable fast operations this GC stores accessor IDs in a specially crafted
-/// structure. It consists of a doubly-linked list of Blocks. Each Block holds
-/// the information (alive/dead) for about 500k accessors. When an accessor is
-/// destroyed the corresponding bit for the accessor is found in the list and is
-/// set. When garbage collection occurs it finds the largest prefix of dead
-/// accessors and destroys all nodes that have the largest living accessor ID
-/// corresponding to them less than the largest currently found dead accessor.
+/// unlinks it from the structure so no new accessors can reach it. The only
+/// accessors that can still have a reference to the removed object are the
+/// ones that announced themselves in epoch `e` or earlier.
 ///
-/// Insertion into the dead accessor list is fast because the blocks are large
-/// and the corresponding bit can be set atomically. The only times when the
-/// collection is blocking is when the structure of the doubly-linked list has
-/// to be changed (eg. a new Block has to be allocated and linked into the
-/// structure).
+/// To keep accessor creation and destruction cheap the announcements are
+/// counted per epoch parity in `kSkipListGcStripes` cache-line sized stripes.
+/// Each thread always uses the same stripe, so accessors created on different
+/// threads don't bounce a shared cache line between cores. Only the garbage
+/// collection pass, which is already rare and serialized, reads all stripes.
 template <typename TObj>
 class SkipListGc final {
  private:
@@ -209,48 +211,50 @@ class SkipListGc final {
   using TDeleted = std::pair<uint64_t, TNode *>;
   using TStack = Stack<TDeleted, kSkipListGcStackSize>;
 
-  static constexpr uint64_t kIdsInField = sizeof(uint64_t) * 8;
-  static constexpr uint64_t kIdsInBlock = kSkipListGcBlockSize * kIdsInField;
+  static constexpr uint64_t kStripeBits = 6;
+  static_assert(kSkipListGcStripes == 1UL << kStripeBits, "Accessor IDs encode the stripe in the lowest bits!");
+
+  struct alignas(64) Stripe {
+    std::atomic<uint64_t> active[2]{};
+  };
 
-  struct Block {
-    std::atomic<Block *> prev;
-    std::atomic<Block *> succ;
-    uint64_t first_id;
-    std::atomic<uint64_t> field[kSkipListGcBlockSize];
+  struct Stripes {
+    Stripe stripe[kSkipListGcStripes];
   };
 
-  Block *AllocateBlock(Block *head) {
+  Stripes *AllocateStripes() {
     auto guard = std::lock_guard{lock_};
-    Block *curr_head = head_.load(std::memory_order_acquire);
-    if (curr_head == head) {
+    Stripes *stripes = stripes_.load(std::memory_order_acquire);
+    if (stripes == nullptr) {
       // Construct through allocator so it propagates if needed.
-      Allocator<Block> block_allocator(memory_);
-      Block *block = block_allocator.allocate(1);
-      // `calloc` would be faster, but the API has no such call.
-      memset(block, 0, sizeof(Block));
-      // Block constructor should not throw.
-      block_allocator.construct(block);
-      block->prev.store(curr_head, std::memory_order_release);
-      block->succ.store(nullptr, std::memory_order_release);
-      block->first_id = last_id_;
-      last_id_ += kIdsInBlock;
-      if (curr_head == nullptr) {
-        tail_.store(block, std::memory_order_release);
-      } else {
-        curr_head->succ.store(block, std::memory_order_release);
-      }
-      head_.store(block, std::memory_order_release);
-      return block;
-    } else {
-      return curr_head;
+      Allocator<Stripes> stripes_allocator(memory_);
+      stripes = stripes_allocator.allocate(1);
+      // Stripes constructor should not throw.
+      stripes_allocator.construct(stripes);
+      stripes_.store(stripes, std::memory_order_release);
     }
+    return stripes;
+  }
+
+  /// Advances the epoch if no accessor is left in the previous one. Must be
+  /// called while holding `lock_`.
+  bool TryAdvanceEpoch() {
+    Stripes *stripes = stripes_.load(std::memory_order_acquire);
+    if (stripes == nullptr) return false;
+    const uint64_t epoch = epoch_.load(std::memory_order_seq_cst);
+    const uint64_t previous = (epoch + 1) % 2;
+    for (auto &stripe : stripes->stripe) {
+      if (stripe.active[previous].load(std::memory_order_seq_cst) != 0) return false;
+    }
+    epoch_.store(epoch + 1, std::memory_order_seq_cst);
+    return true;
   }
 
  public:
   explicit SkipListGc(MemoryResource *memory) : memory_(memory) {
-    static_assert(sizeof(Block) % kLinuxPageSize == 0,
-                  "It is recommended that you set the kSkipListGcBlockSize "
-                  "constant so that the size of SkipListGc::Block is a "
+    static_assert(sizeof(Stripes) % kLinuxPageSize == 0,
+                  "It is recommended that you set the kSkipListGcStripes "
+                  "constant so that the size of SkipListGc::Stripes is a "
                   "multiple of the page size.");
   }
 
@@ -259,44 +263,47 @@ class SkipListGc final {
   SkipListGc(SkipListGc &&other) = delete;
   SkipListGc &operator=(SkipListGc &&other) = delete;
 
-  ~SkipListGc() { Clear(); }
+  ~SkipListGc() {
+    Clear();
+    Stripes *stripes = stripes_.load(std::memory_order_acquire);
+    if (stripes != nullptr) {
+      Allocator<Stripes> stripes_allocator(memory_);
+      stripes->~Stripes();
+      stripes_allocator.deallocate(stripes, 1);
+    }
+  }
 
   uint64_t AllocateId() {
 #ifndef NDEBUG
     alive_accessors_.fetch_add(1, std::memory_order_acq_rel);
 #endif
-    return accessor_id_.fetch_add(1, std::memory_order_acq_rel);
-  }
-
-  void ReleaseId(uint64_t id) {
-    // This function only needs to acquire a lock when allocating a new block
-    // (in the `AllocateBlock` function), but otherwise doesn't need to acquire
-    // a lock because it iterates over the linked list and atomically sets its
-    // 'dead' bit in the block field. The structure of the linked list can be
-    // accessed without a lock because all of the pointers in the list are
-    // atomic and their modification is done so that the access is always
-    // correct.
-    Block *head = head_.load(std::memory_order_acquire);
-    if (head == nullptr) {
-      head = AllocateBlock(head);
+    Stripes *stripes = stripes_.load(std::memory_order_acquire);
+    if (stripes == nullptr) {
+      stripes = AllocateStripes();
     }
+    const uint64_t stripe = detail::SkipListGcThreadStripe();
     while (true) {
-      MG_ASSERT(head != nullptr, "Missing SkipListGc block!");
-      if (id < head->first_id) {
-        head = head->prev.load(std::memory_order_acquire);
-      } else if (id >= head->first_id + kIdsInBlock) {
-        head = AllocateBlock(head);
-      } else {
-        id -= head->first_id;
-        uint64_t field = id / kIdsInField;
-        uint64_t bit = id % kIdsInField;
-        uint64_t value = 1;
-        value <<= bit;
-        auto ret = head->field[field].fetch_or(value, std::memory_order_acq_rel);
-        MG_ASSERT(!(ret & value), "A SkipList Accessor was released twice!");
-        break;
+      const uint64_t epoch = epoch_.load(std::memory_order_seq_cst);
+      auto &active = stripes->stripe[stripe].active[epoch % 2];
+      active.fetch_add(1, std::memory_order_seq_cst);
+      // The epoch could have been advanced before the announcement became
+      // visible to the collector, in which case we have to announce ourselves
+      // in the new epoch.
+      if (epoch_.load(std::memory_order_seq_cst) == epoch) {
+        return (epoch << kStripeBits) | stripe;
       }
+      active.fetch_sub(1, std::memory_order_acq_rel);
     }
+  }
+
+  void ReleaseId(uint64_t id) {
+    // The accessor could have been moved to another thread, so the stripe it
+    // was announced in is taken from the ID and not from the current thread.
+    Stripes *stripes = stripes_.load(std::memory_order_acquire);
+    MG_ASSERT(stripes != nullptr, "Missing SkipListGc stripes!");
+    auto &active = stripes->stripe[id % kSkipListGcStripes].active[(id >> kStripeBits) % 2];
+    auto ret = active.fetch_sub(1, std::memory_order_acq_rel);
+    MG_ASSERT(ret != 0, "A SkipList Accessor was released twice!");
 #ifndef NDEBUG
     alive_accessors_.fetch_add(-1, std::memory_order_acq_rel);
 #endif
@@ -304,7 +311,7 @@ class SkipListGc final {
 
   void Collect(TNode *node) {
     std::unique_lock guard(lock_);
-    deleted_.Push({accessor_id_.load(std::memory_order_acquire), node});
+    deleted_.Push({epoch_.load(std::memory_order_seq_cst), node});
   }
 
   void Run() {
@@ -314,55 +321,14 @@ class SkipListGc final {
     utils::MemoryTracker::OutOfMemoryExceptionBlocker oom_blocker;
     if (!lock_.try_lock()) return;
     OnScopeExit cleanup([&] { lock_.unlock(); });
-    Block *tail = tail_.load(std::memory_order_acquire);
-    uint64_t last_dead = 0;
-    bool remove_block = true;
-    while (tail != nullptr && remove_block) {
-      for (uint64_t pos = 0; pos < kSkipListGcBlockSize; ++pos) {
-        uint64_t field = tail->field[pos].load(std::memory_order_acquire);
-        if (field != std::numeric_limits<uint64_t>::max()) {
-          if (field != 0) {
-            // Here we find the position of the least significant zero bit
-            // (using a inverted value and the `ffs` function to find the
-            // position of the first set bit). We find this position because we
-            // know that all bits that are of less significance are then all
-            // ones. That means that the `where_alive` will be the first ID that
-            // is still alive. That means that we have a prefix of all dead
-            // accessors that have IDs less than `where_alive`.
-            int where_alive = __builtin_ffsl(~field) - 1;
-            if (where_alive > 0) {
-              last_dead = tail->first_id + pos * kIdsInField + where_alive - 1;
-            }
-          }
-          remove_block = false;
-          break;
-        } else {
-          last_dead = tail->first_id + (pos + 1) * kIdsInField - 1;
-        }
-      }
-      Block *next = tail->succ.load(std::memory_order_acquire);
-      // Here we also check whether the next block isn't a `nullptr`. If it is
-      // `nullptr` that means that this is the last existing block. We don't
-      // want to destroy it because we would need to change the `head_` to point
-      // to `nullptr`. We can't do that because we can't guarantee that some
-      // thread doesn't have a pointer to the block that it got from reading
-      // `head_`. We bail out here, this block will be freed next time.
-      if (remove_block && next != nullptr) {
-        Allocator<Block> block_allocator(memory_);
-        MG_ASSERT(tail == tail_.load(std::memory_order_acquire),
-                  "Can't remove SkipListGc block that is in the middle!");
-        next->prev.store(nullptr, std::memory_order_release);
-        tail_.store(next, std::memory_order_release);
-        // Destroy the block.
-        tail->~Block();
-        block_allocator.deallocate(tail, 1);
-      }
-      tail = next;
-    }
+    // The accessor running the collection is itself in the current epoch, so
+    // the epoch can move forward at most twice in a single pass.
+    if (TryAdvanceEpoch()) TryAdvanceEpoch();
+    const uint64_t epoch = epoch_.load(std::memory_order_acquire);
     TStack leftover;
     std::optional<TDeleted> item;
     while ((item = deleted_.Pop())) {
-      if (item->first < last_dead) {
+      if (item->first + 2 <= epoch) {
         size_t bytes = SkipListNodeSize(*item->second);
         item->second->~TNode();
         memory_->Deallocate(item->second, bytes, SkipListNodeAlign<TObj>());
@@ -376,41 +342,23 @@ class SkipListGc final {
   MemoryResource *GetMemoryResource() const { return memory_; }
 
   void Clear() {
-    // Delete all allocated blocks.
-    Block *head = head_.load(std::memory_order_acquire);
-    while (head != nullptr) {
-      Allocator<Block> block_allocator(memory_);
-      Block *prev = head->prev.load(std::memory_order_acquire);
-      head->~Block();
-      block_allocator.deallocate(head, 1);
-      head = prev;
-    }
-
-    // Delete all items that have to be garbage collected.
-    {
-      std::optional<TDeleted> item;
-      std::unique_lock guard(lock_);
-      while ((item = deleted_.Pop())) {
-        size_t bytes = SkipListNodeSize(*item->second);
-        item->second->~TNode();
-        memory_->Deallocate(item->second, bytes, SkipListNodeAlign<TObj>());
-      }
+    // Delete all items that have to be garbage collected. The stripes are kept
+    // because accessors that are still around have to be able to release
+    // their IDs.
+    std::optional<TDeleted> item;
+    std::unique_lock guard(lock_);
+    while ((item = deleted_.Pop())) {
+      size_t bytes = SkipListNodeSize(*item->second);
+      item->second->~TNode();
+      memory_->Deallocate(item->second, bytes, SkipListNodeAlign<TObj>());
     }
-
-    // Reset all variables.
-    accessor_id_ = 0;
-    head_ = nullptr;
-    tail_ = nullptr;
-    last_id_ = 0;
   }
 
  private:
   MemoryResource *memory_;
   SpinLock lock_;
-  std::atomic<uint64_t> accessor_id_{0};
-  std::atomic<Block *> head_{nullptr};
-  std::atomic<Block *> tail_{nullptr};
-  uint64_t last_id_{0};
+  std::atomic<uint64_t> epoch_{0};
+  std::atomic<Stripes *> stripes_{nullptr};
   TStack deleted_;
 #ifndef NDEBUG
   std::atomic<uint64_t> alive_accessors_{0};
@@ -0,0 +1,240 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+// Throughput of the durability paths: WAL encoding on commit, snapshot
+// creation and recovery from snapshots and WAL files.
+//
+// For regression tracking run with `--benchmark_format=json` or
+// `--benchmark_out=<file> --benchmark_out_format=json`.
+
+#include <filesystem>
+#include <memory>
+#include <random>
+
+#include <benchmark/benchmark.h>
+#include <fmt/format.h>
+#include <gflags/gflags.h>
+
+#include "replication_coordination_glue/role.hpp"
+#include "storage/v2/config.hpp"
+#include "storage/v2/inmemory/storage.hpp"
+#include "storage/v2/property_value.hpp"
+#include "utils/logging.hpp"
+
+DEFINE_string(durability_directory, "", "Directory used for the benchmark data; a temporary one is used if empty");
+
+namespace {
+
+using memgraph::storage::Config;
+using memgraph::storage::InMemoryStorage;
+using memgraph::storage::PropertyValue;
+using memgraph::storage::Storage;
+
+const int kThreadsNum = 8;
+
+std::filesystem::path StorageDirectory() {
+  if (!FLAGS_durability_directory.empty()) return FLAGS_durability_directory;
+  return std::filesystem::temp_directory_path() / "MG_benchmark_storage_v2_durability";
+}
+
+Config MakeConfig(Config::Durability::SnapshotWalMode mode, uint64_t flush_every_n_tx = 100000) {
+  Config config{
+      .gc = {.type = Config::Gc::Type::NONE},
+      .durability = {.storage_directory = StorageDirectory(),
+                     .snapshot_wal_mode = mode,
+                     .snapshot_interval = std::chrono::hours(24),
+                     .wal_file_flush_every_n_tx = flush_every_n_tx},
+      .salient = {.items = {.properties_on_edges = true}},
+  };
+  return config;
+}
+
+Config RecoveryConfig(uint64_t recovery_threads) {
+  auto config = MakeConfig(Config::Durability::SnapshotWalMode::DISABLED);
+  config.durability.recover_on_startup = true;
+  config.durability.recovery_thread_count = recovery_threads;
+  // Small batches so the recovery threads get work on the smaller graph sizes as well
+  config.durability.items_per_batch = 10000;
+  return config;
+}
+
+void ClearDirectory() { std::filesystem::remove_all(StorageDirectory()); }
+
+// Creates `num_vertices` vertices with a label and two properties and connects
+// each one to its successor, committing every `batch` vertices.
+void CreateGraph(InMemoryStorage *storage, int64_t num_vertices, int64_t batch = 1000) {
+  auto label = storage->NameToLabel("Node");
+  auto id = storage->NameToProperty("id");
+  auto name = storage->NameToProperty("name");
+  auto edge_type = storage->NameToEdgeType("NEXT");
+  auto weight = storage->NameToProperty("weight");
+
+  std::optional<memgraph::storage::Gid> prev;
+  for (int64_t begin = 0; begin < num_vertices; begin += batch) {
+    auto acc = storage->Access();
+    std::optional<memgraph::storage::VertexAccessor> prev_vertex;
+    if (prev) prev_vertex = acc->FindVertex(*prev, memgraph::storage::View::OLD);
+    for (int64_t i = begin; i < std::min(begin + batch, num_vertices); ++i) {
+      auto vertex = acc->CreateVertex();
+      MG_ASSERT(vertex.AddLabel(label).HasValue());
+      MG_ASSERT(vertex.SetProperty(id, PropertyValue(i)).HasValue());
+      MG_ASSERT(vertex.SetProperty(name, PropertyValue(fmt::format("node_{}", i))).HasValue());
+      if (prev_vertex) {
+        auto edge = acc->CreateEdge(&*prev_vertex, &vertex, edge_type);
+        MG_ASSERT(edge.HasValue());
+        MG_ASSERT(edge->SetProperty(weight, PropertyValue(static_cast<double>(i))).HasValue());
+      }
+      prev_vertex = vertex;
+    }
+    prev = prev_vertex->Gid();
+    MG_ASSERT(!acc->Commit().HasError());
+  }
+}
+
+}  // namespace
+
+///////////////////////////////////////////////////////////////////////////////
+// WAL encoding on commit
+///////////////////////////////////////////////////////////////////////////////
+
+// Arguments: {deltas per transaction, flush the WAL every n transactions}.
+// A flush interval of 1 makes every commit wait for the WAL buffer to be
+// written out, which is the durable but slow configuration.
+class WalCommitFixture : public benchmark::Fixture {
+ protected:
+  void SetUp(const benchmark::State &state) override {
+    if (state.thread_index() == 0) {
+      ClearDirectory();
+      storage = std::make_unique<InMemoryStorage>(
+          MakeConfig(Config::Durability::SnapshotWalMode::PERIODIC_SNAPSHOT_WITH_WAL, state.range(1)));
+      label = storage->NameToLabel("Node");
+      property = storage->NameToProperty("value");
+    }
+  }
+
+  void TearDown(const benchmark::State &state) override {
+    if (state.thread_index() == 0) {
+      storage.reset();
+      ClearDirectory();
+    }
+  }
+
+  std::unique_ptr<InMemoryStorage> storage;
+  memgraph::storage::LabelId label;
+  memgraph::storage::PropertyId property;
+};
+
+BENCHMARK_DEFINE_F(WalCommitFixture, Commit)(benchmark::State &state) {
+  // Every created vertex produces a create, an add label and a set property delta
+  const auto vertices_per_tx = std::max<int64_t>(state.range(0) / 3, 1);
+  std::mt19937 gen(state.thread_index());
+  std::uniform_int_distribution<int64_t> dist;
+  uint64_t deltas = 0;
+  for (auto _ : state) {
+    auto acc = storage->Access();
+    for (int64_t i = 0; i < vertices_per_tx; ++i) {
+      auto vertex = acc->CreateVertex();
+      MG_ASSERT(vertex.AddLabel(label).HasValue());
+      MG_ASSERT(vertex.SetProperty(property, PropertyValue(dist(gen))).HasValue());
+    }
+    MG_ASSERT(!acc->Commit().HasError());
+    deltas += vertices_per_tx * 3;
+  }
+  state.SetItemsProcessed(deltas);
+  state.counters["commits"] = benchmark::Counter(state.iterations(), benchmark::Counter::kIsRate);
+}
+
+BENCHMARK_REGISTER_F(WalCommitFixture, Commit)
+    ->ArgsProduct({{3, 30, 300, 3000}, {1, 100000}})
+    ->ThreadRange(1, kThreadsNum)
+    ->Unit(benchmark::kMicrosecond)
+    ->UseRealTime();
+
+///////////////////////////////////////////////////////////////////////////////
+// Snapshot creation
+///////////////////////////////////////////////////////////////////////////////
+
+// Arguments: {number of vertices}.
+// NOLINTNEXTLINE(google-runtime-references)
+static void CreateSnapshot(benchmark::State &state) {
+  ClearDirectory();
+  auto storage = std::make_unique<InMemoryStorage>(MakeConfig(Config::Durability::SnapshotWalMode::PERIODIC_SNAPSHOT));
+  CreateGraph(storage.get(), state.range(0));
+  for (auto _ : state) {
+    MG_ASSERT(!storage->CreateSnapshot(memgraph::replication_coordination_glue::ReplicationRole::MAIN).HasError());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+  storage.reset();
+  ClearDirectory();
+}
+
+BENCHMARK(CreateSnapshot)->RangeMultiplier(10)->Range(1000, 1000000)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+///////////////////////////////////////////////////////////////////////////////
+// Recovery
+///////////////////////////////////////////////////////////////////////////////
+
+// Recovers the storage created by `prepare` on every iteration. Tearing down
+// the recovered storage isn't measured.
+template <typename TPrepare>
+void Recover(benchmark::State &state, TPrepare &&prepare) {
+  ClearDirectory();
+  prepare();
+  for (auto _ : state) {
+    std::unique_ptr<Storage> storage(std::make_unique<InMemoryStorage>(RecoveryConfig(state.range(1))));
+    state.PauseTiming();
+    MG_ASSERT(storage->GetBaseInfo().vertex_count == static_cast<uint64_t>(state.range(0)), "Recovery lost data");
+    storage.reset();
+    state.ResumeTiming();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+  ClearDirectory();
+}
+
+// Arguments: {number of vertices, recovery threads}.
+// NOLINTNEXTLINE(google-runtime-references)
+static void LoadSnapshot(benchmark::State &state) {
+  Recover(state, [&] {
+    auto storage =
+        std::make_unique<InMemoryStorage>(MakeConfig(Config::Durability::SnapshotWalMode::PERIODIC_SNAPSHOT));
+    CreateGraph(storage.get(), state.range(0));
+    MG_ASSERT(!storage->CreateSnapshot(memgraph::replication_coordination_glue::ReplicationRole::MAIN).HasError());
+  });
+}
+
+BENCHMARK(LoadSnapshot)
+    ->ArgsProduct({{1000, 10000, 100000, 1000000}, {1, 2, 4, kThreadsNum}})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+// Arguments: {number of vertices, recovery threads}.
+// The graph is only in the WAL files, so this measures the WAL replay.
+// NOLINTNEXTLINE(google-runtime-references)
+static void LoadWal(benchmark::State &state) {
+  Recover(state, [&] {
+    auto storage =
+        std::make_unique<InMemoryStorage>(MakeConfig(Config::Durability::SnapshotWalMode::PERIODIC_SNAPSHOT_WITH_WAL));
+    CreateGraph(storage.get(), state.range(0));
+  });
+}
+
+BENCHMARK(LoadWal)
+    ->ArgsProduct({{1000, 10000, 100000, 1000000}, {1, kThreadsNum}})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+int main(int argc, char **argv) {
+  ::benchmark::Initialize(&argc, argv);
+  gflags::AllowCommandLineReparsing();
+  gflags::ParseCommandLineFlags(&argc, &argv, true);
+  ::benchmark::RunSpecifiedBenchmarks();
+  return 0;
+}
@@ -0,0 +1,164 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+// Label index scans, where the vertices the index entries point to are spread
+// over the whole vertices skip list. `IndexScan` compares prefetch distances on
+// a bare index so the effect of prefetching is isolated, `LabelScan` measures
+// the scan through the storage accessor.
+
+#include <algorithm>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "storage/v2/indices/indices_utils.hpp"
+#include "storage/v2/inmemory/label_index.hpp"
+#include "storage/v2/inmemory/storage.hpp"
+#include "storage/v2/vertex.hpp"
+#include "utils/logging.hpp"
+#include "utils/skip_list.hpp"
+
+namespace {
+
+using memgraph::storage::Config;
+using memgraph::storage::Gid;
+using memgraph::storage::InMemoryLabelIndex;
+using memgraph::storage::InMemoryStorage;
+using memgraph::storage::LabelId;
+using memgraph::storage::Storage;
+using memgraph::storage::Vertex;
+using memgraph::storage::View;
+
+// Every `kLabelEvery`-th vertex on average has the scanned label.
+constexpr int64_t kLabelEvery = 8;
+
+// Vertices and a label index over a random subset of them. The entries are
+// inserted in random order, so the index nodes are scattered as well.
+class IndexScanFixture : public benchmark::Fixture {
+ protected:
+  void SetUp(const benchmark::State &state) override {
+    const auto num_vertices = state.range(0);
+    std::vector<int64_t> order(num_vertices);
+    std::iota(order.begin(), order.end(), 0);
+    std::mt19937 gen(42);
+    std::shuffle(order.begin(), order.end(), gen);
+
+    vertices = std::make_unique<memgraph::utils::SkipList<Vertex>>();
+    index = std::make_unique<memgraph::utils::SkipList<InMemoryLabelIndex::Entry>>();
+    auto vertices_acc = vertices->access();
+    for (const auto i : order) vertices_acc.insert(Vertex{Gid::FromInt(i), nullptr});
+
+    std::vector<Vertex *> labeled;
+    for (auto &vertex : vertices_acc) {
+      if (gen() % kLabelEvery != 0) continue;
+      vertex.labels.push_back(label);
+      labeled.push_back(&vertex);
+    }
+    std::shuffle(labeled.begin(), labeled.end(), gen);
+    auto index_acc = index->access();
+    for (auto *vertex : labeled) index_acc.insert(InMemoryLabelIndex::Entry{vertex, 0});
+  }
+
+  void TearDown(const benchmark::State & /*state*/) override {
+    index.reset();
+    vertices.reset();
+  }
+
+  // What the label index iterator checks for every entry before the deltas
+  template <uint64_t kDistance>
+  void Scan(benchmark::State &state) {
+    using Iterator = memgraph::utils::SkipList<InMemoryLabelIndex::Entry>::Iterator;
+    auto index_acc = index->access();
+    uint64_t found = 0;
+    for (auto _ : state) {
+      memgraph::storage::IndexedVertexPrefetcher<Iterator, kDistance> prefetcher;
+      found = 0;
+      for (auto it = index_acc.begin(); it != index_acc.end(); ++it) {
+        prefetcher.Step(it, index_acc.end());
+        const auto *vertex = it->vertex;
+        if (vertex->deleted || vertex->delta != nullptr) continue;
+        if (std::find(vertex->labels.begin(), vertex->labels.end(), label) != vertex->labels.end()) ++found;
+      }
+      benchmark::DoNotOptimize(found);
+    }
+    state.SetItemsProcessed(state.iterations() * found);
+  }
+
+  LabelId label{LabelId::FromUint(1)};
+  std::unique_ptr<memgraph::utils::SkipList<Vertex>> vertices;
+  std::unique_ptr<memgraph::utils::SkipList<InMemoryLabelIndex::Entry>> index;
+};
+
+}  // namespace
+
+// Arguments: {number of vertices}.
+BENCHMARK_DEFINE_F(IndexScanFixture, NoPrefetch)(benchmark::State &state) { Scan<0>(state); }
+BENCHMARK_DEFINE_F(IndexScanFixture, PrefetchNext)(benchmark::State &state) { Scan<1>(state); }
+BENCHMARK_DEFINE_F(IndexScanFixture, PrefetchDefault)(benchmark::State &state) {
+  Scan<memgraph::storage::kIndexPrefetchDistance>(state);
+}
+BENCHMARK_DEFINE_F(IndexScanFixture, PrefetchFar)(benchmark::State &state) { Scan<32>(state); }
+
+BENCHMARK_REGISTER_F(IndexScanFixture, NoPrefetch)
+    ->RangeMultiplier(10)
+    ->Range(10000, 10000000)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(IndexScanFixture, PrefetchNext)
+    ->RangeMultiplier(10)
+    ->Range(10000, 10000000)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(IndexScanFixture, PrefetchDefault)
+    ->RangeMultiplier(10)
+    ->Range(10000, 10000000)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(IndexScanFixture, PrefetchFar)
+    ->RangeMultiplier(10)
+    ->Range(10000, 10000000)
+    ->Unit(benchmark::kMillisecond);
+
+// Arguments: {number of vertices}.
+// NOLINTNEXTLINE(google-runtime-references)
+static void LabelScan(benchmark::State &state) {
+  std::unique_ptr<Storage> storage(std::make_unique<InMemoryStorage>(Config{.gc = {.type = Config::Gc::Type::NONE}}));
+  const auto label = storage->NameToLabel("Label");
+  std::mt19937 gen(42);
+  for (int64_t begin = 0; begin < state.range(0); begin += 10000) {
+    auto acc = storage->Access();
+    for (int64_t i = begin; i < std::min(begin + 10000, state.range(0)); ++i) {
+      auto vertex = acc->CreateVertex();
+      if (gen() % kLabelEvery == 0) MG_ASSERT(vertex.AddLabel(label).HasValue());
+    }
+    MG_ASSERT(!acc->Commit().HasError());
+  }
+  {
+    auto acc = storage->UniqueAccess();
+    MG_ASSERT(!acc->CreateIndex(label).HasError());
+    MG_ASSERT(!acc->Commit().HasError());
+  }
+
+  uint64_t found = 0;
+  for (auto _ : state) {
+    auto acc = storage->Access();
+    found = 0;
+    for (const auto &vertex : acc->Vertices(label, View::OLD)) {
+      benchmark::DoNotOptimize(vertex);
+      ++found;
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * found);
+}
+
+BENCHMARK(LabelScan)->RangeMultiplier(10)->Range(10000, 10000000)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
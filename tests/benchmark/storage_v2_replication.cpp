@@ -0,0 +1,201 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+// Commit latency on MAIN and replication lag with a REPLICA running in the
+// same process over loopback.
+//
+// For regression tracking run with `--benchmark_format=json` or
+// `--benchmark_out=<file> --benchmark_out_format=json`.
+
+#include <chrono>
+#include <filesystem>
+#include <memory>
+#include <optional>
+#include <thread>
+
+#include <benchmark/benchmark.h>
+#include <gflags/gflags.h>
+
+#include "auth/auth.hpp"
+#include "dbms/database.hpp"
+#include "dbms/dbms_handler.hpp"
+#include "replication/config.hpp"
+#include "replication/state.hpp"
+#include "replication_handler/replication_handler.hpp"
+#include "storage/v2/config.hpp"
+#include "storage/v2/property_value.hpp"
+#include "storage/v2/replication/enums.hpp"
+#include "utils/logging.hpp"
+#include "utils/timer.hpp"
+
+DEFINE_string(replication_directory, "", "Directory used for the benchmark data; a temporary one is used if empty");
+DEFINE_uint32(replica_port, 10000, "Port of the REPLICA replication server");
+
+namespace {
+
+using memgraph::io::network::Endpoint;
+using memgraph::replication::ReplicationClientConfig;
+using memgraph::replication::ReplicationHandler;
+using memgraph::replication::ReplicationServerConfig;
+using memgraph::replication_coordination_glue::ReplicationMode;
+using memgraph::storage::Config;
+using memgraph::storage::PropertyValue;
+
+const int kThreadsNum = 8;
+constexpr auto kReplicaName = "REPLICA";
+
+std::filesystem::path RootDirectory() {
+  if (!FLAGS_replication_directory.empty()) return FLAGS_replication_directory;
+  return std::filesystem::temp_directory_path() / "MG_benchmark_storage_v2_replication";
+}
+
+Config MakeConfig(const std::filesystem::path &directory) {
+  Config config{
+      .durability =
+          {
+              .snapshot_wal_mode = Config::Durability::SnapshotWalMode::PERIODIC_SNAPSHOT_WITH_WAL,
+              .snapshot_interval = std::chrono::hours(24),
+          },
+      .salient.items = {.properties_on_edges = true},
+  };
+  UpdatePaths(config, directory);
+  return config;
+}
+
+// The smallest set of components that can act as MAIN or REPLICA.
+struct MinMemgraph {
+  explicit MinMemgraph(const Config &conf)
+      : auth{conf.durability.storage_directory / "auth", memgraph::auth::Auth::Config{/* default */}},
+        repl_state{ReplicationStateRootPath(conf)},
+        dbms{conf, repl_state
+#ifdef MG_ENTERPRISE
+             ,
+             auth, true
+#endif
+        },
+        db_acc{dbms.Get()},
+        db{*db_acc.get()},
+        repl_handler(repl_state, dbms
+#ifdef MG_ENTERPRISE
+                     ,
+                     system_, auth
+#endif
+        ) {
+  }
+
+  uint64_t LastDurableTimestamp() const { return db.storage()->repl_storage_state_.last_durable_timestamp_.load(); }
+
+  memgraph::auth::SynchedAuth auth;
+  memgraph::system::System system_;
+  memgraph::replication::ReplicationState repl_state;
+  memgraph::dbms::DbmsHandler dbms;
+  memgraph::dbms::DatabaseAccess db_acc;
+  memgraph::dbms::Database &db;
+  ReplicationHandler repl_handler;
+};
+
+}  // namespace
+
+///////////////////////////////////////////////////////////////////////////////
+// MAIN -> REPLICA commit latency and lag
+///////////////////////////////////////////////////////////////////////////////
+
+// Arguments: {replication mode (0 = SYNC, 1 = ASYNC), vertices per transaction}.
+// The iteration time is the commit latency seen by the client on MAIN. The
+// `catch_up_ms` counter is the time the REPLICA needed after the last commit
+// on MAIN to apply all of the deltas. `main_commits` is the rate at which MAIN
+// committed transactions, and `replica_commits` is the rate at which the REPLICA
+// applied them, from the start of the run until it caught up.
+class ReplicationFixture : public benchmark::Fixture {
+ protected:
+  void SetUp(const benchmark::State &state) override {
+    if (state.thread_index() != 0) return;
+    std::filesystem::remove_all(RootDirectory());
+    main.emplace(MakeConfig(RootDirectory() / "main"));
+    replica.emplace(MakeConfig(RootDirectory() / "replica"));
+
+    const auto endpoint = Endpoint("127.0.0.1", FLAGS_replica_port);
+    MG_ASSERT(replica->repl_handler.TrySetReplicationRoleReplica(ReplicationServerConfig{.repl_server = endpoint},
+                                                                 std::nullopt),
+              "Couldn't start the REPLICA");
+    const auto mode = state.range(0) == 0 ? ReplicationMode::SYNC : ReplicationMode::ASYNC;
+    MG_ASSERT(!main->repl_handler
+                   .TryRegisterReplica(
+                       ReplicationClientConfig{.name = kReplicaName, .mode = mode, .repl_server_endpoint = endpoint})
+                   .HasError(),
+              "Couldn't register the REPLICA");
+  }
+
+  void TearDown(const benchmark::State &state) override {
+    if (state.thread_index() != 0) return;
+    main.reset();
+    replica.reset();
+    std::filesystem::remove_all(RootDirectory());
+  }
+
+  // Waits until the REPLICA applied everything committed on MAIN and returns
+  // how long that took.
+  std::chrono::duration<double, std::milli> WaitForReplica() {
+    memgraph::utils::Timer timer;
+    const auto target = main->LastDurableTimestamp();
+    while (replica->LastDurableTimestamp() < target) {
+      std::this_thread::sleep_for(std::chrono::microseconds(100));
+    }
+    return timer.Elapsed();
+  }
+
+  std::optional<MinMemgraph> main;
+  std::optional<MinMemgraph> replica;
+};
+
+BENCHMARK_DEFINE_F(ReplicationFixture, Commit)(benchmark::State &state) {
+  auto *storage = main->db.storage();
+  const auto label = storage->NameToLabel("Node");
+  const auto property = storage->NameToProperty("value");
+  const auto vertices_per_tx = state.range(1);
+
+  memgraph::utils::Timer run_timer;
+  for (auto _ : state) {
+    auto acc = main->db.Access();
+    for (int64_t i = 0; i < vertices_per_tx; ++i) {
+      auto vertex = acc->CreateVertex();
+      MG_ASSERT(vertex.AddLabel(label).HasValue());
+      MG_ASSERT(vertex.SetProperty(property, PropertyValue(i)).HasValue());
+    }
+    MG_ASSERT(!acc->Commit({}, main->db_acc).HasError());
+  }
+  state.SetItemsProcessed(state.iterations() * vertices_per_tx);
+
+  // The loop exits only after every thread is done, so thread 0 sees all of the commits
+  if (state.thread_index() == 0) {
+    const auto commits = static_cast<double>(state.iterations() * state.threads());
+    const auto main_elapsed = std::chrono::duration<double>(run_timer.Elapsed()).count();
+    const auto catch_up = WaitForReplica();
+    const auto replica_elapsed = std::chrono::duration<double>(run_timer.Elapsed()).count();
+    state.counters["catch_up_ms"] = catch_up.count();
+    state.counters["main_commits"] = benchmark::Counter(commits / main_elapsed);
+    state.counters["replica_commits"] = benchmark::Counter(commits / replica_elapsed);
+  }
+}
+
+BENCHMARK_REGISTER_F(ReplicationFixture, Commit)
+    ->ArgsProduct({{0, 1}, {1, 10, 100, 1000}})
+    ->ThreadRange(1, kThreadsNum)
+    ->Unit(benchmark::kMicrosecond)
+    ->UseRealTime();
+
+int main(int argc, char **argv) {
+  ::benchmark::Initialize(&argc, argv);
+  gflags::AllowCommandLineReparsing();
+  gflags::ParseCommandLineFlags(&argc, &argv, true);
+  ::benchmark::RunSpecifiedBenchmarks();
+  return 0;
+}
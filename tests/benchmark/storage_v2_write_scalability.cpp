@@ -0,0 +1,254 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+// Scalability of the storage write path with the number of writer threads.
+// Every scenario drives `InMemoryStorage` accessors directly and each
+// iteration is one transaction, including its commit. Besides the throughput,
+// each run reports the commit latency percentiles (averaged over the threads)
+// and the rate of transactions that had to be aborted because of a conflict.
+//
+// For throughput curves run with `--benchmark_format=json` and group the
+// results by scenario and thread count.
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "storage/v2/inmemory/storage.hpp"
+#include "storage/v2/property_value.hpp"
+#include "storage/v2/storage.hpp"
+#include "utils/logging.hpp"
+
+namespace {
+
+using memgraph::storage::Gid;
+using memgraph::storage::PropertyValue;
+using memgraph::storage::View;
+
+const int kThreadsNum = 16;
+
+// Commit latencies of a single benchmark thread.
+class LatencyRecorder {
+ public:
+  explicit LatencyRecorder(size_t expected) { latencies_us_.reserve(expected); }
+
+  void Record(std::chrono::steady_clock::duration elapsed) {
+    latencies_us_.push_back(std::chrono::duration<double, std::micro>(elapsed).count());
+  }
+
+  void Report(benchmark::State &state) {
+    if (latencies_us_.empty()) return;
+    std::sort(latencies_us_.begin(), latencies_us_.end());
+    auto percentile = [&](double p) {
+      return latencies_us_[std::min(latencies_us_.size() - 1, static_cast<size_t>(p * latencies_us_.size()))];
+    };
+    state.counters["p50_us"] = benchmark::Counter(percentile(0.5), benchmark::Counter::kAvgThreads);
+    state.counters["p90_us"] = benchmark::Counter(percentile(0.9), benchmark::Counter::kAvgThreads);
+    state.counters["p99_us"] = benchmark::Counter(percentile(0.99), benchmark::Counter::kAvgThreads);
+  }
+
+ private:
+  std::vector<double> latencies_us_;
+};
+
+// Runs `body` as one transaction per iteration and commits it. A body returns
+// false when one of its operations failed, in which case the transaction is
+// aborted and counted as a conflict, same as a failed commit.
+template <typename TBody>
+void RunTransactions(benchmark::State &state, memgraph::storage::Storage *storage, TBody &&body) {
+  LatencyRecorder latencies(std::min<size_t>(state.max_iterations, 1 << 20));
+  uint64_t conflicts = 0;
+  for (auto _ : state) {
+    auto acc = storage->Access();
+    if (!body(acc.get())) {
+      acc->Abort();
+      ++conflicts;
+      continue;
+    }
+    auto start = std::chrono::steady_clock::now();
+    if (acc->Commit().HasError()) {
+      ++conflicts;
+      continue;
+    }
+    latencies.Record(std::chrono::steady_clock::now() - start);
+  }
+  latencies.Report(state);
+  state.SetItemsProcessed(state.iterations() - conflicts);
+  state.counters["conflicts"] = benchmark::Counter(conflicts, benchmark::Counter::kIsRate);
+}
+
+}  // namespace
+
+class WriteScalabilityFixture : public benchmark::Fixture {
+ protected:
+  void SetUp(const benchmark::State &state) override {
+    if (state.thread_index() == 0) {
+      storage = std::make_unique<memgraph::storage::InMemoryStorage>();
+      label = storage->NameToLabel("Label");
+      property = storage->NameToProperty("property");
+      edge_type = storage->NameToEdgeType("EDGE");
+    }
+  }
+
+  void TearDown(const benchmark::State &state) override {
+    if (state.thread_index() == 0) {
+      storage.reset();
+      vertices.clear();
+    }
+  }
+
+  void CreateVertices(int64_t count) {
+    auto acc = storage->Access();
+    for (int64_t i = 0; i < count; ++i) {
+      vertices.push_back(acc->CreateVertex().Gid());
+    }
+    MG_ASSERT(!acc->Commit().HasError());
+  }
+
+  std::unique_ptr<memgraph::storage::Storage> storage;
+  std::vector<Gid> vertices;
+  memgraph::storage::LabelId label;
+  memgraph::storage::PropertyId property;
+  memgraph::storage::EdgeTypeId edge_type;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// Disjoint vertex creation, the baseline without any conflicts
+///////////////////////////////////////////////////////////////////////////////
+
+BENCHMARK_DEFINE_F(WriteScalabilityFixture, CreateVertices)(benchmark::State &state) {
+  RunTransactions(state, storage.get(), [&](auto *acc) {
+    for (int64_t i = 0; i < state.range(0); ++i) {
+      auto vertex = acc->CreateVertex();
+      if (vertex.SetProperty(property, PropertyValue(i)).HasError()) return false;
+    }
+    return true;
+  });
+}
+
+// Arguments: {vertices per transaction}.
+BENCHMARK_REGISTER_F(WriteScalabilityFixture, CreateVertices)
+    ->Arg(1)
+    ->Arg(100)
+    ->ThreadRange(1, kThreadsNum)
+    ->Unit(benchmark::kMicrosecond)
+    ->UseRealTime();
+
+///////////////////////////////////////////////////////////////////////////////
+// Property updates on a set of hot vertices
+///////////////////////////////////////////////////////////////////////////////
+
+BENCHMARK_DEFINE_F(WriteScalabilityFixture, HotVertices)(benchmark::State &state) {
+  if (state.thread_index() == 0) CreateVertices(state.range(0));
+  std::mt19937 gen(state.thread_index());
+  std::uniform_int_distribution<size_t> dist(0, state.range(0) - 1);
+  RunTransactions(state, storage.get(), [&](auto *acc) {
+    auto vertex = acc->FindVertex(vertices[dist(gen)], View::OLD);
+    MG_ASSERT(vertex, "Hot vertex is missing");
+    return vertex->SetProperty(property, PropertyValue(state.thread_index())).HasValue();
+  });
+}
+
+// Arguments: {number of hot vertices}. The fewer hot vertices, the higher the
+// chance that concurrent transactions write to the same one.
+BENCHMARK_REGISTER_F(WriteScalabilityFixture, HotVertices)
+    ->Arg(1)
+    ->Arg(16)
+    ->Arg(1024)
+    ->Arg(1 << 20)
+    ->ThreadRange(1, kThreadsNum)
+    ->Unit(benchmark::kMicrosecond)
+    ->UseRealTime();
+
+///////////////////////////////////////////////////////////////////////////////
+// Edge inserts into a supernode
+///////////////////////////////////////////////////////////////////////////////
+
+BENCHMARK_DEFINE_F(WriteScalabilityFixture, SupernodeEdges)(benchmark::State &state) {
+  if (state.thread_index() == 0) CreateVertices(1);
+  RunTransactions(state, storage.get(), [&](auto *acc) {
+    auto supernode = acc->FindVertex(vertices[0], View::OLD);
+    MG_ASSERT(supernode, "Supernode is missing");
+    for (int64_t i = 0; i < state.range(0); ++i) {
+      auto vertex = acc->CreateVertex();
+      if (acc->CreateEdge(&vertex, &*supernode, edge_type).HasError()) return false;
+    }
+    return true;
+  });
+}
+
+// Arguments: {edges per transaction}.
+BENCHMARK_REGISTER_F(WriteScalabilityFixture, SupernodeEdges)
+    ->Arg(1)
+    ->Arg(100)
+    ->ThreadRange(1, kThreadsNum)
+    ->Unit(benchmark::kMicrosecond)
+    ->UseRealTime();
+
+///////////////////////////////////////////////////////////////////////////////
+// Vertex creation checked against a unique constraint
+///////////////////////////////////////////////////////////////////////////////
+
+BENCHMARK_DEFINE_F(WriteScalabilityFixture, UniqueConstraint)(benchmark::State &state) {
+  if (state.thread_index() == 0) {
+    auto unique_acc = storage->UniqueAccess();
+    MG_ASSERT(unique_acc->CreateUniqueConstraint(label, {property}).HasValue());
+    MG_ASSERT(!unique_acc->Commit().HasError());
+  }
+  std::mt19937_64 gen(state.thread_index());
+  std::uniform_int_distribution<int64_t> dist(0, state.range(0) - 1);
+  RunTransactions(state, storage.get(), [&](auto *acc) {
+    auto vertex = acc->CreateVertex();
+    return vertex.AddLabel(label).HasValue() && vertex.SetProperty(property, PropertyValue(dist(gen))).HasValue();
+  });
+}
+
+// Arguments: {range of the unique values}. Values are drawn at random, so a
+// smaller range makes commits fail the constraint check sooner.
+BENCHMARK_REGISTER_F(WriteScalabilityFixture, UniqueConstraint)
+    ->Arg(1 << 16)
+    ->Arg(1LL << 40)
+    ->ThreadRange(1, kThreadsNum)
+    ->Unit(benchmark::kMicrosecond)
+    ->UseRealTime();
+
+///////////////////////////////////////////////////////////////////////////////
+// Vertex creation maintaining label and label+property indices
+///////////////////////////////////////////////////////////////////////////////
+
+BENCHMARK_DEFINE_F(WriteScalabilityFixture, IndexedVertices)(benchmark::State &state) {
+  if (state.thread_index() == 0) {
+    auto unique_acc = storage->UniqueAccess();
+    MG_ASSERT(!unique_acc->CreateIndex(label).HasError());
+    if (state.range(0) != 0) MG_ASSERT(!unique_acc->CreateIndex(label, property).HasError());
+    MG_ASSERT(!unique_acc->Commit().HasError());
+  }
+  std::mt19937_64 gen(state.thread_index());
+  std::uniform_int_distribution<int64_t> dist;
+  RunTransactions(state, storage.get(), [&](auto *acc) {
+    auto vertex = acc->CreateVertex();
+    return vertex.AddLabel(label).HasValue() && vertex.SetProperty(property, PropertyValue(dist(gen))).HasValue();
+  });
+}
+
+// Arguments: {0 = label index only, 1 = label and label+property index}.
+BENCHMARK_REGISTER_F(WriteScalabilityFixture, IndexedVertices)
+    ->Arg(0)
+    ->Arg(1)
+    ->ThreadRange(1, kThreadsNum)
+    ->Unit(benchmark::kMicrosecond)
+    ->UseRealTime();
+
+BENCHMARK_MAIN();
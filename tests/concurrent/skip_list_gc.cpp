@@ -0,0 +1,71 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "utils/skip_list.hpp"
+
+const int kNumThreads = 8;
+const uint64_t kMaxNum = 100000;
+const uint64_t kNumIterations = 10;
+
+// Removed nodes may only be freed once every accessor that could have seen
+// them is gone, including accessors that were handed over to another thread.
+int main() {
+  memgraph::utils::SkipList<uint64_t> list;
+
+  for (uint64_t iteration = 0; iteration < kNumIterations; ++iteration) {
+    {
+      auto acc = list.access();
+      for (uint64_t num = 0; num < kMaxNum; ++num) {
+        MG_ASSERT(acc.insert(num).second);
+      }
+    }
+
+    // Readers take an accessor on this thread and release it on their own.
+    std::vector<memgraph::utils::SkipList<uint64_t>::Accessor> accessors;
+    for (int i = 0; i < kNumThreads; ++i) {
+      accessors.push_back(list.access());
+    }
+
+    std::atomic<bool> removed{false};
+    std::vector<std::thread> threads;
+    for (int i = 0; i < kNumThreads; ++i) {
+      threads.emplace_back([&list, &removed, acc = std::move(accessors[i])]() mutable {
+        uint64_t last = 0;
+        for (auto it = acc.begin(); it != acc.end(); ++it) {
+          MG_ASSERT(*it < kMaxNum);
+          last = *it;
+          if (removed.load(std::memory_order_acquire)) list.run_gc();
+        }
+        MG_ASSERT(last < kMaxNum);
+      });
+    }
+    threads.emplace_back([&list, &removed] {
+      for (uint64_t num = 0; num < kMaxNum; ++num) {
+        auto acc = list.access();
+        MG_ASSERT(acc.remove(num));
+      }
+      removed.store(true, std::memory_order_release);
+      list.run_gc();
+    });
+    for (auto &thread : threads) {
+      thread.join();
+    }
+
+    MG_ASSERT(list.size() == 0);
+    list.run_gc();
+  }
+
+  return 0;
+}
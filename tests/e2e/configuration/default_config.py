@@ -15,6 +15,12 @@
 
 
 startup_config_dict = {
+    "auth_credential_cache_size": (
+        "0",
+        "0",
+        "Maximum number of successful username/password authentications to remember so that reconnecting clients skip the password hash check. Set to 0 to disable the cache.",
+    ),
+    "auth_credential_cache_ttl_sec": ("600", "600", "Time (in seconds) for which a remembered authentication stays valid."),
     "auth_module_mappings": (
         "",
         "",
@@ -49,6 +55,11 @@ startup_config_dict = {
     "bolt_address": ("0.0.0.0", "0.0.0.0", "IP address on which the Bolt server should listen."),
     "bolt_cert_file": ("", "", "Certificate file which should be used for the Bolt server."),
     "bolt_key_file": ("", "", "Key file which should be used for the Bolt server."),
+    "bolt_ktls": (
+        "false",
+        "false",
+        "Offload the record encryption of secure Bolt connections to the kernel (kTLS) where the kernel and OpenSSL support it. Other connections are encrypted by OpenSSL as before.",
+    ),
     "bolt_num_workers": (
         "12",
         "12",
@@ -65,6 +76,16 @@ startup_config_dict = {
         "1800",
         "Time in seconds after which inactive Bolt sessions will be closed.",
     ),
+    "bolt_spill_memory_limit_kib": (
+        "65536",
+        "65536",
+        "Size of a materialized result kept in memory per session, the rest is written to a temporary file.",
+    ),
+    "bolt_spill_paged_results": (
+        "false",
+        "false",
+        "When a client pages through the result of a read-only query with PULL n, materialize the rest of the result after the first page so the transaction can finish while the client keeps paging.",
+    ),
     "cartesian_product_enabled": ("true", "true", "Enable cartesian product expansion."),
     "management_port": ("0", "0", "Port on which coordinator servers will be started."),
     "coordinator_port": ("0", "0", "Port on which raft servers will be started."),
@@ -129,6 +150,11 @@ startup_config_dict = {
         "false",
         "Controls whether the indices and constraints creation can be done in a multithreaded fashion.",
     ),
+    "storage_durability_scrub_interval_sec": (
+        "0",
+        "0",
+        "Interval (in seconds) in which the checksums of all finished snapshot and WAL files are verified in the background. Corrupt files are reported in the log. Set to 0 to disable.",
+    ),
     "storage_enable_schema_metadata": (
         "false",
         "false",
@@ -182,6 +208,11 @@ startup_config_dict = {
         "Controls whether updating a property with the same value should create a delta object.",
     ),
     "storage_gc_cycle_sec": ("30", "30", "Storage garbage collector interval (in seconds)."),
+    "storage_gc_history_retention_sec": (
+        "0",
+        "0",
+        "How long (in seconds) the garbage collector keeps committed versions readable by AS OF transactions. 0 disables history retention.",
+    ),
     "storage_python_gc_cycle_sec": ("180", "180", "Storage python full garbage collection interval (in seconds)."),
     "storage_items_per_batch": (
         "1000000",
@@ -197,6 +228,11 @@ startup_config_dict = {
     ),
     "storage_snapshot_on_exit": ("false", "false", "Controls whether the storage creates another snapshot on exit."),
     "storage_snapshot_retention_count": ("3", "3", "The number of snapshots that should always be kept."),
+    "storage_synchronized_scans": (
+        "false",
+        "false",
+        "Set to true to start label index scans where a concurrent scan over the same label currently is, so that concurrent scans share the pass over the index instead of making their own.",
+    ),
     "storage_wal_enabled": (
         "false",
         "true",
@@ -213,6 +249,11 @@ startup_config_dict = {
         "Default storage mode Memgraph uses. Allowed values: IN_MEMORY_TRANSACTIONAL, IN_MEMORY_ANALYTICAL, ON_DISK_TRANSACTIONAL",
     ),
     "storage_wal_file_size_kib": ("20480", "20480", "Minimum file size of each WAL file."),
+    "storage_wal_file_recycle_count": (
+        "0",
+        "0",
+        "Number of finished WAL files kept for reuse by new WAL files, which are preallocated to the WAL file size. Reusing allocated files lowers the latency of syncing the WAL. Set to 0 to disable.",
+    ),
     "stream_transaction_conflict_retries": (
         "30",
         "30",
@@ -240,6 +281,16 @@ startup_config_dict = {
         "10",
         "Maximum count of indexed vertices which provoke indexed lookup and then expand to existing, instead of a regular expand. Default is 10, to turn off use -1.",
     ),
+    "query_inline_edge_property_filters": (
+        "false",
+        "false",
+        "Evaluate property filters on expanded relationships inside the Expand operator, before the other node of the relationship is produced, instead of in a separate Filter operator.",
+    ),
+    "query_subquery_cache_size": (
+        "0",
+        "0",
+        "Maximum number of result rows memoized by each read-only CALL subquery and pattern comprehension, so they are computed once for each distinct value of the variables they import. 0 disables memoization.",
+    ),
     "query_max_plans": ("1000", "1000", "Maximum number of generated plans for a query."),
     "flag_file": ("", "", "load flags from file"),
     "hops_limit_partial_results": (
@@ -258,6 +309,11 @@ startup_config_dict = {
         "true",
         "Restore replication state on startup, e.g. recover replica",
     ),
+    "replication_replica_epoch_reads": (
+        "false",
+        "false",
+        "On a REPLICA, apply each batch of replicated transactions exclusively and run implicit (autocommit) read queries against the state between batches without MVCC delta chains or vertex locks. Explicit transactions read through MVCC as usual. Faster analytical reads, but batches wait for the running autocommit queries to finish, so a long-running one stalls replication and SYNC/STRICT_SYNC commits on MAIN can time out.",
+    ),
     "query_callable_mappings_path": (
         "",
         "",
@@ -273,6 +329,22 @@ startup_config_dict = {
         "",
         "Experimental features to be used, comma-separated. Options [text-search, high-availability]",
     ),
+    "text_search_refresh_interval_ms": (
+        "0",
+        "0",
+        "Interval (in milliseconds) in which committed changes are applied to text indices in one batch. With 0 every transaction applies its own changes when it commits.",
+    ),
+    "text_search_wait_for_refresh": (
+        "false",
+        "false",
+        "Apply all committed text index changes before running a text search, so the search sees them.",
+    ),
     "query_log_directory": ("", "", "Path to directory where the query logs should be stored."),
     "schema_info_enabled": ("false", "false", "Set to true to enable run-time schema info tracking."),
+    "lock_contention_profiling": (
+        "false",
+        "false",
+        "Set to true to record acquisitions and contended waits of the engine, GC, database handler, plan cache "
+        "and spin locks. The statistics are available through SHOW LOCK STATISTICS and the metrics endpoint.",
+    ),
 }
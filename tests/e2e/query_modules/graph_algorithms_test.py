@@ -0,0 +1,150 @@
+# Copyright 2024 Memgraph Ltd.
+#
+# Use of this software is governed by the Business Source License
+# included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+# License, and you may not use this file except in compliance with the Business Source License.
+#
+# As of the Change Date specified in that file, in accordance with
+# the Business Source License, use of this software will be governed
+# by the Apache License, Version 2.0, included in the file
+# licenses/APL.txt.
+
+import sys
+
+import pytest
+from common import connect, execute_and_fetch_all
+
+
+@pytest.fixture
+def two_triangles():
+    # Two directed triangles joined by (2)->(3) and an isolated node (6).
+    cursor = connect().cursor()
+    execute_and_fetch_all(cursor, "UNWIND range(0, 6) AS id CREATE (:Node {id: id});")
+    for source, target in [(0, 1), (1, 2), (2, 0), (2, 3), (3, 4), (4, 5), (5, 3)]:
+        execute_and_fetch_all(
+            cursor,
+            "MATCH (a:Node {id: $source}), (b:Node {id: $target}) CREATE (a)-[:EDGE]->(b);",
+            {"source": source, "target": target},
+        )
+    return cursor
+
+
+def fetch_by_id(cursor, query):
+    return dict(execute_and_fetch_all(cursor, query))
+
+
+def test_weakly_connected_components(two_triangles):
+    components = fetch_by_id(
+        two_triangles,
+        "CALL graph_algorithms.weakly_connected_components() YIELD node, component_id RETURN node.id, component_id;",
+    )
+    assert len({components[id] for id in range(6)}) == 1
+    assert components[6] != components[0]
+
+
+def test_strongly_connected_components(two_triangles):
+    components = fetch_by_id(
+        two_triangles,
+        "CALL graph_algorithms.strongly_connected_components() YIELD node, component_id RETURN node.id, component_id;",
+    )
+    assert components[0] == components[1] == components[2]
+    assert components[3] == components[4] == components[5]
+    assert len({components[0], components[3], components[6]}) == 3
+
+
+def test_pagerank(two_triangles):
+    ranks = fetch_by_id(two_triangles, "CALL graph_algorithms.pagerank() YIELD node, rank RETURN node.id, rank;")
+    assert sum(ranks.values()) == pytest.approx(1.0)
+    assert min(ranks[3], ranks[4], ranks[5]) > max(ranks[0], ranks[1], ranks[2])
+    assert ranks[6] == min(ranks.values())
+
+
+def test_betweenness_centrality(two_triangles):
+    centrality = fetch_by_id(
+        two_triangles,
+        "CALL graph_algorithms.betweenness_centrality(true, false) YIELD node, betweenness_centrality "
+        "RETURN node.id, betweenness_centrality;",
+    )
+    assert centrality == pytest.approx({0: 1, 1: 4, 2: 7, 3: 7, 4: 4, 5: 1, 6: 0})
+
+
+def test_k_core(two_triangles):
+    cores = fetch_by_id(two_triangles, "CALL graph_algorithms.k_core(2) YIELD node, core RETURN node.id, core;")
+    assert cores == {id: 2 for id in range(6)}
+
+
+def test_triangle_count(two_triangles):
+    triangles = fetch_by_id(
+        two_triangles, "CALL graph_algorithms.triangle_count() YIELD node, triangles RETURN node.id, triangles;"
+    )
+    assert triangles == {0: 1, 1: 1, 2: 1, 3: 1, 4: 1, 5: 1, 6: 0}
+
+
+def test_label_propagation(two_triangles):
+    communities = fetch_by_id(
+        two_triangles,
+        "CALL graph_algorithms.label_propagation() YIELD node, community_id RETURN node.id, community_id;",
+    )
+    assert communities[0] == communities[1] == communities[2]
+    assert communities[3] == communities[4] == communities[5]
+    assert communities[6] != communities[0]
+
+
+@pytest.fixture
+def weighted_line():
+    # A directed line 0->1->2->3->4 with unit weights, a shortcut (0)->(2) and an expensive (0)->(4).
+    cursor = connect().cursor()
+    execute_and_fetch_all(cursor, "UNWIND range(0, 4) AS id CREATE (:Node {id: id});")
+    for source, target, weight in [(0, 1, 1), (1, 2, 1), (2, 3, 1), (3, 4, 1), (0, 2, 1.5), (0, 4, 10)]:
+        execute_and_fetch_all(
+            cursor,
+            "MATCH (a:Node {id: $source}), (b:Node {id: $target}) CREATE (a)-[:ROAD {weight: $weight}]->(b);",
+            {"source": source, "target": target, "weight": weight},
+        )
+    return cursor
+
+
+def shortest_path(cursor, source, target, directed=True, bidirectional=False):
+    return execute_and_fetch_all(
+        cursor,
+        "MATCH (s:Node {id: $source}), (t:Node {id: $target}) "
+        "CALL graph_algorithms.weighted_shortest_path(s, t, 'ROAD', 'weight', $directed, $bidirectional) "
+        "YIELD path, total_weight RETURN [n IN nodes(path) | n.id], total_weight;",
+        {"source": source, "target": target, "directed": directed, "bidirectional": bidirectional},
+    )
+
+
+@pytest.mark.parametrize("bidirectional", [False, True])
+def test_weighted_shortest_path(weighted_line, bidirectional):
+    expected = [([0, 2, 3, 4], 3.5)]
+    assert shortest_path(weighted_line, 0, 4, bidirectional=bidirectional) == expected
+    assert execute_and_fetch_all(
+        weighted_line, "CALL graph_algorithms.build_landmarks('ROAD', 'weight', 2) YIELD landmarks, nodes RETURN *;"
+    ) == [(2, 5)]
+    assert shortest_path(weighted_line, 0, 4, bidirectional=bidirectional) == expected
+    assert shortest_path(weighted_line, 4, 0, bidirectional=bidirectional) == []
+    assert shortest_path(weighted_line, 4, 0, directed=False, bidirectional=bidirectional) == [([4, 3, 2, 0], 3.5)]
+
+
+def test_weighted_shortest_path_stale_landmarks(weighted_line):
+    execute_and_fetch_all(weighted_line, "CALL graph_algorithms.build_landmarks('ROAD') YIELD * RETURN *;")
+    execute_and_fetch_all(
+        weighted_line, "MATCH (a:Node {id: 1}), (b:Node {id: 4}) CREATE (a)-[:ROAD {weight: 0.5}]->(b);"
+    )
+    assert shortest_path(weighted_line, 0, 4) == [([0, 1, 4], 1.5)]
+    assert shortest_path(weighted_line, 0, 4, bidirectional=True) == [([0, 1, 4], 1.5)]
+
+
+def test_weighted_shortest_path_negative_weight(weighted_line):
+    execute_and_fetch_all(weighted_line, "MATCH ()-[r:ROAD]->() SET r.weight = -1;")
+    with pytest.raises(Exception):
+        shortest_path(weighted_line, 0, 4)
+
+
+def test_empty_graph():
+    cursor = connect().cursor()
+    assert execute_and_fetch_all(cursor, "CALL graph_algorithms.pagerank() YIELD * RETURN *;") == []
+
+
+if __name__ == "__main__":
+    sys.exit(pytest.main([__file__, "-rA"]))
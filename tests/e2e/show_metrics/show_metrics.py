@@ -24,6 +24,9 @@ def test_all_show_metrics_info_values_are_present(memgraph):
         {"name": "ActiveLabelPropertyIndices", "type": "Index", "metric type": "Counter"},
         {"name": "ActivePointIndices", "type": "Index", "metric type": "Counter"},
         {"name": "ActiveTextIndices", "type": "Index", "metric type": "Counter"},
+        {"name": "TextIndexRefreshLag_us_50p", "type": "Index", "metric type": "Histogram"},
+        {"name": "TextIndexRefreshLag_us_90p", "type": "Index", "metric type": "Histogram"},
+        {"name": "TextIndexRefreshLag_us_99p", "type": "Index", "metric type": "Histogram"},
         {"name": "UnreleasedDeltaObjects", "type": "Memory", "metric type": "Counter"},
         {"name": "DiskUsage", "type": "Memory", "metric type": "Gauge"},
         {"name": "MemoryRes", "type": "Memory", "metric type": "Gauge"},
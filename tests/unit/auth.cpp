@@ -17,12 +17,15 @@
 #include <gtest/gtest.h>
 
 #include "auth/auth.hpp"
+#include "auth/credential_cache.hpp"
 #include "auth/crypto.hpp"
 #include "auth/models.hpp"
+#include "flags/auth.hpp"
 #include "glue/auth_global.hpp"
 #include "license/license.hpp"
 #include "utils/cast.hpp"
 #include "utils/file.hpp"
+#include "utils/on_scope_exit.hpp"
 
 using namespace memgraph::auth;
 namespace fs = std::filesystem;
@@ -50,6 +53,85 @@ TEST_F(AuthWithStorage, AddRole) {
   ASSERT_FALSE(auth->AddRole("admin"));
 }
 
+TEST_F(AuthWithStorage, PublishedState) {
+  const auto *state = auth->GetPublishedState();
+  ASSERT_FALSE(state->AccessControlled());
+  const auto start_epoch = state->GetEpoch();
+
+  ASSERT_TRUE(auth->AddUser("test"));
+  ASSERT_TRUE(state->AccessControlled());
+  const auto user_epoch = state->GetEpoch();
+  ASSERT_FALSE(user_epoch == start_epoch);
+
+  // The published epoch is the one used by UpToDate
+  auto epoch = user_epoch;
+  ASSERT_TRUE(auth->UpToDate(epoch));
+
+  ASSERT_TRUE(auth->RemoveUser("test"));
+  ASSERT_FALSE(state->AccessControlled());
+  ASSERT_FALSE(state->GetEpoch() == user_epoch);
+  ASSERT_FALSE(auth->UpToDate(epoch));
+}
+
+TEST_F(AuthWithStorage, AuthenticateWithCredentialCache) {
+  FLAGS_auth_credential_cache_size = 16;
+  memgraph::utils::OnScopeExit reset_cache_size([] { FLAGS_auth_credential_cache_size = 0; });
+  auth.emplace(test_folder_ / ("unit_auth_cache_test_" + std::to_string(static_cast<int>(getpid()))), auth_config);
+
+  auto user = auth->AddUser("test", "123");
+  ASSERT_NE(user, std::nullopt);
+  ASSERT_NE(auth->Authenticate("test", "123"), std::nullopt);
+  // Remembered credentials authenticate again, wrong ones still fail
+  ASSERT_NE(auth->Authenticate("test", "123"), std::nullopt);
+  ASSERT_EQ(auth->Authenticate("test", "1234"), std::nullopt);
+  ASSERT_EQ(auth->Authenticate("test1", "23"), std::nullopt);
+
+  // Changing the password invalidates the remembered credentials
+  user->UpdatePassword("456");
+  auth->SaveUser(*user);
+  ASSERT_EQ(auth->Authenticate("test", "123"), std::nullopt);
+  ASSERT_NE(auth->Authenticate("test", "456"), std::nullopt);
+
+  ASSERT_TRUE(auth->RemoveUser("test"));
+  ASSERT_EQ(auth->Authenticate("test", "456"), std::nullopt);
+}
+
+TEST(CredentialCache, FindAndInsert) {
+  CredentialCache cache(2, std::chrono::seconds(600));
+  const User user("test");
+  ASSERT_EQ(cache.Find("test", "123"), std::nullopt);
+
+  cache.Insert("test", "123", user);
+  auto found = cache.Find("test", "123");
+  ASSERT_NE(found, std::nullopt);
+  ASSERT_EQ(found->username(), "test");
+  ASSERT_EQ(cache.Find("test", "1234"), std::nullopt);
+  ASSERT_EQ(cache.Find("test1", "23"), std::nullopt);
+
+  // An entry is evicted once the cache is full
+  cache.Insert("test2", "123", User("test2"));
+  cache.Insert("test3", "123", User("test3"));
+  ASSERT_EQ(cache.Size(), 2);
+  ASSERT_NE(cache.Find("test3", "123"), std::nullopt);
+
+  cache.Clear();
+  ASSERT_EQ(cache.Find("test3", "123"), std::nullopt);
+}
+
+TEST(CredentialCache, Expiry) {
+  CredentialCache cache(2, std::chrono::seconds(0));
+  cache.Insert("test", "123", User("test"));
+  ASSERT_EQ(cache.Find("test", "123"), std::nullopt);
+  ASSERT_EQ(cache.Size(), 0);
+}
+
+TEST(CredentialCache, Disabled) {
+  CredentialCache cache(0, std::chrono::seconds(600));
+  cache.Insert("test", "123", User("test"));
+  ASSERT_EQ(cache.Size(), 0);
+  ASSERT_EQ(cache.Find("test", "123"), std::nullopt);
+}
+
 TEST_F(AuthWithStorage, RemoveRole) {
   ASSERT_TRUE(auth->AddRole("admin"));
   ASSERT_TRUE(auth->RemoveRole("admin"));
@@ -1,4 +1,4 @@
-// Copyright 2023 Memgraph Ltd.
+// Copyright 2024 Memgraph Ltd.
 //
 // Use of this software is governed by the Business Source License
 // included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
@@ -109,3 +109,51 @@ TEST_F(BoltChunkedEncoderBuffer, OneAndAHalfOfMaxChunk) {
   VerifyChunkOfTestData(output, kChunkMaxDataSize);
   VerifyChunkOfTestData(output + kChunkWholeSize, kTestDataSize - kChunkMaxDataSize, kChunkMaxDataSize);
 }
+
+TEST_F(BoltChunkedEncoderBuffer, CoalesceMessages) {
+  int size = 100;
+  int messages = 10;
+
+  // initialize tested buffer
+  TestOutputStream output_stream;
+  BufferT buffer(output_stream);
+
+  // write small messages while announcing that more data follows
+  for (auto i = 0; i < messages; ++i) {
+    buffer.Write(test_data + i * size, size);
+    ASSERT_TRUE(buffer.Flush(true));
+    ASSERT_TRUE(buffer.Flush(true));
+  }
+  ASSERT_EQ(output_stream.writes, 0U);
+
+  // the final flush sends all of them at once
+  ASSERT_TRUE(buffer.Flush());
+  ASSERT_EQ(output_stream.writes, 1U);
+
+  // the output array should look like this:
+  // [0, 100, 100 bytes of test data, 0, 0] * 10 + [0, 0]
+  auto *data = output_stream.output.data();
+  for (auto i = 0; i < messages; ++i) {
+    VerifyChunkOfTestData(data, size, i * size);
+    data += kChunkHeaderSize + size;
+    ASSERT_EQ(data[0], 0);
+    ASSERT_EQ(data[1], 0);
+    data += kChunkHeaderSize;
+  }
+  ASSERT_EQ(output_stream.output.size(), messages * (2 * kChunkHeaderSize + size) + kChunkHeaderSize);
+}
+
+TEST_F(BoltChunkedEncoderBuffer, SendWhenFull) {
+  // initialize tested buffer
+  TestOutputStream output_stream;
+  BufferT buffer(output_stream);
+
+  // two whole chunks can't be held back together with the next one
+  buffer.Write(test_data, kTestDataSize);
+  ASSERT_EQ(output_stream.writes, 0U);
+  buffer.Write(test_data, kTestDataSize);
+  ASSERT_EQ(output_stream.writes, 1U);
+  buffer.Flush();
+  ASSERT_EQ(output_stream.writes, 2U);
+  ASSERT_EQ(output_stream.output.size(), 2 * kTestDataSize + 4 * kChunkHeaderSize);
+}
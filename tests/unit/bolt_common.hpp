@@ -57,6 +57,7 @@ class TestOutputStream {
  public:
   bool Write(const uint8_t *data, size_t len, bool have_more = false) {
     if (!write_success_) return false;
+    ++writes;
     for (size_t i = 0; i < len; ++i) output.push_back(data[i]);
     return true;
   }
@@ -64,6 +65,7 @@ class TestOutputStream {
   void SetWriteSuccess(bool success) { write_success_ = success; }
 
   std::vector<uint8_t> output;
+  size_t writes{0};
 
  protected:
   bool write_success_{true};
@@ -17,6 +17,7 @@
 #include "bolt_testdata.hpp"
 #include "communication/bolt/v1/codes.hpp"
 #include "communication/bolt/v1/encoder/encoder.hpp"
+#include "communication/bolt/v1/encoder/spill_buffer.hpp"
 #include "disk_test_utils.hpp"
 #include "glue/communication.hpp"
 #include "storage/v2/disk/storage.hpp"
@@ -677,3 +678,51 @@ TEST_F(BoltEncoder, Point3d) {
   std::invoke(run_test, value_wgs);
   std::invoke(run_test, value_cartesian);
 }
+
+TEST_F(BoltEncoder, SpilledRecord) {
+  memgraph::communication::bolt::SpillBuffer spill(1024);
+  memgraph::communication::bolt::BaseEncoder<memgraph::communication::bolt::SpillBuffer> spill_encoder(spill);
+  std::vector<Value> vals;
+  for (int i = 1; i < 4; ++i) vals.push_back(Value(i));
+  spill_encoder.WriteList(vals);
+  spill.EndRecord();
+
+  auto record = spill.NextRecord();
+  ASSERT_TRUE(record);
+  ASSERT_TRUE(bolt_encoder.MessageRecordEncoded(*record));
+  CheckOutput(output, (const uint8_t *)"\xB1\x71\x93\x01\x02\x03", 6);
+  ASSERT_FALSE(spill.NextRecord());
+}
+
+TEST_F(BoltEncoder, SpillBufferOverflowsToFile) {
+  // Room for a few records only, the rest goes to the temporary file
+  memgraph::communication::bolt::SpillBuffer spill(64);
+  memgraph::communication::bolt::BaseEncoder<memgraph::communication::bolt::SpillBuffer> spill_encoder(spill);
+  const int kRecords = 100;
+  for (int i = 0; i < kRecords; ++i) {
+    spill_encoder.WriteList({Value(i), Value(std::string(i, 'a'))});
+    spill.EndRecord();
+  }
+  ASSERT_EQ(spill.Size(), kRecords);
+  ASSERT_GT(spill.SpilledBytes(), 0U);
+
+  for (int i = 0; i < kRecords; ++i) {
+    ASSERT_TRUE(spill.HasMore());
+    auto record = spill.NextRecord();
+    ASSERT_TRUE(record);
+    bolt_encoder.MessageRecordEncoded(*record);
+    CheckOutput(output, (const uint8_t *)"\xB1\x71\x92", 3, false);
+    std::vector<uint8_t> expected;
+    {
+      TestOutputStream expected_stream;
+      TestBuffer expected_buffer(expected_stream);
+      memgraph::communication::bolt::BaseEncoder<TestBuffer> expected_encoder(expected_buffer);
+      expected_encoder.WriteInt(i);
+      expected_encoder.WriteString(std::string(i, 'a'));
+      expected = expected_stream.output;
+    }
+    CheckOutput(output, expected.data(), expected.size());
+  }
+  ASSERT_FALSE(spill.HasMore());
+  ASSERT_FALSE(spill.NextRecord());
+}
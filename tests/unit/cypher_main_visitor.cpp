@@ -884,6 +884,28 @@ TEST_P(CypherMainVisitorTest, Aggregation) {
   ASSERT_FALSE(aggregation->expression1_);
 }
 
+TEST_P(CypherMainVisitorTest, ApproxCountDistinct) {
+  auto &ast_generator = *GetParam();
+  auto *query = dynamic_cast<CypherQuery *>(
+      ast_generator.ParseQuery("RETURN approx_count_distinct(a), APPROX_COUNT_DISTINCT(DISTINCT b)"));
+  ASSERT_TRUE(query);
+  ASSERT_TRUE(query->single_query_);
+  auto *single_query = query->single_query_;
+  auto *return_clause = dynamic_cast<Return *>(single_query->clauses_[0]);
+  ASSERT_EQ(return_clause->body_.named_expressions.size(), 2U);
+  std::string ids[] = {"a", "b"};
+  bool distinct[] = {false, true};
+  for (int i = 0; i < 2; ++i) {
+    auto *aggregation = dynamic_cast<Aggregation *>(return_clause->body_.named_expressions[i]->expression_);
+    ASSERT_TRUE(aggregation);
+    ASSERT_EQ(aggregation->op_, Aggregation::Op::APPROX_COUNT_DISTINCT);
+    ASSERT_EQ(aggregation->distinct_, distinct[i]);
+    auto *identifier = dynamic_cast<Identifier *>(aggregation->expression1_);
+    ASSERT_TRUE(identifier);
+    ASSERT_EQ(identifier->name_, ids[i]);
+  }
+}
+
 TEST_P(CypherMainVisitorTest, UndefinedFunction) {
   auto &ast_generator = *GetParam();
   ASSERT_THROW(ast_generator.ParseQuery("RETURN "
@@ -2811,6 +2833,13 @@ TEST_P(CypherMainVisitorTest, TestShowStorageInfo) {
   EXPECT_EQ(query->info_type_, SystemInfoQuery::InfoType::STORAGE);
 }
 
+TEST_P(CypherMainVisitorTest, TestShowLockStatistics) {
+  auto &ast_generator = *GetParam();
+  auto *query = dynamic_cast<SystemInfoQuery *>(ast_generator.ParseQuery("SHOW LOCK STATISTICS"));
+  ASSERT_TRUE(query);
+  EXPECT_EQ(query->info_type_, SystemInfoQuery::InfoType::LOCK_STATISTICS);
+}
+
 TEST_P(CypherMainVisitorTest, TestShowIndexInfo) {
   auto &ast_generator = *GetParam();
   auto *query = dynamic_cast<DatabaseInfoQuery *>(ast_generator.ParseQuery("SHOW INDEX INFO"));
@@ -5079,6 +5108,68 @@ TEST_P(CypherMainVisitorTest, TopLevelPeriodicCommitQuery) {
   }
 }
 
+TEST_P(CypherMainVisitorTest, SampleQuery) {
+  auto &ast_generator = *GetParam();
+  {
+    const auto *query =
+        dynamic_cast<CypherQuery *>(ast_generator.ParseQuery("USING SAMPLE 10 PERCENT MATCH (n) RETURN count(n);"));
+    ASSERT_NE(query, nullptr);
+    ASSERT_TRUE(query->pre_query_directives_.sample_percentage_);
+
+    ast_generator.CheckLiteral(query->pre_query_directives_.sample_percentage_, 10);
+  }
+
+  {
+    const auto *query = dynamic_cast<CypherQuery *>(
+        ast_generator.ParseQuery("USING SAMPLE 2.5 %, HOPS LIMIT 10 MATCH (n) RETURN count(n);"));
+    ASSERT_NE(query, nullptr);
+    ASSERT_TRUE(query->pre_query_directives_.sample_percentage_);
+    ASSERT_TRUE(query->pre_query_directives_.hops_limit_);
+
+    ast_generator.CheckLiteral(query->pre_query_directives_.sample_percentage_, 2.5);
+  }
+
+  { ASSERT_THROW(ast_generator.ParseQuery("USING SAMPLE 'a' PERCENT MATCH (n) RETURN n;"), SyntaxException); }
+
+  {
+    ASSERT_THROW(ast_generator.ParseQuery("USING SAMPLE 10 PERCENT, SAMPLE 20 PERCENT MATCH (n) RETURN n;"),
+                 SyntaxException);
+  }
+}
+
+TEST_P(CypherMainVisitorTest, AsOfQuery) {
+  auto &ast_generator = *GetParam();
+  {
+    const auto *query = dynamic_cast<CypherQuery *>(
+        ast_generator.ParseQuery("USING AS OF 1714557600000000 MATCH (n) RETURN count(n);"));
+    ASSERT_NE(query, nullptr);
+    ASSERT_TRUE(query->pre_query_directives_.as_of_);
+
+    ast_generator.CheckLiteral(query->pre_query_directives_.as_of_, 1714557600000000);
+  }
+
+  {
+    const auto *query = dynamic_cast<CypherQuery *>(
+        ast_generator.ParseQuery("USING AS OF '2024-05-01T10:00:00', HOPS LIMIT 10 MATCH (n) RETURN count(n);"));
+    ASSERT_NE(query, nullptr);
+    ASSERT_TRUE(query->pre_query_directives_.as_of_);
+    ASSERT_TRUE(query->pre_query_directives_.hops_limit_);
+
+    ast_generator.CheckLiteral(query->pre_query_directives_.as_of_, "2024-05-01T10:00:00");
+  }
+
+  {
+    const auto *query =
+        dynamic_cast<CypherQuery *>(ast_generator.ParseQuery("USING AS OF $time MATCH (n) RETURN count(n);"));
+    ASSERT_NE(query, nullptr);
+    ASSERT_NE(dynamic_cast<ParameterLookup *>(query->pre_query_directives_.as_of_), nullptr);
+  }
+
+  { ASSERT_THROW(ast_generator.ParseQuery("USING AS OF 2.5 MATCH (n) RETURN n;"), SyntaxException); }
+
+  { ASSERT_THROW(ast_generator.ParseQuery("USING AS OF 1, AS OF 2 MATCH (n) RETURN n;"), SyntaxException); }
+}
+
 TEST_P(CypherMainVisitorTest, NestedPeriodicCommitQuery) {
   auto &ast_generator = *GetParam();
   {
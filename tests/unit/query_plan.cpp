@@ -34,6 +34,7 @@
 
 #include "query_common.hpp"
 #include "utils/bound.hpp"
+#include "utils/on_scope_exit.hpp"
 
 namespace memgraph::query {
 ::std::ostream &operator<<(::std::ostream &os, const Symbol &sym) {
@@ -1912,6 +1913,20 @@ TYPED_TEST(TestPlanner, MatchWhereAndSplit) {
                        ExpectProduce());
 }
 
+TYPED_TEST(TestPlanner, MatchWhereInlineEdgePropertyFilter) {
+  // Test MATCH (n) -[r]- (m) WHERE n.prop AND r.prop < 42 RETURN m
+  FakeDbAccessor dba;
+  auto prop = PROPERTY_PAIR(dba, "prop");
+  auto *query = QUERY(
+      SINGLE_QUERY(MATCH(PATTERN(NODE("n"), EDGE("r"), NODE("m"))),
+                   WHERE(AND(PROPERTY_LOOKUP(dba, "n", prop), LESS(PROPERTY_LOOKUP(dba, "r", prop), LITERAL(42)))),
+                   RETURN("m")));
+  FLAGS_query_inline_edge_property_filters = true;
+  memgraph::utils::OnScopeExit reset_flag{[] { FLAGS_query_inline_edge_property_filters = false; }};
+  // We expect `r.prop` filter to be evaluated inside the Expand.
+  CheckPlan<TypeParam>(query, this->storage, ExpectScanAll(), ExpectFilter(), ExpectExpand(), ExpectProduce());
+}
+
 TYPED_TEST(TestPlanner, ReturnAsteriskOmitsLambdaSymbols) {
   // Test MATCH (n) -[r* (ie, in | true)]- (m) RETURN *
   FakeDbAccessor dba;
@@ -2460,6 +2475,64 @@ TYPED_TEST(TestPlanner, Subqueries) {
   }
 }
 
+TYPED_TEST(TestPlanner, SubqueryMemoization) {
+  FakeDbAccessor dba;
+  auto find_apply = [](LogicalOperator &root) {
+    auto *op = &root;
+    while (op->GetTypeInfo() != Apply::kType) op = op->input().get();
+    return static_cast<Apply *>(op);
+  };
+
+  // Memoization is opt-in
+  {
+    auto *subquery =
+        SINGLE_QUERY(WITH("n"), MATCH(PATTERN(NODE("n"), EDGE("r", Direction::OUT), NODE("m"))), RETURN("m"));
+    auto *query = QUERY(SINGLE_QUERY(MATCH(PATTERN(NODE("n"))), CALL_SUBQUERY(subquery), RETURN("n", "m")));
+    auto symbol_table = memgraph::query::MakeSymbolTable(query);
+    auto planner = MakePlanner<TypeParam>(&dba, this->storage, symbol_table, query);
+    EXPECT_EQ(find_apply(planner.plan())->memoization_limit_, 0U);
+  }
+
+  FLAGS_query_subquery_cache_size = 100000;
+  memgraph::utils::OnScopeExit reset_flag{[] { FLAGS_query_subquery_cache_size = 0; }};
+
+  // MATCH (n) CALL { WITH n MATCH (n)-[r]->(m) RETURN m } RETURN n, m
+  {
+    auto *subquery =
+        SINGLE_QUERY(WITH("n"), MATCH(PATTERN(NODE("n"), EDGE("r", Direction::OUT), NODE("m"))), RETURN("m"));
+    auto *query = QUERY(SINGLE_QUERY(MATCH(PATTERN(NODE("n"))), CALL_SUBQUERY(subquery), RETURN("n", "m")));
+    auto symbol_table = memgraph::query::MakeSymbolTable(query);
+    auto planner = MakePlanner<TypeParam>(&dba, this->storage, symbol_table, query);
+    auto *apply = find_apply(planner.plan());
+    EXPECT_EQ(apply->memoization_limit_, FLAGS_query_subquery_cache_size);
+    ASSERT_EQ(apply->memoization_symbols_.size(), 1);
+    EXPECT_EQ(apply->memoization_symbols_[0].name(), "n");
+    ASSERT_EQ(apply->subquery_symbols_.size(), 1);
+    EXPECT_EQ(apply->subquery_symbols_[0].name(), "m");
+  }
+
+  // MATCH (n) CALL { WITH n RETURN rand() AS r } RETURN n, r
+  {
+    auto *subquery = SINGLE_QUERY(WITH("n"), RETURN(FN("rand"), AS("r")));
+    auto *query = QUERY(SINGLE_QUERY(MATCH(PATTERN(NODE("n"))), CALL_SUBQUERY(subquery), RETURN("n", "r")));
+    auto symbol_table = memgraph::query::MakeSymbolTable(query);
+    auto planner = MakePlanner<TypeParam>(&dba, this->storage, symbol_table, query);
+    EXPECT_EQ(find_apply(planner.plan())->memoization_limit_, 0U);
+  }
+
+  // MATCH (n) SET n.prop = 42 WITH n CALL { WITH n MATCH (n)-[r]->(m) RETURN m } RETURN n, m
+  {
+    auto prop = dba.Property("prop");
+    auto *subquery =
+        SINGLE_QUERY(WITH("n"), MATCH(PATTERN(NODE("n"), EDGE("r", Direction::OUT), NODE("m"))), RETURN("m"));
+    auto *query = QUERY(SINGLE_QUERY(MATCH(PATTERN(NODE("n"))), SET(PROPERTY_LOOKUP(dba, "n", prop), LITERAL(42)),
+                                     WITH("n"), CALL_SUBQUERY(subquery), RETURN("n", "m")));
+    auto symbol_table = memgraph::query::MakeSymbolTable(query);
+    auto planner = MakePlanner<TypeParam>(&dba, this->storage, symbol_table, query);
+    EXPECT_EQ(find_apply(planner.plan())->memoization_limit_, 0U);
+  }
+}
+
 TYPED_TEST(TestPlanner, PatternComprehensionInReturn) {
   FakeDbAccessor dba;
   const auto prop = PROPERTY_PAIR(dba, "prop");
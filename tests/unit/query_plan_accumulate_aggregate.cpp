@@ -11,6 +11,7 @@
 
 #include <algorithm>
 #include <iterator>
+#include <limits>
 #include <memory>
 #include <vector>
 
@@ -582,6 +583,128 @@ TYPED_TEST(QueryPlanTest, AggregateTypes) {
   EXPECT_THROW(aggregate(n_p2, Aggregation::Op::SUM), QueryRuntimeException);
 }
 
+TYPED_TEST(QueryPlanTest, AggregateSumPromotion) {
+  // integer sums become doubles once a double is added or they overflow
+  auto storage_dba = this->db->Access();
+  memgraph::query::DbAccessor dba(storage_dba.get());
+
+  auto p1 = dba.NameToProperty("p1");  // overflows int64_t
+  ASSERT_TRUE(dba.InsertVertex()
+                  .SetProperty(p1, memgraph::storage::PropertyValue(std::numeric_limits<int64_t>::max()))
+                  .HasValue());
+  ASSERT_TRUE(dba.InsertVertex().SetProperty(p1, memgraph::storage::PropertyValue(1)).HasValue());
+  auto p2 = dba.NameToProperty("p2");  // combines int and double
+  ASSERT_TRUE(dba.InsertVertex().SetProperty(p2, memgraph::storage::PropertyValue(1)).HasValue());
+  ASSERT_TRUE(dba.InsertVertex().SetProperty(p2, memgraph::storage::PropertyValue(2.5)).HasValue());
+  dba.AdvanceCommand();
+
+  SymbolTable symbol_table;
+
+  auto n = MakeScanAll(this->storage, symbol_table, "n");
+  auto n_p1 = PROPERTY_LOOKUP(dba, IDENT("n")->MapTo(n.sym_), p1);
+  auto n_p2 = PROPERTY_LOOKUP(dba, IDENT("n")->MapTo(n.sym_), p2);
+
+  auto aggregate = [&](Expression *expression, Aggregation::Op aggr_op) {
+    auto produce = this->MakeAggregationProduce(n.op_, symbol_table, {expression}, {aggr_op}, {}, {}, false);
+    auto context = MakeContext(this->storage, symbol_table, &dba);
+    auto results = CollectProduce(*produce, &context);
+    EXPECT_EQ(results.size(), 1);
+    return results[0][0];
+  };
+
+  const auto overflowed = static_cast<double>(std::numeric_limits<int64_t>::max()) + 1.0;
+  auto sum = aggregate(n_p1, Aggregation::Op::SUM);
+  ASSERT_EQ(sum.type(), TypedValue::Type::Double);
+  EXPECT_DOUBLE_EQ(sum.ValueDouble(), overflowed);
+  auto avg = aggregate(n_p1, Aggregation::Op::AVG);
+  ASSERT_EQ(avg.type(), TypedValue::Type::Double);
+  EXPECT_DOUBLE_EQ(avg.ValueDouble(), overflowed / 2);
+
+  sum = aggregate(n_p2, Aggregation::Op::SUM);
+  ASSERT_EQ(sum.type(), TypedValue::Type::Double);
+  EXPECT_DOUBLE_EQ(sum.ValueDouble(), 3.5);
+  avg = aggregate(n_p2, Aggregation::Op::AVG);
+  ASSERT_EQ(avg.type(), TypedValue::Type::Double);
+  EXPECT_DOUBLE_EQ(avg.ValueDouble(), 1.75);
+}
+
+TYPED_TEST(QueryPlanTest, AggregateSampledScan) {
+  // sampled scans produce about the sampled fraction of the vertices, counts
+  // and sums over them are scaled back up
+  auto storage_dba = this->db->Access();
+  memgraph::query::DbAccessor dba(storage_dba.get());
+
+  auto prop = dba.NameToProperty("prop");
+  for (int i = 0; i < 1000; ++i) {
+    ASSERT_TRUE(dba.InsertVertex().SetProperty(prop, memgraph::storage::PropertyValue(1)).HasValue());
+  }
+  dba.AdvanceCommand();
+
+  SymbolTable symbol_table;
+
+  auto aggregate = [&](Expression *sample_percentage) {
+    auto n = MakeScanAll(this->storage, symbol_table, "n");
+    std::static_pointer_cast<ScanAll>(n.op_)->sample_percentage_ = sample_percentage;
+    auto n_p = PROPERTY_LOOKUP(dba, IDENT("n")->MapTo(n.sym_), prop);
+    auto produce = this->MakeAggregationProduce(n.op_, symbol_table, {n_p, n_p},
+                                                {Aggregation::Op::COUNT, Aggregation::Op::SUM}, {}, {}, false);
+    auto aggregate_op = std::static_pointer_cast<Aggregate>(produce->input());
+    aggregate_op->sample_percentage_ = sample_percentage;
+    aggregate_op->sampled_scans_ = 1;
+    auto context = MakeContext(this->storage, symbol_table, &dba);
+    auto results = CollectProduce(*produce, &context);
+    EXPECT_EQ(results.size(), 1);
+    return results[0];
+  };
+
+  auto full = aggregate(LITERAL(100));
+  EXPECT_EQ(full[0].ValueInt(), 1000);
+  EXPECT_EQ(full[1].ValueInt(), 1000);
+
+  // the standard deviation of the scaled estimate is about 32
+  auto sampled = aggregate(LITERAL(50));
+  EXPECT_NEAR(sampled[0].ValueInt(), 1000, 300);
+  EXPECT_EQ(sampled[1].ValueInt(), sampled[0].ValueInt());
+
+  EXPECT_THROW(aggregate(LITERAL(0)), QueryRuntimeException);
+  EXPECT_THROW(aggregate(LITERAL(150)), QueryRuntimeException);
+  EXPECT_THROW(aggregate(LITERAL("a")), QueryRuntimeException);
+}
+
+TYPED_TEST(QueryPlanAggregateOps, ApproxCountDistinct) {
+  {
+    auto results =
+        this->AggregationResults(false, false, {Aggregation::Op::COUNT, Aggregation::Op::APPROX_COUNT_DISTINCT});
+    ASSERT_EQ(results.size(), 1);
+    ASSERT_EQ(results[0][1].type(), TypedValue::Type::Int);
+    EXPECT_EQ(results[0][1].ValueInt(), 0);
+  }
+  this->AddData();
+  {
+    auto results =
+        this->AggregationResults(false, false, {Aggregation::Op::COUNT, Aggregation::Op::APPROX_COUNT_DISTINCT});
+    ASSERT_EQ(results.size(), 1);
+    ASSERT_EQ(results[0][1].type(), TypedValue::Type::Int);
+    EXPECT_EQ(results[0][1].ValueInt(), 3);
+  }
+  {
+    // DISTINCT doesn't change the estimate
+    auto results =
+        this->AggregationResults(false, true, {Aggregation::Op::COUNT, Aggregation::Op::APPROX_COUNT_DISTINCT});
+    ASSERT_EQ(results.size(), 1);
+    EXPECT_EQ(results[0][1].ValueInt(), 3);
+  }
+  {
+    // each group has a single distinct value, and the null group has none
+    auto results =
+        this->AggregationResults(true, false, {Aggregation::Op::COUNT, Aggregation::Op::APPROX_COUNT_DISTINCT});
+    ASSERT_EQ(results.size(), 4);
+    for (const auto &row : results) {
+      EXPECT_EQ(row[1].ValueInt(), row[2].IsNull() ? 0 : 1);
+    }
+  }
+}
+
 TYPED_TEST(QueryPlanTest, Unwind) {
   auto storage_dba = this->db->Access();
   memgraph::query::DbAccessor dba(storage_dba.get());
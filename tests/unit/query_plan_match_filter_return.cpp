@@ -2952,6 +2952,40 @@ TYPED_TEST(QueryPlan, EdgeFilter) {
   EXPECT_EQ(3, test_filter());
 }
 
+TYPED_TEST(QueryPlan, ExpandWithEdgeFilter) {
+  auto storage_dba = this->db->Access();
+  memgraph::query::DbAccessor dba(storage_dba.get());
+
+  // make an N-star expanding from (v1) where edges have
+  // property values 0..9
+  auto v1 = dba.InsertVertex();
+  auto edge_type = dba.NameToEdgeType("et");
+  auto prop = PROPERTY_PAIR(dba, "property");
+  for (int i = 0; i < 10; ++i) {
+    auto v = dba.InsertVertex();
+    auto edge = dba.InsertEdge(&v1, &v, edge_type);
+    ASSERT_TRUE(edge.HasValue());
+    ASSERT_TRUE(edge->SetProperty(prop.second, memgraph::storage::PropertyValue(i)).HasValue());
+  }
+  dba.AdvanceCommand();
+
+  SymbolTable symbol_table;
+
+  // MATCH (n)-[r]->(m) WHERE r.property >= 7 RETURN m
+  // with the filter evaluated inside of the Expand
+  auto n = MakeScanAll(this->storage, symbol_table, "n");
+  auto r_m = MakeExpand(this->storage, symbol_table, n.op_, n.sym_, "r", EdgeAtom::Direction::OUT, {}, "m", false,
+                        memgraph::storage::View::OLD);
+  std::static_pointer_cast<Expand>(r_m.op_)->edge_filter_ =
+      GREATER_EQ(PROPERTY_LOOKUP(dba, IDENT("r")->MapTo(r_m.edge_sym_), prop), LITERAL(7));
+
+  auto output =
+      NEXPR("m", IDENT("m")->MapTo(r_m.node_sym_))->MapTo(symbol_table.CreateSymbol("named_expression_1", true));
+  auto produce = MakeProduce(r_m.op_, output);
+  auto context = MakeContext(this->storage, symbol_table, &dba);
+  EXPECT_EQ(3, PullAll(*produce, &context));
+}
+
 TYPED_TEST(QueryPlan, EdgeFilterMultipleTypes) {
   auto storage_dba = this->db->Access();
   memgraph::query::DbAccessor dba(storage_dba.get());
@@ -3996,6 +4030,40 @@ TYPED_TEST(SubqueriesFeature, SubqueryWithBoundedSymbol) {
   EXPECT_EQ(results.size(), 1);
 }
 
+TYPED_TEST(SubqueriesFeature, MemoizedSubquery) {
+  // UNWIND [1, 2, 1, 1.0] AS x CALL { WITH x MATCH (m) RETURN x AS y, m } RETURN y, m
+
+  auto x = this->symbol_table.CreateSymbol("x", true);
+  const std::vector<TypedValue> input{TypedValue(1), TypedValue(2), TypedValue(1), TypedValue(1.0)};
+  auto unwind = std::make_shared<plan::Unwind>(nullptr, LITERAL(TypedValue(input)), x);
+
+  auto m = MakeScanAll(this->storage, this->symbol_table, "m");
+  auto y_sym = this->symbol_table.CreateSymbol("named_expression_1", true);
+  auto m_sym = this->symbol_table.CreateSymbol("named_expression_2", true);
+  auto produce_subquery = MakeProduce(m.op_, NEXPR("y", IDENT("x")->MapTo(x))->MapTo(y_sym),
+                                      NEXPR("m", IDENT("m")->MapTo(m.sym_))->MapTo(m_sym));
+
+  auto apply = std::make_shared<Apply>(unwind, produce_subquery, true);
+  apply->memoization_limit_ = 100;
+  apply->memoization_symbols_ = {x};
+  apply->subquery_symbols_ = produce_subquery->ModifiedSymbols(this->symbol_table);
+  auto produce = MakeProduce(
+      apply, NEXPR("y", IDENT("y")->MapTo(y_sym))->MapTo(this->symbol_table.CreateSymbol("named_expression_3", true)),
+      NEXPR("m", IDENT("m")->MapTo(m_sym))->MapTo(this->symbol_table.CreateSymbol("named_expression_4", true)));
+
+  auto context = MakeContext(this->storage, this->symbol_table, &this->dba);
+  auto results = CollectProduce(*produce, &context);
+
+  // The repeated 1 is served from the cache, while 1.0 isn't as the subquery returns it as a double
+  ASSERT_EQ(results.size(), 8);
+  for (size_t i = 0; i < results.size(); ++i) {
+    const auto &y = results[i][0];
+    EXPECT_EQ(y.type(), input[i / 2].type());
+    EXPECT_TRUE(TypedValue::BoolEqual{}(y, input[i / 2]));
+    EXPECT_EQ(results[i][1].ValueVertex(), i % 2 == 0 ? results[0][1].ValueVertex() : results[1][1].ValueVertex());
+  }
+}
+
 TYPED_TEST(SubqueriesFeature, SubqueryWithUnionAll) {
   // MATCH (n) CALL { MATCH (m) RETURN m UNION ALL MATCH (m) RETURN m } RETURN n, m
 
@@ -12,8 +12,10 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <atomic>
 #include <filesystem>
 #include <limits>
+#include <thread>
 
 #include "disk_test_utils.hpp"
 #include "storage/v2/disk/storage.hpp"
@@ -2648,3 +2650,58 @@ TYPED_TEST(StorageV2Test, DeletedVertexAccessor) {
     ASSERT_EQ(property_value, *maybe_property);
   }
 }
+
+// Stable epoch reads on a replica see everything committed before them and
+// block applying the next batch of replicated transactions until they finish.
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST(StorageV2, ReplicaEpochReads) {
+  auto storage = std::make_unique<memgraph::storage::InMemoryStorage>(
+      memgraph::storage::Config{.transaction = {.replica_epoch_reads = true}});
+
+  memgraph::storage::Gid gid;
+  memgraph::storage::LabelId label;
+  memgraph::storage::PropertyId prop;
+  {
+    auto acc = storage->Access();
+    auto vertex = acc->CreateVertex();
+    gid = vertex.Gid();
+    label = acc->NameToLabel("label");
+    prop = acc->NameToProperty("prop");
+    ASSERT_FALSE(vertex.AddLabel(label).HasError());
+    ASSERT_FALSE(vertex.SetProperty(prop, memgraph::storage::PropertyValue(1)).HasError());
+    ASSERT_FALSE(acc->Commit().HasError());
+  }
+  {
+    auto acc = storage->Access();
+    auto vertex = acc->FindVertex(gid, memgraph::storage::View::OLD);
+    ASSERT_TRUE(vertex.has_value());
+    ASSERT_FALSE(vertex->SetProperty(prop, memgraph::storage::PropertyValue(2)).HasError());
+    ASSERT_FALSE(acc->Commit().HasError());
+  }
+
+  std::atomic<bool> applied{false};
+  std::thread apply;
+  {
+    auto acc = storage->ReplicaReadAccess({});
+    auto vertex = acc->FindVertex(gid, memgraph::storage::View::OLD);
+    ASSERT_TRUE(vertex.has_value());
+    EXPECT_EQ(*vertex->GetProperty(prop, memgraph::storage::View::OLD), memgraph::storage::PropertyValue(2));
+    EXPECT_TRUE(*vertex->HasLabel(label, memgraph::storage::View::OLD));
+
+    apply = std::thread([&] {
+      auto epoch_guard = storage->LockReplicaEpoch();
+      applied = true;
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    EXPECT_FALSE(applied);
+    ASSERT_FALSE(acc->Commit().HasError());
+  }
+  apply.join();
+  EXPECT_TRUE(applied);
+
+  // Without the option replica reads are ordinary transactions
+  auto default_storage = std::make_unique<memgraph::storage::InMemoryStorage>();
+  auto acc = default_storage->ReplicaReadAccess({});
+  auto epoch_guard = default_storage->LockReplicaEpoch();
+  EXPECT_FALSE(epoch_guard.owns_lock());
+}
@@ -1006,6 +1006,44 @@ void DestroyWalSuffix(const std::filesystem::path &path) {
   file.Close();
 }
 
+// Flips a bit of the vertex GID in the second transaction of the WAL, which
+// leaves the WAL readable, only the checksum of the transaction doesn't match.
+void FlipWalSecondTransactionBit(const std::filesystem::path &path) {
+  auto info = memgraph::storage::durability::ReadWalInfo(path);
+  spdlog::info("Corrupting WAL {}", path);
+  uint64_t position = 0;
+  {
+    memgraph::storage::durability::Decoder wal;
+    auto version = wal.Initialize(path, memgraph::storage::durability::kWalMagic);
+    ASSERT_TRUE(version);
+    wal.SetPosition(info.offset_deltas);
+    while (true) {
+      memgraph::storage::durability::ReadWalDeltaHeader(&wal);
+      auto delta = memgraph::storage::durability::ReadWalDeltaData(&wal);
+      memgraph::storage::durability::ReadWalTransactionChecksum(&wal, delta.type, *version);
+      if (delta.type == memgraph::storage::durability::WalDeltaData::Type::TRANSACTION_END) break;
+    }
+    // The GID follows the delta marker, the timestamp, the delta type marker
+    // and the type marker of the GID.
+    position = *wal.GetPosition() + 12;
+  }
+  ASSERT_LT(position, info.offset_end);
+  uint8_t value = 0;
+  {
+    memgraph::utils::InputFile file;
+    ASSERT_TRUE(file.Open(path));
+    ASSERT_TRUE(file.SetPosition(memgraph::utils::InputFile::Position::SET, position));
+    ASSERT_TRUE(file.Read(&value, sizeof(value)));
+  }
+  value ^= 1U;
+  memgraph::utils::OutputFile file;
+  file.Open(path, memgraph::utils::OutputFile::Mode::OVERWRITE_EXISTING);
+  file.SetPosition(memgraph::utils::OutputFile::Position::SET, position);
+  file.Write(&value, sizeof(value));
+  file.Sync();
+  file.Close();
+}
+
 INSTANTIATE_TEST_SUITE_P(EdgesWithProperties, DurabilityTest, ::testing::Values(true));
 INSTANTIATE_TEST_SUITE_P(EdgesWithoutProperties, DurabilityTest, ::testing::Values(false));
 
@@ -1255,6 +1293,58 @@ TEST_P(DurabilityTest, SnapshotEverythingCorrupt) {
       "");
 }
 
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_P(DurabilityTest, SnapshotChecksumMismatch) {
+  // Create snapshot.
+  {
+    memgraph::storage::Config config{.durability = {.storage_directory = storage_directory, .snapshot_on_exit = true},
+                                     .salient = {.items = {.properties_on_edges = GetParam()}}};
+    memgraph::replication::ReplicationState repl_state{memgraph::storage::ReplicationStateRootPath(config)};
+    memgraph::dbms::Database db{config, repl_state};
+    CreateBaseDataset(db.storage(), GetParam());
+  }
+
+  ASSERT_EQ(GetSnapshotsList().size(), 1);
+  const auto snapshot = GetSnapshotsList().front();
+  ASSERT_TRUE(memgraph::storage::durability::VerifySnapshotFile(snapshot));
+
+  // Flip a bit of the first vertex GID, which leaves the snapshot readable,
+  // only the checksum of the batch doesn't match anymore.
+  {
+    auto info = memgraph::storage::durability::ReadSnapshotInfo(snapshot);
+    // Skip the vertex marker and the type marker of the GID.
+    const auto position = info.offset_vertices + 2;
+    uint8_t value = 0;
+    {
+      memgraph::utils::InputFile file;
+      ASSERT_TRUE(file.Open(snapshot));
+      ASSERT_TRUE(file.SetPosition(memgraph::utils::InputFile::Position::SET, position));
+      ASSERT_TRUE(file.Read(&value, sizeof(value)));
+    }
+    value ^= 1U;
+    memgraph::utils::OutputFile file;
+    file.Open(snapshot, memgraph::utils::OutputFile::Mode::OVERWRITE_EXISTING);
+    file.SetPosition(memgraph::utils::OutputFile::Position::SET, position);
+    file.Write(&value, sizeof(value));
+    file.Sync();
+    file.Close();
+  }
+  ASSERT_FALSE(memgraph::storage::durability::VerifySnapshotFile(snapshot));
+
+  // Recover snapshot.
+  ASSERT_DEATH(
+      ([&]() {
+        memgraph::storage::Config config{
+            .durability = {.storage_directory = storage_directory, .recover_on_startup = true},
+            .salient = {.items = {.properties_on_edges = GetParam()}},
+        };
+        memgraph::replication::ReplicationState repl_state{memgraph::storage::ReplicationStateRootPath(config)};
+        memgraph::dbms::Database db{config, repl_state};
+      }())  // iile
+      ,
+      "");
+}
+
 // NOLINTNEXTLINE(hicpp-special-member-functions)
 TEST_P(DurabilityTest, SnapshotRetention) {
   // Create unrelated snapshot.
@@ -2076,13 +2166,16 @@ TEST_P(DurabilityTest, WalTransactionOrdering) {
     auto path = GetWalsList().front();
     auto info = memgraph::storage::durability::ReadWalInfo(path);
     memgraph::storage::durability::Decoder wal;
-    wal.Initialize(path, memgraph::storage::durability::kWalMagic);
+    auto version = wal.Initialize(path, memgraph::storage::durability::kWalMagic);
+    ASSERT_TRUE(version);
     wal.SetPosition(info.offset_deltas);
     ASSERT_EQ(info.num_deltas, 9);
     std::vector<std::pair<uint64_t, memgraph::storage::durability::WalDeltaData>> data;
     for (uint64_t i = 0; i < info.num_deltas; ++i) {
       auto timestamp = memgraph::storage::durability::ReadWalDeltaHeader(&wal);
-      data.emplace_back(timestamp, memgraph::storage::durability::ReadWalDeltaData(&wal));
+      auto delta = memgraph::storage::durability::ReadWalDeltaData(&wal);
+      memgraph::storage::durability::ReadWalTransactionChecksum(&wal, delta.type, *version);
+      data.emplace_back(timestamp, delta);
     }
     // Verify timestamps.
     ASSERT_EQ(data[1].first, data[0].first);
@@ -2569,6 +2662,59 @@ TEST_P(DurabilityTest, WalCorruptLastTransaction) {
   }
 }
 
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_P(DurabilityTest, WalChecksumMismatchSecond) {
+  // Create WALs.
+  {
+    memgraph::storage::Config config{
+        .durability = {.storage_directory = storage_directory,
+                       .snapshot_wal_mode =
+                           memgraph::storage::Config::Durability::SnapshotWalMode::PERIODIC_SNAPSHOT_WITH_WAL,
+                       .snapshot_interval = std::chrono::minutes(20),
+                       .wal_file_size_kibibytes = 1,
+                       .wal_file_flush_every_n_tx = kFlushWalEvery},
+        .salient = {.items = {.properties_on_edges = GetParam()}},
+    };
+    memgraph::replication::ReplicationState repl_state{memgraph::storage::ReplicationStateRootPath(config)};
+    memgraph::dbms::Database db{config, repl_state};
+    for (uint64_t i = 0; i < 1000; ++i) {
+      auto acc = db.Access();
+      acc->CreateVertex();
+      ASSERT_FALSE(acc->Commit().HasError());
+    }
+  }
+
+  ASSERT_EQ(GetSnapshotsList().size(), 0);
+  ASSERT_EQ(GetBackupSnapshotsList().size(), 0);
+  ASSERT_GE(GetWalsList().size(), 3);
+  ASSERT_EQ(GetBackupWalsList().size(), 0);
+
+  // Corrupt the middle of the second WAL. The WAL is finalized, so the
+  // mismatch can't be a torn write and the rest of the WAL can't be dropped.
+  {
+    auto wals = GetWalsList();
+    const auto &wal_file = wals[wals.size() - 2];
+    ASSERT_FALSE(memgraph::storage::durability::IsCurrentWalName(wal_file));
+    FlipWalSecondTransactionBit(wal_file);
+    auto info = memgraph::storage::durability::ReadWalInfo(wal_file);
+    ASSERT_TRUE(info.checksum_mismatch);
+    ASSERT_FALSE(memgraph::storage::durability::VerifyWalFile(wal_file));
+  }
+
+  // Recover WALs.
+  ASSERT_DEATH(
+      ([&]() {
+        memgraph::storage::Config config{
+            .durability = {.storage_directory = storage_directory, .recover_on_startup = true},
+            .salient = {.items = {.properties_on_edges = GetParam()}},
+        };
+        memgraph::replication::ReplicationState repl_state{memgraph::storage::ReplicationStateRootPath(config)};
+        memgraph::dbms::Database db{config, repl_state};
+      }())  // iile
+      ,
+      "");
+}
+
 // NOLINTNEXTLINE(hicpp-special-member-functions)
 TEST_P(DurabilityTest, WalAllOperationsInSingleTransaction) {
   // Create WALs
@@ -204,3 +204,190 @@ TEST(StorageV2Gc, Indices) {
     EXPECT_EQ(gids.size(), 1000);
   }
 }
+
+// Objects deleted in IN_MEMORY_ANALYTICAL mode have no deltas; GC has to remove
+// them from the main storage based on the gids handed over by DetachDelete.
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST(StorageV2Gc, AnalyticalDetachDelete) {
+  std::unique_ptr<memgraph::storage::Storage> storage(
+      std::make_unique<memgraph::storage::InMemoryStorage>(memgraph::storage::Config{
+          .gc = {.type = memgraph::storage::Config::Gc::Type::NONE}}));
+  static_cast<memgraph::storage::InMemoryStorage *>(storage.get())
+      ->SetStorageMode(memgraph::storage::StorageMode::IN_MEMORY_ANALYTICAL);
+
+  memgraph::storage::Gid hub_gid;
+  {
+    auto acc = storage->Access();
+    auto hub = acc->CreateVertex();
+    hub_gid = hub.Gid();
+    for (uint64_t i = 0; i < 1000; ++i) {
+      auto vertex = acc->CreateVertex();
+      ASSERT_FALSE(acc->CreateEdge(&hub, &vertex, acc->NameToEdgeType("Edge")).HasError());
+    }
+    ASSERT_FALSE(acc->Commit().HasError());
+  }
+  EXPECT_EQ(storage->GetBaseInfo().vertex_count, 1001);
+
+  {
+    auto acc = storage->Access();
+    auto hub = acc->FindVertex(hub_gid, memgraph::storage::View::OLD);
+    ASSERT_TRUE(hub.has_value());
+    auto res = acc->DetachDeleteVertex(&*hub);
+    ASSERT_FALSE(res.HasError());
+    ASSERT_TRUE(res->has_value());
+    EXPECT_EQ((*res)->second.size(), 1000);
+    ASSERT_FALSE(acc->Commit().HasError());
+  }
+
+  storage->FreeMemory();
+
+  EXPECT_EQ(storage->GetBaseInfo().vertex_count, 1000);
+  EXPECT_EQ(storage->GetBaseInfo().edge_count, 0);
+  {
+    auto acc = storage->Access();
+    EXPECT_FALSE(acc->FindVertex(hub_gid, memgraph::storage::View::OLD).has_value());
+  }
+}
+
+// With history retention enabled GC must keep the versions an AS OF reader
+// needs, even after newer commits replaced them.
+// Without properties on edges there are no edge gids to hand over, but the
+// edge type index still has to drop the entries of the deleted vertices before
+// GC frees them.
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST(StorageV2Gc, AnalyticalDetachDeleteEdgeTypeIndex) {
+  std::unique_ptr<memgraph::storage::Storage> storage(
+      std::make_unique<memgraph::storage::InMemoryStorage>(memgraph::storage::Config{
+          .gc = {.type = memgraph::storage::Config::Gc::Type::NONE},
+          .salient = {.items = {.properties_on_edges = false}}}));
+  static_cast<memgraph::storage::InMemoryStorage *>(storage.get())
+      ->SetStorageMode(memgraph::storage::StorageMode::IN_MEMORY_ANALYTICAL);
+
+  auto const edge_type = storage->NameToEdgeType("Edge");
+  {
+    auto unique_acc = storage->UniqueAccess();
+    ASSERT_FALSE(unique_acc->CreateIndex(edge_type).HasError());
+    ASSERT_FALSE(unique_acc->Commit().HasError());
+  }
+
+  memgraph::storage::Gid hub_gid;
+  {
+    auto acc = storage->Access();
+    auto hub = acc->CreateVertex();
+    hub_gid = hub.Gid();
+    for (uint64_t i = 0; i < 1000; ++i) {
+      auto vertex = acc->CreateVertex();
+      ASSERT_FALSE(acc->CreateEdge(&hub, &vertex, edge_type).HasError());
+    }
+    ASSERT_FALSE(acc->Commit().HasError());
+  }
+
+  {
+    auto acc = storage->Access();
+    auto hub = acc->FindVertex(hub_gid, memgraph::storage::View::OLD);
+    ASSERT_TRUE(hub.has_value());
+    auto res = acc->DetachDeleteVertex(&*hub);
+    ASSERT_FALSE(res.HasError());
+    ASSERT_TRUE(res->has_value());
+    EXPECT_EQ((*res)->second.size(), 1000);
+    ASSERT_FALSE(acc->Commit().HasError());
+  }
+
+  storage->FreeMemory();
+
+  EXPECT_EQ(storage->GetBaseInfo().vertex_count, 1000);
+  {
+    auto acc = storage->Access();
+    EXPECT_FALSE(acc->FindVertex(hub_gid, memgraph::storage::View::OLD).has_value());
+    uint64_t count = 0;
+    for (auto const &edge : acc->Edges(edge_type, memgraph::storage::View::OLD)) {
+      EXPECT_NE(edge.FromVertex().Gid(), hub_gid);
+      ++count;
+    }
+    EXPECT_EQ(count, 0);
+  }
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST(StorageV2Gc, HistoryRetentionAsOf) {
+  std::unique_ptr<memgraph::storage::Storage> storage(
+      std::make_unique<memgraph::storage::InMemoryStorage>(memgraph::storage::Config{
+          .gc = {.type = memgraph::storage::Config::Gc::Type::NONE, .history_retention = std::chrono::hours(1)}}));
+
+  memgraph::storage::Gid gid;
+  memgraph::storage::PropertyId prop;
+  {
+    auto acc = storage->Access();
+    auto vertex = acc->CreateVertex();
+    gid = vertex.Gid();
+    prop = acc->NameToProperty("prop");
+    ASSERT_FALSE(vertex.SetProperty(prop, memgraph::storage::PropertyValue(1)).HasError());
+    ASSERT_FALSE(acc->Commit().HasError());
+  }
+  auto const first_version_time = std::chrono::system_clock::now();
+  std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  {
+    auto acc = storage->Access();
+    auto vertex = acc->FindVertex(gid, memgraph::storage::View::OLD);
+    ASSERT_TRUE(vertex.has_value());
+    ASSERT_FALSE(vertex->SetProperty(prop, memgraph::storage::PropertyValue(2)).HasError());
+    ASSERT_FALSE(acc->Commit().HasError());
+  }
+
+  storage->FreeMemory();
+
+  {
+    auto maybe_acc = storage->AccessAsOf(first_version_time);
+    ASSERT_TRUE(maybe_acc.HasValue());
+    auto &acc = *maybe_acc;
+    auto vertex = acc->FindVertex(gid, memgraph::storage::View::OLD);
+    ASSERT_TRUE(vertex.has_value());
+    EXPECT_EQ(*vertex->GetProperty(prop, memgraph::storage::View::OLD), memgraph::storage::PropertyValue(1));
+
+    // Writes on top of a historical version can't be committed
+    acc->CreateVertex();
+    EXPECT_TRUE(acc->Commit().HasError());
+  }
+  {
+    auto acc = storage->Access();
+    auto vertex = acc->FindVertex(gid, memgraph::storage::View::OLD);
+    ASSERT_TRUE(vertex.has_value());
+    EXPECT_EQ(*vertex->GetProperty(prop, memgraph::storage::View::OLD), memgraph::storage::PropertyValue(2));
+  }
+
+  auto no_history_storage = std::make_unique<memgraph::storage::InMemoryStorage>();
+  EXPECT_TRUE(no_history_storage->AccessAsOf(first_version_time).HasError());
+}
+
+// Commits older than the retention window are dropped on commit as well, so
+// the history stays bounded when GC doesn't run.
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST(StorageV2Gc, HistoryRetentionTrimmedWithoutGc) {
+  std::unique_ptr<memgraph::storage::Storage> storage(
+      std::make_unique<memgraph::storage::InMemoryStorage>(memgraph::storage::Config{
+          .gc = {.type = memgraph::storage::Config::Gc::Type::NONE,
+                 .history_retention = std::chrono::milliseconds(50)}}));
+
+  auto const commit = [&] {
+    auto acc = storage->Access();
+    acc->CreateVertex();
+    ASSERT_FALSE(acc->Commit().HasError());
+  };
+
+  auto const before_first_commit = std::chrono::system_clock::now();
+  std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  commit();
+  auto const after_first_commit = std::chrono::system_clock::now();
+  EXPECT_TRUE(storage->AccessAsOf(before_first_commit).HasValue());
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  commit();
+  // The first commit defines the state at the start of the window, anything before it is gone
+  EXPECT_TRUE(storage->AccessAsOf(before_first_commit).HasError());
+  EXPECT_TRUE(storage->AccessAsOf(after_first_commit).HasValue());
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  commit();
+  EXPECT_TRUE(storage->AccessAsOf(after_first_commit).HasError());
+  EXPECT_TRUE(storage->AccessAsOf(std::chrono::system_clock::now()).HasValue());
+}
@@ -9,6 +9,8 @@
 // by the Apache License, Version 2.0, included in the file
 // licenses/APL.txt.
 
+#include <algorithm>
+
 #include <gmock/gmock.h>
 #include <gtest/gtest-typed-test.h>
 #include <gtest/gtest.h>
@@ -2136,3 +2138,54 @@ TYPED_TEST(IndexTest, EdgeTypePropertyIndexRepeatingEdgeTypesBetweenSameVertices
   EXPECT_THAT(this->GetIds(acc->Edges(this->edge_type_id1, this->edge_prop_id1, View::NEW), View::NEW),
               UnorderedElementsAre(1, 2, 3, 4, 5));
 }
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST(SynchronizedScanTest, LabelIndexScanJoinsConcurrentScan) {
+  memgraph::storage::Config config;
+  config.transaction.synchronized_scans = true;
+  auto storage = std::make_unique<InMemoryStorage>(config);
+  LabelId label;
+  PropertyId prop_id;
+  constexpr int64_t kVertexCount = 5000;
+  {
+    auto acc = storage->Access();
+    label = acc->NameToLabel("label");
+    prop_id = acc->NameToProperty("id");
+    for (int64_t i = 0; i < kVertexCount; ++i) {
+      auto vertex = acc->CreateVertex();
+      ASSERT_NO_ERROR(vertex.AddLabel(label));
+      ASSERT_NO_ERROR(vertex.SetProperty(prop_id, PropertyValue(i)));
+    }
+    ASSERT_NO_ERROR(acc->Commit());
+  }
+  {
+    auto unique_acc = storage->UniqueAccess();
+    ASSERT_FALSE(unique_acc->CreateIndex(label).HasError());
+    ASSERT_NO_ERROR(unique_acc->Commit());
+  }
+
+  auto get_ids = [&](auto iterable, int64_t limit) {
+    std::vector<int64_t> ids;
+    for (auto vertex : iterable) {
+      if (static_cast<int64_t>(ids.size()) == limit) break;
+      ids.push_back(vertex.GetProperty(prop_id, View::OLD)->ValueInt());
+    }
+    return ids;
+  };
+
+  // The first scan walks the index from the beginning and stops midway
+  auto running_acc = storage->Access();
+  auto running_scan = get_ids(running_acc->Vertices(label, View::OLD), 3000);
+  ASSERT_EQ(running_scan.size(), 3000);
+
+  // The second scan joins at the reported position and wraps around for the rest
+  auto acc = storage->Access();
+  auto joined_scan = get_ids(acc->Vertices(label, View::OLD), kVertexCount + 1);
+  ASSERT_EQ(joined_scan.size(), kVertexCount);
+  EXPECT_NE(joined_scan.front(), running_scan.front());
+  EXPECT_NE(std::find(running_scan.begin(), running_scan.end(), joined_scan.front()), running_scan.end());
+  std::sort(joined_scan.begin(), joined_scan.end());
+  for (int64_t i = 0; i < kVertexCount; ++i) {
+    EXPECT_EQ(joined_scan[i], i);
+  }
+}
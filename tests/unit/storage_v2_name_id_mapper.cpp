@@ -1,4 +1,4 @@
-// Copyright 2022 Memgraph Ltd.
+// Copyright 2024 Memgraph Ltd.
 //
 // Use of this software is governed by the Business Source License
 // included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
@@ -11,8 +11,22 @@
 
 #include <gtest/gtest.h>
 
+#include <atomic>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+#include <fmt/format.h>
+
 #include "storage/v2/name_id_mapper.hpp"
 
+namespace {
+class HashBucketsNameIdMapper : public memgraph::storage::NameIdMapper {
+ public:
+  uint64_t HashBuckets() const { return hashed_name_to_id_.BucketCount(); }
+};
+}  // namespace
+
 // NOLINTNEXTLINE(hicpp-special-member-functions)
 TEST(NameIdMapper, Basic) {
   memgraph::storage::NameIdMapper mapper;
@@ -45,3 +59,78 @@ TEST(NameIdMapper, Correctness) {
   ASSERT_EQ(mapper.IdToName(1), "n2");
   ASSERT_EQ(mapper.IdToName(0), "n1");
 }
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST(NameIdMapper, ManyNamesConcurrent) {
+  memgraph::storage::NameIdMapper mapper;
+  constexpr int kNames = 10000;
+  constexpr int kThreads = 4;
+
+  std::vector<std::thread> threads;
+  threads.reserve(kThreads);
+  for (int t = 0; t < kThreads; ++t) {
+    threads.emplace_back([&mapper, t] {
+      for (int i = 0; i < kNames; ++i) {
+        // Every thread inserts the same names, in a different order
+        auto const name = fmt::format("name{}", (i + t * (kNames / kThreads)) % kNames);
+        auto const id = mapper.NameToId(name);
+        ASSERT_EQ(mapper.IdToName(id), name);
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+
+  std::unordered_set<uint64_t> ids;
+  for (int i = 0; i < kNames; ++i) {
+    auto const name = fmt::format("name{}", i);
+    auto const id = mapper.NameToIdIfExists(name);
+    ASSERT_TRUE(id.has_value());
+    ASSERT_EQ(mapper.IdToName(*id), name);
+    ASSERT_EQ(mapper.NameToId(name), *id);
+    ids.insert(*id);
+  }
+  // Every name got its own ID, even though more names than hash buckets were inserted concurrently
+  ASSERT_EQ(ids.size(), kNames);
+  ASSERT_FALSE(mapper.NameToIdIfExists("name").has_value());
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST(NameIdMapper, HashTableGrowsWhileReading) {
+  HashBucketsNameIdMapper mapper;
+  constexpr int kNames = 100000;
+  constexpr int kReaders = 4;
+  auto const initial_buckets = mapper.HashBuckets();
+
+  std::atomic<int> published{0};
+  std::vector<std::thread> readers;
+  readers.reserve(kReaders);
+  for (int t = 0; t < kReaders; ++t) {
+    readers.emplace_back([&mapper, &published] {
+      while (published.load(std::memory_order_acquire) < kNames) {
+        auto const count = published.load(std::memory_order_acquire);
+        if (count == 0) continue;
+        // Names that were already published are found while the table is being grown
+        auto const i = count - 1;
+        auto const id = mapper.NameToIdIfExists(fmt::format("name{}", i));
+        ASSERT_TRUE(id.has_value());
+        ASSERT_EQ(*id, i);
+      }
+    });
+  }
+  for (int i = 0; i < kNames; ++i) {
+    ASSERT_EQ(mapper.NameToId(fmt::format("name{}", i)), i);
+    published.store(i + 1, std::memory_order_release);
+  }
+  for (auto &reader : readers) {
+    reader.join();
+  }
+
+  // Not more names than buckets, so the chains stay short
+  ASSERT_GT(mapper.HashBuckets(), initial_buckets);
+  ASSERT_GE(mapper.HashBuckets(), kNames);
+  for (int i = 0; i < kNames; ++i) {
+    ASSERT_EQ(mapper.NameToIdIfExists(fmt::format("name{}", i)), i);
+  }
+}
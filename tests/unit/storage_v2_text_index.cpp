@@ -0,0 +1,91 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include <filesystem>
+#include <memory>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "flags/experimental.hpp"
+#include "storage/v2/indices/text_index.hpp"
+#include "storage/v2/inmemory/storage.hpp"
+#include "storage/v2/property_value.hpp"
+#include "utils/logging.hpp"
+
+// NOLINTNEXTLINE(google-build-using-namespace)
+using namespace memgraph::storage;
+using testing::ElementsAre;
+using testing::IsEmpty;
+
+class TextIndexTest : public testing::Test {
+ protected:
+  void SetUp() override {
+    memgraph::flags::SetExperimental(memgraph::flags::Experiments::TEXT_SEARCH);
+    std::filesystem::remove_all(storage_directory);
+    storage = std::make_unique<InMemoryStorage>(Config{.durability = {.storage_directory = storage_directory}});
+  }
+
+  void TearDown() override {
+    storage.reset();
+    std::filesystem::remove_all(storage_directory);
+    memgraph::flags::SetExperimental(static_cast<memgraph::flags::Experiments>(0));
+  }
+
+  // Sets the property of the vertex and returns the documents of the transaction, which is committed without them.
+  TextIndex::PendingBatch SetAndCommit(Gid gid, PropertyId property, const std::string &value) {
+    auto acc = storage->Access();
+    auto vertex = acc->FindVertex(gid, View::OLD);
+    MG_ASSERT(vertex);
+    MG_ASSERT(vertex->SetProperty(property, PropertyValue(value)).HasValue());
+    acc->TextIndexUpdateVertex(*vertex);
+    auto batch = storage->indices_.text_index_.PrepareCommit(*acc->GetTransaction(), storage->name_id_mapper_.get());
+    MG_ASSERT(!acc->Commit().HasError());
+    return batch;
+  }
+
+  std::vector<Gid> Search(const std::string &query) {
+    auto acc = storage->Access();
+    return acc->TextIndexSearch("index", query, text_search_mode::SPECIFIED_PROPERTIES);
+  }
+
+  const std::filesystem::path storage_directory{std::filesystem::temp_directory_path() /
+                                                "MG_test_unit_storage_v2_text_index"};
+  std::unique_ptr<Storage> storage;
+};
+
+TEST_F(TextIndexTest, NewestCommitWinsRegardlessOfQueueOrder) {
+  const auto label = storage->NameToLabel("Document");
+  const auto property = storage->NameToProperty("title");
+  Gid gid;
+  {
+    auto acc = storage->Access();
+    auto vertex = acc->CreateVertex();
+    ASSERT_TRUE(vertex.AddLabel(label).HasValue());
+    gid = vertex.Gid();
+    ASSERT_FALSE(acc->Commit().HasError());
+  }
+  {
+    auto acc = storage->UniqueAccess();
+    acc->CreateTextIndex("index", label);
+    ASSERT_FALSE(acc->Commit().HasError());
+  }
+
+  // The first transaction commits before the second one, but its documents are queued after them
+  auto first = SetAndCommit(gid, property, "first");
+  auto second = SetAndCommit(gid, property, "second");
+  storage->indices_.text_index_.Commit(std::move(second), 2);
+  storage->indices_.text_index_.Commit(std::move(first), 1);
+  storage->indices_.text_index_.ApplyCommitted();
+
+  EXPECT_THAT(Search("data.title:second"), ElementsAre(gid));
+  EXPECT_THAT(Search("data.title:first"), IsEmpty());
+}
@@ -19,6 +19,7 @@
 
 #include "storage/v2/constraints/type_constraints_kind.hpp"
 #include "storage/v2/durability/exceptions.hpp"
+#include "storage/v2/durability/paths.hpp"
 #include "storage/v2/durability/serialization.hpp"
 #include "storage/v2/durability/version.hpp"
 #include "storage/v2/durability/wal.hpp"
@@ -222,12 +223,13 @@ class DeltaGenerator final {
   using DataT = std::vector<std::pair<uint64_t, memgraph::storage::durability::WalDeltaData>>;
 
   DeltaGenerator(const std::filesystem::path &data_directory, bool properties_on_edges, uint64_t seq_num,
-                 memgraph::storage::StorageMode storage_mode = memgraph::storage::StorageMode::IN_MEMORY_TRANSACTIONAL)
+                 memgraph::storage::StorageMode storage_mode = memgraph::storage::StorageMode::IN_MEMORY_TRANSACTIONAL,
+                 memgraph::storage::durability::WalSegmentPool *segment_pool = nullptr)
       : uuid_(memgraph::utils::GenerateUUID()),
         epoch_id_(memgraph::utils::GenerateUUID()),
         seq_num_(seq_num),
         wal_file_(data_directory, uuid_, epoch_id_, {.properties_on_edges = properties_on_edges}, &mapper_, seq_num,
-                  &file_retainer_),
+                  &file_retainer_, segment_pool),
         storage_mode_(storage_mode) {}
 
   Transaction CreateTransaction() { return Transaction(this); }
@@ -238,6 +240,11 @@ class DeltaGenerator final {
     valid_ = false;
   }
 
+  // Continues the timestamps where another WAL file stopped.
+  void SkipTimestamps(uint64_t count) { timestamp_ += count; }
+
+  void FinalizeWal() { wal_file_.FinalizeWal(); }
+
   void AppendOperation(memgraph::storage::durability::StorageMetadataOperation operation, const std::string &label,
                        const std::set<std::string, std::less<>> properties = {}, const std::string &stats = {},
                        const std::string &edge_type = {}, const std::string &name = {},
@@ -538,12 +545,15 @@ void AssertWalInfoEqual(const memgraph::storage::durability::WalInfo &a,
 void AssertWalDataEqual(const DeltaGenerator::DataT &data, const std::filesystem::path &path) {
   auto info = memgraph::storage::durability::ReadWalInfo(path);
   memgraph::storage::durability::Decoder wal;
-  wal.Initialize(path, memgraph::storage::durability::kWalMagic);
+  auto version = wal.Initialize(path, memgraph::storage::durability::kWalMagic);
+  ASSERT_TRUE(version);
   wal.SetPosition(info.offset_deltas);
   DeltaGenerator::DataT current;
   for (uint64_t i = 0; i < info.num_deltas; ++i) {
     auto timestamp = memgraph::storage::durability::ReadWalDeltaHeader(&wal);
-    current.emplace_back(timestamp, memgraph::storage::durability::ReadWalDeltaData(&wal));
+    auto delta = memgraph::storage::durability::ReadWalDeltaData(&wal);
+    memgraph::storage::durability::ReadWalTransactionChecksum(&wal, delta.type, *version);
+    current.emplace_back(timestamp, delta);
   }
   ASSERT_EQ(data.size(), current.size());
   ASSERT_EQ(data, current);
@@ -889,6 +899,187 @@ TEST_P(WalFileTest, PartialData) {
   AssertWalInfoEqual(infos[infos.size() - 1].second, memgraph::storage::durability::ReadWalInfo(current_file));
 }
 
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_P(WalFileTest, ChecksumMismatch) {
+  std::vector<std::pair<uint64_t, memgraph::storage::durability::WalInfo>> infos;
+
+  {
+    DeltaGenerator gen(storage_directory, GetParam(), 5);
+    for (int i = 0; i < 3; ++i) {
+      TRANSACTION(true, { tx.CreateVertex(); });
+      infos.emplace_back(gen.GetPosition(), gen.GetInfo());
+    }
+  }
+
+  auto wal_files = GetFilesList();
+  ASSERT_EQ(wal_files.size(), 1);
+  const auto &wal_file = wal_files.front();
+  AssertWalInfoEqual(infos.back().second, memgraph::storage::durability::ReadWalInfo(wal_file));
+  ASSERT_TRUE(memgraph::storage::durability::VerifyWalFile(wal_file));
+
+  // Flip a bit of the vertex GID in the second transaction, which leaves the
+  // delta readable, only the checksum of the transaction doesn't match anymore.
+  // The GID follows the delta marker, the timestamp, the delta type marker and
+  // the type marker of the GID.
+  const auto position = infos[0].first + 12;
+  uint8_t value = 0;
+  {
+    memgraph::utils::InputFile file;
+    ASSERT_TRUE(file.Open(wal_file));
+    ASSERT_TRUE(file.SetPosition(memgraph::utils::InputFile::Position::SET, position));
+    ASSERT_TRUE(file.Read(&value, sizeof(value)));
+  }
+  value ^= 1U;
+  memgraph::utils::OutputFile file;
+  file.Open(wal_file, memgraph::utils::OutputFile::Mode::OVERWRITE_EXISTING);
+  file.SetPosition(memgraph::utils::OutputFile::Position::SET, position);
+  file.Write(&value, sizeof(value));
+  file.Sync();
+  file.Close();
+
+  // Only the transactions before the corrupt one are valid. The WAL wasn't
+  // finalized, so the mismatch can be a torn write.
+  auto info = memgraph::storage::durability::ReadWalInfo(wal_file);
+  AssertWalInfoEqual(infos[0].second, info);
+  ASSERT_TRUE(info.checksum_mismatch);
+  ASSERT_TRUE(memgraph::storage::durability::IsCurrentWalName(wal_file));
+  ASSERT_FALSE(memgraph::storage::durability::VerifyWalFile(wal_file));
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_P(WalFileTest, ChecksumMismatchFinalized) {
+  std::vector<std::pair<uint64_t, memgraph::storage::durability::WalInfo>> infos;
+
+  {
+    DeltaGenerator gen(storage_directory, GetParam(), 5);
+    for (int i = 0; i < 3; ++i) {
+      TRANSACTION(true, { tx.CreateVertex(); });
+      infos.emplace_back(gen.GetPosition(), gen.GetInfo());
+    }
+    gen.FinalizeWal();
+  }
+
+  auto wal_files = GetFilesList();
+  ASSERT_EQ(wal_files.size(), 1);
+  const auto &wal_file = wal_files.front();
+  ASSERT_FALSE(memgraph::storage::durability::IsCurrentWalName(wal_file));
+  ASSERT_FALSE(memgraph::storage::durability::ReadWalInfo(wal_file).checksum_mismatch);
+
+  // Flip a bit of the vertex GID in the second transaction, see
+  // `ChecksumMismatch`.
+  const auto position = infos[0].first + 12;
+  uint8_t value = 0;
+  {
+    memgraph::utils::InputFile file;
+    ASSERT_TRUE(file.Open(wal_file));
+    ASSERT_TRUE(file.SetPosition(memgraph::utils::InputFile::Position::SET, position));
+    ASSERT_TRUE(file.Read(&value, sizeof(value)));
+  }
+  value ^= 1U;
+  memgraph::utils::OutputFile file;
+  file.Open(wal_file, memgraph::utils::OutputFile::Mode::OVERWRITE_EXISTING);
+  file.SetPosition(memgraph::utils::OutputFile::Position::SET, position);
+  file.Write(&value, sizeof(value));
+  file.Sync();
+  file.Close();
+
+  // The corrupt transaction is in the middle of a finalized WAL, which the
+  // recovery refuses to load.
+  auto info = memgraph::storage::durability::ReadWalInfo(wal_file);
+  AssertWalInfoEqual(infos[0].second, info);
+  ASSERT_TRUE(info.checksum_mismatch);
+  ASSERT_FALSE(memgraph::storage::durability::VerifyWalFile(wal_file));
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_P(WalFileTest, RecycledFile) {
+  const auto wal_directory = storage_directory / "wal";
+  const uint64_t segment_size = 1024 * 1024;
+  memgraph::storage::durability::WalSegmentPool pool(storage_directory / "recycle", segment_size, 1);
+
+  memgraph::storage::durability::WalInfo old_info;
+  {
+    DeltaGenerator gen(wal_directory, GetParam(), 5, memgraph::storage::StorageMode::IN_MEMORY_TRANSACTIONAL, &pool);
+    for (int i = 0; i < 10; ++i) {
+      TRANSACTION(true, { tx.CreateVertex(); });
+    }
+    old_info = gen.GetInfo();
+    gen.FinalizeWal();
+  }
+  ASSERT_EQ(pool.Size(), 1);
+
+  // The finalized file doesn't keep the preallocated space.
+  std::vector<std::filesystem::path> wal_files;
+  for (const auto &item : std::filesystem::directory_iterator(wal_directory)) wal_files.push_back(item.path());
+  ASSERT_EQ(wal_files.size(), 1);
+  ASSERT_LT(std::filesystem::file_size(wal_files.front()), segment_size);
+  AssertWalInfoEqual(old_info, memgraph::storage::durability::ReadWalInfo(wal_files.front()));
+
+  memgraph::storage::durability::WalInfo info;
+  DeltaGenerator::DataT data;
+  std::filesystem::path current_file;
+  {
+    DeltaGenerator gen(wal_directory, GetParam(), 6, memgraph::storage::StorageMode::IN_MEMORY_TRANSACTIONAL, &pool);
+    ASSERT_EQ(pool.Size(), 0);
+    gen.SkipTimestamps(old_info.to_timestamp + 1);
+    TRANSACTION(true, { tx.CreateVertex(); });
+    info = gen.GetInfo();
+    data = gen.GetData();
+    ASSERT_LT(gen.GetPosition(), segment_size);
+  }
+
+  for (const auto &item : std::filesystem::directory_iterator(wal_directory)) {
+    if (item.path().filename().string().ends_with("_current")) current_file = item.path();
+  }
+  ASSERT_FALSE(current_file.empty());
+  ASSERT_EQ(std::filesystem::file_size(current_file), segment_size);
+  // Reading stops before the deltas left from the previous WAL.
+  AssertWalInfoEqual(info, memgraph::storage::durability::ReadWalInfo(current_file));
+  AssertWalDataEqual(data, current_file);
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_P(WalFileTest, RecycledFileStaleDeltas) {
+  const auto wal_directory = storage_directory / "wal";
+  const uint64_t segment_size = 1024 * 1024;
+  memgraph::storage::durability::WalSegmentPool pool(storage_directory / "recycle", segment_size, 1);
+
+  // The previous WAL has newer timestamps than the new one, so the check for
+  // decreasing timestamps can't tell its deltas apart from the new ones.
+  uint64_t old_position = 0;
+  {
+    DeltaGenerator gen(wal_directory, GetParam(), 5, memgraph::storage::StorageMode::IN_MEMORY_TRANSACTIONAL, &pool);
+    gen.SkipTimestamps(1000);
+    for (int i = 0; i < 10; ++i) {
+      TRANSACTION(true, { tx.CreateVertex(); });
+      if (i == 4) old_position = gen.GetPosition();
+    }
+    gen.FinalizeWal();
+  }
+  ASSERT_EQ(pool.Size(), 1);
+
+  memgraph::storage::durability::WalInfo info;
+  DeltaGenerator::DataT data;
+  {
+    DeltaGenerator gen(wal_directory, GetParam(), 6, memgraph::storage::StorageMode::IN_MEMORY_TRANSACTIONAL, &pool);
+    for (int i = 0; i < 5; ++i) {
+      TRANSACTION(true, { tx.CreateVertex(); });
+    }
+    // The new data ends exactly where a delta of the previous WAL starts
+    ASSERT_EQ(gen.GetPosition(), old_position);
+    info = gen.GetInfo();
+    data = gen.GetData();
+  }
+
+  std::filesystem::path current_file;
+  for (const auto &item : std::filesystem::directory_iterator(wal_directory)) {
+    if (item.path().filename().string().ends_with("_current")) current_file = item.path();
+  }
+  ASSERT_FALSE(current_file.empty());
+  AssertWalInfoEqual(info, memgraph::storage::durability::ReadWalInfo(current_file));
+  AssertWalDataEqual(data, current_file);
+}
+
 class StorageModeWalFileTest : public ::testing::TestWithParam<memgraph::storage::StorageMode> {
  public:
   StorageModeWalFileTest() = default;
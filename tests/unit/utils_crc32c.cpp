@@ -0,0 +1,52 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include <algorithm>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "utils/crc32c.hpp"
+
+using memgraph::utils::Crc32c;
+
+TEST(Crc32c, KnownValues) {
+  EXPECT_EQ(Crc32c(0, nullptr, 0), 0);
+  constexpr std::string_view check = "123456789";
+  EXPECT_EQ(Crc32c(0, check.data(), check.size()), 0xE3069283);
+  const std::vector<uint8_t> zeros(32, 0);
+  EXPECT_EQ(Crc32c(0, zeros.data(), zeros.size()), 0x8A9136AA);
+}
+
+TEST(Crc32c, Chunked) {
+  std::vector<uint8_t> data(1000);
+  for (size_t i = 0; i < data.size(); ++i) data[i] = static_cast<uint8_t>(i * 131 + 7);
+  const auto expected = Crc32c(0, data.data(), data.size());
+  for (const size_t chunk : {1UL, 3UL, 8UL, 13UL, 512UL}) {
+    uint32_t crc = 0;
+    for (size_t offset = 0; offset < data.size(); offset += chunk) {
+      crc = Crc32c(crc, data.data() + offset, std::min(chunk, data.size() - offset));
+    }
+    EXPECT_EQ(crc, expected) << "chunk size " << chunk;
+  }
+}
+
+TEST(Crc32c, DetectsBitFlips) {
+  std::vector<uint8_t> data(64, 0x5A);
+  const auto original = Crc32c(0, data.data(), data.size());
+  for (size_t i = 0; i < data.size(); ++i) {
+    data[i] ^= 0x01;
+    EXPECT_NE(Crc32c(0, data.data(), data.size()), original);
+    data[i] ^= 0x01;
+  }
+}
@@ -276,6 +276,42 @@ TEST_F(UtilsFileTest, OutputFileDescriptorLeackage) {
   }
 }
 
+TEST_F(UtilsFileTest, OutputFileTerminator) {
+  const auto file_path = storage / "existing_dir_777" / "existing_file_777";
+  const auto read_file = [&] {
+    std::ifstream file(file_path, std::ios::binary);
+    return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+  };
+  {
+    memgraph::utils::OutputFile handle;
+    handle.Open(file_path, memgraph::utils::OutputFile::Mode::OVERWRITE_EXISTING);
+    handle.Write("abcdefghij");
+    handle.Close();
+  }
+
+  memgraph::utils::OutputFile handle;
+  handle.Open(file_path, memgraph::utils::OutputFile::Mode::OVERWRITE_EXISTING);
+  handle.EnableTerminator();
+  handle.Write("xyz");
+  handle.Sync();
+  ASSERT_EQ(read_file(), std::string("xyz\0efghij", 10));
+
+  // Overwriting already written data doesn't move the terminator
+  handle.SetPosition(memgraph::utils::OutputFile::Position::SET, 1);
+  handle.Write("Y");
+  handle.Sync();
+  ASSERT_EQ(read_file(), std::string("xYz\0efghij", 10));
+
+  handle.SetPosition(memgraph::utils::OutputFile::Position::SET, 3);
+  handle.Write("12");
+  handle.Sync();
+  ASSERT_EQ(read_file(), std::string("xYz12\0ghij", 10));
+
+  handle.TruncateAtPosition();
+  handle.Close();
+  ASSERT_EQ(read_file(), "xYz12");
+}
+
 TEST_F(UtilsFileTest, ConcurrentReadingAndWritting) {
   const auto file_path = storage / "existing_dir_777" / "existing_file_777";
   memgraph::utils::OutputFile handle;
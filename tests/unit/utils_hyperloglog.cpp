@@ -0,0 +1,47 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include <cstdint>
+
+#include <gtest/gtest.h>
+
+#include "utils/hyperloglog.hpp"
+#include "utils/memory.hpp"
+
+using memgraph::utils::HyperLogLog;
+
+TEST(HyperLogLog, Empty) {
+  HyperLogLog sketch(memgraph::utils::NewDeleteResource());
+  EXPECT_EQ(sketch.Estimate(), 0);
+}
+
+TEST(HyperLogLog, SmallCardinalitiesAreExact) {
+  HyperLogLog sketch(memgraph::utils::NewDeleteResource());
+  for (uint64_t i = 0; i < 10; ++i) {
+    sketch.Add(i);
+    sketch.Add(i);
+  }
+  EXPECT_EQ(sketch.Estimate(), 10);
+}
+
+TEST(HyperLogLog, Estimate) {
+  for (const uint64_t cardinality : {1000UL, 100000UL, 1000000UL}) {
+    HyperLogLog sketch(memgraph::utils::NewDeleteResource());
+    for (uint64_t i = 0; i < cardinality; ++i) {
+      sketch.Add(i * 7919);
+      sketch.Add(i * 7919);
+    }
+    // 3 standard errors
+    const auto tolerance = static_cast<double>(cardinality) * 0.05;
+    EXPECT_NEAR(static_cast<double>(sketch.Estimate()), static_cast<double>(cardinality), tolerance)
+        << "cardinality " << cardinality;
+  }
+}
@@ -0,0 +1,113 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include "gtest/gtest.h"
+
+#include "utils/lock_profile.hpp"
+#include "utils/rw_spin_lock.hpp"
+#include "utils/spin_lock.hpp"
+
+#include <algorithm>
+#include <latch>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+
+using namespace std::chrono_literals;
+
+namespace {
+memgraph::utils::LockStatistics Statistics(std::string_view name) {
+  auto statistics = memgraph::utils::GetLockStatistics();
+  auto it = std::ranges::find(statistics, name, &memgraph::utils::LockStatistics::name);
+  EXPECT_NE(it, statistics.end());
+  return *it;
+}
+}  // namespace
+
+TEST(LockProfile, RWSpinLockTryLock) {
+  memgraph::utils::RWSpinLock lock;
+  ASSERT_TRUE(lock.try_lock());
+  ASSERT_FALSE(lock.try_lock());
+  ASSERT_FALSE(lock.try_lock_shared());
+  lock.unlock();
+
+  ASSERT_TRUE(lock.try_lock_shared());
+  ASSERT_TRUE(lock.try_lock_shared());
+  ASSERT_FALSE(lock.try_lock());
+  lock.unlock_shared();
+  lock.unlock_shared();
+  ASSERT_FALSE(lock.is_locked());
+}
+
+TEST(LockProfile, DisabledRecordsNothing) {
+  memgraph::utils::EnableLockProfiling(false);
+  const auto before = Statistics("engine");
+
+  memgraph::utils::ProfiledLock<memgraph::utils::SpinLock, memgraph::utils::LockKind::ENGINE> lock;
+  for (int i = 0; i < 1000; ++i) {
+    auto guard = std::lock_guard{lock};
+  }
+
+  const auto after = Statistics("engine");
+  EXPECT_EQ(after.acquisitions, before.acquisitions);
+  EXPECT_EQ(after.contentions, before.contentions);
+}
+
+TEST(LockProfile, ContendedWaitIsRecorded) {
+  memgraph::utils::EnableLockProfiling(true);
+  const auto before = Statistics("gc");
+
+  memgraph::utils::ProfiledLock<std::mutex, memgraph::utils::LockKind::GC> lock;
+  for (int i = 0; i < 1000; ++i) {
+    auto guard = std::lock_guard{lock};
+  }
+
+  auto locked = std::latch{1};
+  {
+    auto holder = std::jthread{[&] {
+      auto guard = std::lock_guard{lock};
+      locked.count_down();
+      std::this_thread::sleep_for(50ms);
+    }};
+    locked.wait();
+    auto guard = std::lock_guard{lock};
+  }
+  memgraph::utils::EnableLockProfiling(false);
+
+  const auto after = Statistics("gc");
+  // Acquisitions are published once per sampling period of each thread.
+  EXPECT_GE(after.acquisitions - before.acquisitions, 960U);
+  EXPECT_EQ(after.contentions - before.contentions, 1U);
+  EXPECT_GE(after.wait_max_us, 10'000U);
+  EXPECT_GE(after.wait_total_us - before.wait_total_us, 10'000U);
+}
+
+TEST(LockProfile, RWSpinLockContention) {
+  memgraph::utils::EnableLockProfiling(true);
+  const auto before = Statistics("rw_spin_lock");
+
+  memgraph::utils::RWSpinLock lock;
+  auto locked = std::latch{1};
+  {
+    auto holder = std::jthread{[&] {
+      auto guard = std::unique_lock{lock};
+      locked.count_down();
+      std::this_thread::sleep_for(20ms);
+    }};
+    locked.wait();
+    auto guard = std::shared_lock{lock};
+  }
+  memgraph::utils::EnableLockProfiling(false);
+
+  const auto after = Statistics("rw_spin_lock");
+  EXPECT_EQ(after.contentions - before.contentions, 1U);
+  EXPECT_GE(after.wait_total_us - before.wait_total_us, 1'000U);
+}